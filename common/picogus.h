@@ -91,6 +91,13 @@ static const char *modenames[8] = {
 #define CMD_CDLOAD     0x64 // Load CD image or get loaded image index
 #define CMD_CDNAME     0x65 // Get name of loaded CD image
 #define CMD_CDAUTOADV  0x66 // Set autoadvance for CD image on USB reinsert
+#define CMD_CDSPEED    0x67 // Emulated CD drive speed (0 = unlimited)
+#define CMD_CDFRAGS    0x68 // Fragments the loaded CD image is stored in
+#define CMD_CDSEEKIO   0x69 // FAT reads per seek in the loaded CD image, in tenths (0xFFFF = no seeks yet)
+#define CMD_CDCACHE    0x6A // USB sector cache hit rate in percent (0xFF = no reads yet)
+#define CMD_CDLATENCY  0x6B // Time from the last CD audio play command to its audio starting, in ms (0xFFFF = nothing played yet)
+#define CMD_CDDECODE   0x6C // CPU cycles per sample decoding compressed CD audio tracks (0xFFFF = nothing decoded yet)
+#define CMD_CDDECMAX   0x6D // Longest step decoding compressed CD audio tracks, in us
 
 #define CMD_MAINVOL    0x70 // Main Volume
 #define CMD_OPLVOL     0x71 // Adlib volume
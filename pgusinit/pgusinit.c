@@ -135,6 +135,7 @@ static void usage(card_mode_t mode, bool print_all)
         pageprintf("   /cdloadname x - load CD image by name. Names with spaces can be quoted\n");
         pageprintf("   /cdvol n      - set the CD audio volume: 0 - 100\n");
         pageprintf("   /cdauto 1|0   - auto-advance loaded image when same USB drive is reinserted\n");
+        pageprintf("   /cdspeed n    - emulated drive speed, n x 150 KB/s: 1 - 32. Default: 0 (max)\n");
     }
     if (mode == PSG_MODE || print_all) {
         //         "...............................................................................\n"
@@ -475,6 +476,19 @@ static int print_cdimage_current(void)
     }
     printf("CD image loaded: ");
     print_string(CMD_CDNAME);
+
+    outp(CONTROL_PORT, CMD_CDFRAGS); // Select image fragments register
+    uint16_t fragments = inpw(DATA_PORT_LOW);
+    outp(CONTROL_PORT, CMD_CDSEEKIO); // Select FAT reads per seek register
+    uint16_t seek_io = inpw(DATA_PORT_LOW);
+    printf("Image stored in %u fragment%s on the USB drive", fragments, fragments == 1 ? "" : "s");
+    if (seek_io != 0xFFFF) { // 0xFFFF until the image has been read from
+        printf(", %u.%u FAT reads per seek", seek_io / 10, seek_io % 10);
+    }
+    printf("\n");
+    if (seek_io != 0xFFFF && seek_io > 0) { // The seek table covers the image unless it's too fragmented
+        printf("Seeking is slow: copy the image to a freshly formatted USB drive to speed it up.\n");
+    }
     return 0;
 }
 
@@ -501,6 +515,29 @@ static void print_cdemu_status(void)
     outp(CONTROL_PORT, CMD_CDPORT); // Select port register
     uint16_t tmp_uint16 = inpw(DATA_PORT_LOW); // Get port
     printf("CD-ROM emulation on port %x, image auto-advance %s\n", tmp_uint16, tmp_uint8 ? "enabled" : "disabled");
+    outp(CONTROL_PORT, CMD_CDSPEED); // Select CD speed register
+    tmp_uint8 = inp(DATA_PORT_HIGH);
+    if (tmp_uint8) {
+        printf("CD-ROM drive speed: %dx\n", tmp_uint8);
+    } else {
+        printf("CD-ROM drive speed: unlimited\n");
+    }
+    outp(CONTROL_PORT, CMD_CDCACHE); // Select USB cache hit rate register
+    tmp_uint8 = inp(DATA_PORT_HIGH);
+    if (tmp_uint8 <= 100) { // 0xFF until the USB drive has been read from
+        printf("USB drive sector cache hit rate: %u%%\n", tmp_uint8);
+    }
+    outp(CONTROL_PORT, CMD_CDLATENCY); // Select CD audio start latency register
+    tmp_uint16 = inpw(DATA_PORT_LOW);
+    if (tmp_uint16 != 0xFFFF) { // 0xFFFF until CD audio has been played
+        printf("CD audio started %u ms after the last play command\n", tmp_uint16);
+    }
+    outp(CONTROL_PORT, CMD_CDDECODE); // Select compressed CD audio decode cost register
+    tmp_uint16 = inpw(DATA_PORT_LOW);
+    if (tmp_uint16 != 0xFFFF) { // 0xFFFF until a compressed track has been played
+        outp(CONTROL_PORT, CMD_CDDECMAX); // Select longest decode step register
+        printf("CD audio decoding: %u cycles per sample, longest step %u us\n", tmp_uint16, inpw(DATA_PORT_LOW));
+    }
     
     print_cdimage_current();
 }
@@ -940,6 +977,11 @@ static bool cmdSendMouseRate(const char* arg, const int cmd, const int cmd2, con
     return ctrlSendUint8(arg, cmd, 20, 200);
 }
 
+static bool cmdSendCDSpeed(const char* arg, const int cmd, const int cmd2, const int cmd3)
+{
+    return ctrlSendUint8(arg, cmd, 0, 32);
+}
+
 static bool cmdSendSBLockMixer(const char* arg, const int cmd, const int cmd2, const int cmd3)
 {
     return ctrlSendUint8Masked(arg, cmd, 0, 2, (2 << 1), 1);
@@ -1072,6 +1114,7 @@ ParseCommand parseCommands[] = {
     {"/cdlist", cmdCDList, 0, ARG_NONE},
     {"/cdload", cmdCDLoad, CMD_CDLOAD, ARG_REQUIRE},
     {"/cdauto", cmdSendBool, CMD_CDAUTOADV, ARG_REQUIRE, "true"},
+    {"/cdspeed", cmdSendCDSpeed, CMD_CDSPEED, ARG_REQUIRE, "0"},
     {"/cdloadname", cmdCDLoadName, CMD_CDNAME, ARG_REQUIRE},
     {"/mainvol", cmdSetVol, CMD_MAINVOL, ARG_REQUIRE, "100"},
     {"/oplvol", cmdSetVol, CMD_OPLVOL, ARG_REQUIRE, "100"},
@@ -27,10 +27,6 @@
 #include <string.h>
 #include <stdio.h>
 
-#ifndef MIN
-#define MIN(x, y) (((x) < (y)) ? (x) : (y))
-#endif
-
 // Initialize the FIFO (called by producer_init or directly by user)
 void fifo_init(audio_fifo_t *fifo) {
     // Initialize FIFO structure
@@ -38,65 +34,12 @@ void fifo_init(audio_fifo_t *fifo) {
     fifo->state = FIFO_STATE_STOPPED;
     fifo->write_idx = 0;
     fifo->read_idx = 0;
+    fifo->read_pos = 0;
 }
 
 // Reset the FIFO to empty state
 void fifo_reset(audio_fifo_t *fifo) {
     fifo->state = FIFO_STATE_STOPPED;
     fifo->write_idx = fifo->read_idx;
-}
-
-// Add multiple samples to the FIFO
-bool fifo_add_samples(audio_fifo_t *fifo, const audio_sample_t *samples_buffer, uint32_t num_samples_to_add) {
-    // Check basic conditions
-    if (num_samples_to_add == 0) {
-        return true; // Nothing to add, operation considered successful
-    }
-
-    // Check if there's enough space in the FIFO
-    uint32_t level = fifo->write_idx - fifo->read_idx;
-    uint32_t available_space = AUDIO_FIFO_SIZE - level;
-    if (num_samples_to_add > available_space) {
-        return false; // Not enough space for all requested samples
-    }
-
-    // Determine how many samples can be written before wrap-around
-    uint32_t phy_write = fifo->write_idx & AUDIO_FIFO_BITS;
-    uint32_t samples_to_end = AUDIO_FIFO_SIZE - phy_write;
-
-    if (num_samples_to_add <= samples_to_end) {
-        // All samples fit without wrapping around the physical end of the buffer
-        memcpy(&fifo->buffer[phy_write], samples_buffer, num_samples_to_add * sizeof(audio_sample_t));
-    } else {
-        // Samples will wrap around the physical end of the buffer
-        // Part 1: Copy samples up to the end of the physical buffer
-        memcpy(&fifo->buffer[phy_write], samples_buffer, samples_to_end * sizeof(audio_sample_t));
-
-        // Part 2: Copy remaining samples from the beginning of the physical buffer
-        uint32_t remaining_samples = num_samples_to_add - samples_to_end;
-        memcpy(&fifo->buffer[0], samples_buffer + samples_to_end, remaining_samples * sizeof(audio_sample_t));
-    }
-
-    // Update FIFO state
-    fifo->write_idx += num_samples_to_add;
-    if (fifo->write_idx - fifo->read_idx >= AUDIO_FIFO_START_THRESHOLD) {
-        fifo->state = FIFO_STATE_RUNNING;
-    }
-    return true;
-}
-
-// Take num_samples from the FIFO. Note that it is up to the consumer to actually
-// access the bits in the FIFO directly via its instance of audio_fifo_t
-uint32_t fifo_take_samples(audio_fifo_t *fifo, uint32_t num_samples) {
-    if (fifo->state == FIFO_STATE_STOPPED) {
-        return 0;
-    }
-    uint32_t level = fifo->write_idx - fifo->read_idx;
-    uint32_t samples_returned = MIN(level, num_samples);
-    fifo->read_idx += samples_returned;
-    // Only go back to stopped once fifo is fully exhausted
-    if (fifo->write_idx == fifo->read_idx) {
-        fifo->state = FIFO_STATE_STOPPED;
-    }
-    return samples_returned;
+    fifo->read_pos = 0;
 }
@@ -25,6 +25,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 // Packed stereo pair: left in low 16 bits, right in high 16 bits.
 typedef union {
@@ -35,11 +36,12 @@ typedef union {
 // Each FIFO entry is a packed stereo pair.
 typedef sample_pair audio_sample_t;
 
-// CD audio FIFO size in stereo pairs — must be > SAMPLES_PER_SECTOR/2 (588
-// stereo frames per CD sector) to absorb slow USB/FAT reads.
-#define AUDIO_FIFO_SIZE 2048
-#define AUDIO_FIFO_BITS (AUDIO_FIFO_SIZE - 1)
-#define AUDIO_FIFO_START_THRESHOLD 256
+// CD audio arrives a whole sector (588 stereo pairs) at a time, so the FIFO
+// is a ring of sector slots, each pointing at where the producer read that
+// sector's samples. The consumer plays them from there without copying.
+#define AUDIO_FIFO_SLOT_PAIRS 588
+#define AUDIO_FIFO_SLOTS 8
+#define AUDIO_FIFO_SLOT_BITS (AUDIO_FIFO_SLOTS - 1)
 
 #ifdef __cplusplus
 extern "C" {
@@ -52,14 +54,16 @@ typedef enum {
 } fifo_state_t;
 
 // FIFO structure
-// Lock-free SPSC: write_idx is only modified by the producer, read_idx only
-// by the consumer.  Both are unmasked uint32_t counters — mask with
-// AUDIO_FIFO_BITS when indexing into buffer[].  Level = write_idx - read_idx
-// (unsigned subtraction handles wrap correctly).
+// Lock-free SPSC: write_idx is only modified by the producer, read_idx and
+// read_pos only by the consumer.  Both indexes are unmasked uint32_t slot
+// counters — mask with AUDIO_FIFO_SLOT_BITS when indexing into slot[].
+// Level = write_idx - read_idx (unsigned subtraction handles wrap correctly).
+// A slot's samples belong to the consumer until read_idx moves past it.
 typedef struct {
-    audio_sample_t buffer[AUDIO_FIFO_SIZE];
+    const audio_sample_t *slot[AUDIO_FIFO_SLOTS];
     volatile uint32_t write_idx;
     volatile uint32_t read_idx;
+    volatile uint32_t read_pos;    // Pairs already taken from slot read_idx
     volatile fifo_state_t state;
 } audio_fifo_t;
 
@@ -67,48 +71,54 @@ typedef struct {
 // No more get_audio_fifo() - caller owns the fifo instance(s)
 void fifo_init(audio_fifo_t *fifo);
 void fifo_reset(audio_fifo_t *fifo);
-bool fifo_add_samples(audio_fifo_t *fifo, const audio_sample_t *samples_buffer, uint32_t num_samples_to_add);
 
 // Inline functions for performance
 static inline uint32_t fifo_level(audio_fifo_t *fifo) {
     return fifo->write_idx - fifo->read_idx;
 }
 
-static inline bool fifo_add_sample(audio_fifo_t *fifo, audio_sample_t sample) {
-    uint32_t level = fifo->write_idx - fifo->read_idx;
-    if (level == AUDIO_FIFO_SIZE) {
+static inline uint32_t fifo_free_space(audio_fifo_t *fifo) {
+   return AUDIO_FIFO_SLOTS - (fifo->write_idx - fifo->read_idx);
+}
+
+// Oldest sector still owned by the consumer, NULL when the FIFO is empty
+static inline const audio_sample_t *fifo_oldest_slot(audio_fifo_t *fifo) {
+    uint32_t read_idx = fifo->read_idx;
+    if (fifo->write_idx == read_idx) {
+        return NULL;
+    }
+    return fifo->slot[read_idx & AUDIO_FIFO_SLOT_BITS];
+}
+
+// Producer: hands a sector of samples to the consumer, which plays it in place
+static inline bool fifo_add_slot(audio_fifo_t *fifo, const audio_sample_t *samples) {
+    if (fifo->write_idx - fifo->read_idx == AUDIO_FIFO_SLOTS) {
         return false;
     }
-    fifo->buffer[fifo->write_idx & AUDIO_FIFO_BITS] = sample;
+    fifo->slot[fifo->write_idx & AUDIO_FIFO_SLOT_BITS] = samples;
     fifo->write_idx++;
-    if (level + 1 >= AUDIO_FIFO_START_THRESHOLD) {
-        fifo->state = FIFO_STATE_RUNNING;
-    }
+    fifo->state = FIFO_STATE_RUNNING;
     return true;
 }
 
-uint32_t fifo_take_samples(audio_fifo_t *fifo, uint32_t num_samples);
-
-static inline uint32_t fifo_free_space(audio_fifo_t *fifo) {
-   return AUDIO_FIFO_SIZE - (fifo->write_idx - fifo->read_idx);
-}
-
-// Inline version of fifo_take_samples for performance-critical code
-static inline uint32_t fifo_take_samples_inline(audio_fifo_t *fifo, uint32_t num_samples) {
-    if (fifo->state == FIFO_STATE_STOPPED) {
-        return 0;
-    }
-    uint32_t level = fifo->write_idx - fifo->read_idx;
-    uint32_t samples_returned = level < num_samples ? level : num_samples;
-    fifo->read_idx += samples_returned;
-    if (fifo->write_idx == fifo->read_idx) {
-        fifo->state = FIFO_STATE_STOPPED;
+// Consumer: takes the next pair. Only call while state is FIFO_STATE_RUNNING
+// and the FIFO isn't empty.
+static inline audio_sample_t fifo_take_sample(audio_fifo_t *fifo) {
+    uint32_t read_idx = fifo->read_idx;
+    uint32_t read_pos = fifo->read_pos;
+    audio_sample_t sample = fifo->slot[read_idx & AUDIO_FIFO_SLOT_BITS][read_pos];
+    if (++read_pos == AUDIO_FIFO_SLOT_PAIRS) {
+        read_pos = 0;
+        fifo->read_idx = ++read_idx;
+        // Only go back to stopped once fifo is fully exhausted
+        if (fifo->write_idx == read_idx) {
+            fifo->state = FIFO_STATE_STOPPED;
+        }
     }
-    return samples_returned;
+    fifo->read_pos = read_pos;
+    return sample;
 }
 
-// Helper for consumer to get one sample, this is a more fundamental FIFO op
-
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -0,0 +1,430 @@
+/*
+ * flacbench.c — host test and benchmark for the CD image FLAC decoder
+ *
+ * Reads a FLAC track through cdrom_flac.c the way the image backend does:
+ * sequential playback in batches of AUDIO_SECTOR_BATCH raw sectors, then
+ * random seeks that each read one batch, as when a game starts a track.
+ *
+ * FatFS is replaced by f_lseek() and f_read() over the host file, which
+ * issue the drive reads FatFS would for the same calls on a file with a fast
+ * seek table: a partial sector is read into the FIL's sector buffer unless
+ * it is already there, and whole sectors go straight to the caller, up to a
+ * cluster per read. Core 1 waits for every one of those reads, so each
+ * seek's stall is estimated from them as cmd_us per read plus the bytes at
+ * kb_per_s. The defaults are rough USB Full Speed figures, not measurements
+ * of a drive.
+ *
+ *   flacbench <file.flac> [file.pcm] [-n seeks] [-c cluster_kb] [-l cmd_us] [-b kb_per_s] [-p pass_us]
+ *
+ * The same is then done through flac_read_async(), as the firmware plays a
+ * track, over a stand-in for msc_read_async() that lands each read on a
+ * later pass of the play loop: once cmd_us plus the transfer have passed, at
+ * pass_us per pass. Some seeks are dropped part way and some read through
+ * flac_read() in between, as a guest seeking during a batch and a failed
+ * batch do. No FatFS read may happen there, unless flac_read_async() hands
+ * the batch to flac_read(), as it does for frames too long for its window.
+ *
+ * With the PCM flacenc.py writes next to each file, every read is checked
+ * against it and the first mismatch exits with status 1.
+ *
+ * Prints one line of key=value results:
+ *   points         seek table entries
+ *   open_reads     drive reads flac_open() took to build the seek table
+ *   open_ms        estimated stall of those reads
+ *   ns_per_sample  host decode time per stereo sample, playing on
+ *   play_kb_per_s  KB read from the drive per second of audio, playing on
+ *   seek_reads     mean drive reads per random seek
+ *   seek_kb        mean KB read per random seek
+ *   seek_ms        mean estimated stall per random seek
+ *   p99_seek_ms    99th percentile of it
+ *   max_seek_ms    longest of it
+ *   seek_cpu_us    mean host decode time per random seek
+ *   fallbacks      batches flac_read_async() handed to flac_read()
+ *   call_us        mean host time per flac_read_async() call
+ *   p99_call_us    99th percentile of it
+ *   max_call_us    longest of it
+ *   async_seek_ms  mean time from a random seek's first call to its batch
+ *                  being there
+ *   p99_async_seek_ms, max_async_seek_ms
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ff.h"
+#include "cdrom_flac.h"
+#include "msc_app.h"
+
+#define RAW_SECTOR_SIZE    2352
+#define AUDIO_SECTOR_BATCH 4
+#define BATCH_BYTES        (AUDIO_SECTOR_BATCH * RAW_SECTOR_SIZE)
+
+static FILE    *host;
+static uint32_t cluster_sectors = 64;
+static uint32_t buf_sect        = UINT32_MAX;  // File sector in the FIL buffer
+
+// Drive reads so far
+static uint32_t drive_reads;
+static uint64_t drive_bytes;
+
+// What a drive read costs core 1: a fixed time per read plus the transfer
+static double cmd_us   = 500;
+static double kb_per_s = 1000;
+
+// Reads through FatFS, which flac_read_async() mustn't make
+static uint32_t fatfs_reads;
+
+// The read msc_read_async() has in flight, landing at done_us on the clock
+// of the play loop, which moves on by pass_us per pass
+static double        pass_us = 1000;
+static double        sim_us;
+static uint32_t      io_lba, io_count;
+static uint8_t      *io_buff;
+static msc_read_cb_t io_cb;
+static void         *io_ctx;
+static double        io_done_us;
+static int           io_pending;
+
+static double
+stall_ms(double reads, double bytes)
+{
+    return reads * cmd_us / 1000 + bytes / (kb_per_s * 1024) * 1000;
+}
+
+static void
+drive_read(uint32_t sectors)
+{
+    drive_reads++;
+    drive_bytes += sectors * FF_MAX_SS;
+}
+
+FRESULT
+f_lseek(FIL *fp, FSIZE_t ofs)
+{
+    fatfs_reads++;
+    if (ofs > fp->obj.objsize)
+        ofs = fp->obj.objsize;
+    fp->fptr = ofs;
+    // Landing inside a sector loads it into the buffer
+    if ((ofs % FF_MAX_SS) && ofs / FF_MAX_SS != buf_sect) {
+        drive_read(1);
+        buf_sect = ofs / FF_MAX_SS;
+    }
+    return FR_OK;
+}
+
+FRESULT
+f_read(FIL *fp, void *buff, UINT btr, UINT *br)
+{
+    uint8_t *out = (uint8_t *) buff;
+
+    fatfs_reads++;
+    *br = 0;
+    if (btr > fp->obj.objsize - fp->fptr)
+        btr = fp->obj.objsize - fp->fptr;
+    if (fseek(host, fp->fptr, SEEK_SET) || fread(out, 1, btr, host) != btr)
+        return FR_DISK_ERR;
+
+    while (btr) {
+        uint32_t sect = fp->fptr / FF_MAX_SS;
+        uint32_t rcnt;
+        if (fp->fptr % FF_MAX_SS == 0 && btr >= FF_MAX_SS) {
+            // Whole sectors, read straight to the caller a cluster at most
+            uint32_t cc    = btr / FF_MAX_SS;
+            uint32_t csect = sect % cluster_sectors;
+            if (csect + cc > cluster_sectors)
+                cc = cluster_sectors - csect;
+            drive_read(cc);
+            rcnt = cc * FF_MAX_SS;
+        } else {
+            if (sect != buf_sect) {
+                drive_read(1);
+                buf_sect = sect;
+            }
+            rcnt = FF_MAX_SS - fp->fptr % FF_MAX_SS;
+            if (rcnt > btr)
+                rcnt = btr;
+        }
+        fp->fptr += rcnt;
+        *br += rcnt;
+        btr -= rcnt;
+    }
+    return FR_OK;
+}
+
+bool
+msc_read_async(uint32_t lba, uint16_t count, uint8_t *buff, msc_read_cb_t cb, void *ctx)
+{
+    if (io_pending)
+        return false;
+    drive_read(count);
+    io_lba     = lba;
+    io_count   = count;
+    io_buff    = buff;
+    io_cb      = cb;
+    io_ctx     = ctx;
+    io_done_us = sim_us + stall_ms(1, (double) count * FF_MAX_SS) * 1000;
+    io_pending = 1;
+    return true;
+}
+
+bool
+msc_read_busy(const void *buff, uint32_t len)
+{
+    (void) buff;
+    (void) len;
+    return false;
+}
+
+// The file lies in one run of blocks from block 0
+static uint32_t
+bench_map(void *priv, uint32_t seek, uint32_t count, uint32_t *block)
+{
+    const FIL *fp = (const FIL *) priv;
+
+    if (seek >= fp->obj.objsize)
+        return 0;
+    *block = seek / FF_MAX_SS;
+    return count < fp->obj.objsize - seek ? count : fp->obj.objsize - seek;
+}
+
+// A pass of the play loop: lands the read in flight if it's time
+static void
+usb_task(void)
+{
+    sim_us += pass_us;
+    if (io_pending && sim_us >= io_done_us) {
+        // Whole blocks, zeros past the end of the file
+        memset(io_buff, 0, io_count * FF_MAX_SS);
+        if (fseek(host, io_lba * FF_MAX_SS, SEEK_SET) == 0)
+            fread(io_buff, 1, io_count * FF_MAX_SS, host);
+        io_pending = 0;
+        io_cb(io_ctx, true);
+    }
+}
+
+static uint64_t
+now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+// Deterministic, so runs can be compared
+static uint32_t
+next_random(void)
+{
+    static uint32_t x = 2463534242u;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return x;
+}
+
+static int
+compare_double(const void *a, const void *b)
+{
+    double x = *(const double *) a, y = *(const double *) b;
+    return (x > y) - (x < y);
+}
+
+static uint8_t *
+load_file(const char *path, uint32_t *len)
+{
+    FILE    *f = fopen(path, "rb");
+    uint8_t *data;
+
+    if (f == NULL)
+        return NULL;
+    fseek(f, 0, SEEK_END);
+    *len = ftell(f);
+    rewind(f);
+    data = malloc(*len + 1);
+    if (data != NULL && fread(data, 1, *len, f) != *len) {
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    return data;
+}
+
+static void
+usage(void)
+{
+    fprintf(stderr, "usage: flacbench <file.flac> [file.pcm] [-n seeks] [-c cluster_kb] [-l cmd_us] [-b kb_per_s] [-p pass_us]\n");
+    exit(2);
+}
+
+int
+main(int argc, char **argv)
+{
+    const char *in = NULL, *ref = NULL;
+    uint32_t    seeks = 2000, pcm_len = 0;
+    uint8_t    *pcm = NULL;
+    FIL         fil;
+    flac_t      fl;
+    int         error;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc)
+            seeks = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-c") && i + 1 < argc)
+            cluster_sectors = atoi(argv[++i]) * 1024 / FF_MAX_SS;
+        else if (!strcmp(argv[i], "-l") && i + 1 < argc)
+            cmd_us = atof(argv[++i]);
+        else if (!strcmp(argv[i], "-b") && i + 1 < argc)
+            kb_per_s = atof(argv[++i]);
+        else if (!strcmp(argv[i], "-p") && i + 1 < argc)
+            pass_us = atof(argv[++i]);
+        else if (argv[i][0] != '-' && !in)
+            in = argv[i];
+        else if (argv[i][0] != '-' && !ref)
+            ref = argv[i];
+        else
+            usage();
+    }
+    if (!in || !seeks || !cluster_sectors || pass_us <= 0)
+        usage();
+
+    host = fopen(in, "rb");
+    if (host == NULL) {
+        fprintf(stderr, "cannot read %s\n", in);
+        return 2;
+    }
+    if (ref && (pcm = load_file(ref, &pcm_len)) == NULL) {
+        fprintf(stderr, "cannot read %s\n", ref);
+        return 2;
+    }
+    memset(&fil, 0, sizeof(fil));
+    fseek(host, 0, SEEK_END);
+    fil.obj.objsize = ftell(host);
+
+    if (!flac_open(&fl, &fil, &error)) {
+        fprintf(stderr, "%s can't be played (error %d)\n", in, error);
+        return 1;
+    }
+    const uint32_t len = fl.total_samples * 4;
+    if (pcm && pcm_len != len) {
+        fprintf(stderr, "%s holds %u bytes of PCM, %s %u\n", in, len, ref, pcm_len);
+        return 1;
+    }
+    printf("points=%d open_reads=%u open_ms=%.1f", fl.points_num, drive_reads,
+           stall_ms(drive_reads, (double) drive_bytes));
+
+    // Playing on from the start
+    uint8_t *buf = malloc(BATCH_BYTES);
+    drive_reads = 0;
+    drive_bytes = 0;
+    uint64_t start = now_ns();
+    for (uint32_t at = 0; at < len; at += BATCH_BYTES) {
+        uint32_t count = len - at < BATCH_BYTES ? len - at : BATCH_BYTES;
+        if (!flac_read(&fl, buf, at, count) || (pcm && memcmp(buf, pcm + at, count))) {
+            fprintf(stderr, "\nsequential read at %u failed\n", at);
+            return 1;
+        }
+    }
+    const double seconds = fl.total_samples / 44100.0;
+    printf(" ns_per_sample=%.1f play_kb_per_s=%.1f", (double) (now_ns() - start) / fl.total_samples,
+           drive_bytes / 1024.0 / seconds);
+
+    // Random seeks, each reading a batch from a sector
+    double  *stall = malloc(seeks * sizeof(double));
+    uint64_t reads = 0, bytes = 0, cpu_ns = 0;
+    for (uint32_t i = 0; i < seeks; i++) {
+        uint32_t at    = next_random() % (len / RAW_SECTOR_SIZE) * RAW_SECTOR_SIZE;
+        uint32_t count = len - at < BATCH_BYTES ? len - at : BATCH_BYTES;
+        drive_reads = 0;
+        drive_bytes = 0;
+        start = now_ns();
+        if (!flac_read(&fl, buf, at, count) || (pcm && memcmp(buf, pcm + at, count))) {
+            fprintf(stderr, "\nrandom read at %u failed\n", at);
+            return 1;
+        }
+        cpu_ns += now_ns() - start;
+        reads += drive_reads;
+        bytes += drive_bytes;
+        stall[i] = stall_ms(drive_reads, (double) drive_bytes);
+    }
+    qsort(stall, seeks, sizeof(double), compare_double);
+    printf(" seek_reads=%.1f seek_kb=%.1f seek_ms=%.1f p99_seek_ms=%.1f max_seek_ms=%.1f seek_cpu_us=%.1f",
+           (double) reads / seeks, bytes / 1024.0 / seeks, stall_ms((double) reads / seeks, (double) bytes / seeks),
+           stall[seeks * 99 / 100], stall[seeks - 1], cpu_ns / 1000.0 / seeks);
+
+    // Again without waiting for the drive: playing on, then random seeks
+    fl.map      = bench_map;
+    fl.map_priv = &fil;
+    uint32_t batches  = (len + BATCH_BYTES - 1) / BATCH_BYTES + seeks;
+    uint32_t calls    = 0, calls_size = 1024, timed = 0, fallbacks = 0;
+    double  *call_us  = malloc(calls_size * sizeof(double));
+    fatfs_reads       = 0;
+    for (uint32_t i = 0; i < batches; i++) {
+        const int random = i >= batches - seeks;
+        uint32_t  at     = random ? next_random() % (len / RAW_SECTOR_SIZE) * RAW_SECTOR_SIZE : i * BATCH_BYTES;
+        uint32_t  count  = len - at < BATCH_BYTES ? len - at : BATCH_BYTES;
+        uint32_t  done   = 0;
+        // Some seeks are dropped part way, for another
+        uint32_t  drop   = (random && i % 5 == 0) ? 1 + next_random() % 4 : 0;
+        uint32_t  passes = 0;
+        double    begin  = sim_us;
+        int       r;
+
+        if (random && i % 7 == 0) {
+            // A batch read through FatFS, with a read of the window in flight
+            fatfs_reads = 0;
+            if (!flac_read(&fl, buf, at, count) || (pcm && memcmp(buf, pcm + at, count))) {
+                fprintf(stderr, "\nread at %u between async reads failed\n", at);
+                return 1;
+            }
+            fatfs_reads = 0;
+            continue;
+        }
+        do {
+            usb_task();
+            start = now_ns();
+            r     = flac_read_async(&fl, buf, at, count, &done);
+            if (calls == calls_size)
+                call_us = realloc(call_us, (calls_size *= 2) * sizeof(double));
+            call_us[calls++] = (now_ns() - start) / 1000.0;
+        } while (r == 0 && ++passes != drop);
+        if (r == 0)
+            continue;
+        if (r < 0) {
+            fallbacks++;
+            r = flac_read(&fl, buf, at, count);
+            fatfs_reads = 0;
+        }
+        if (r <= 0 || fatfs_reads || (pcm && memcmp(buf, pcm + at, count))) {
+            fprintf(stderr, "\nasync read at %u failed (%d, %u FatFS reads)\n", at, r, fatfs_reads);
+            return 1;
+        }
+        if (random)
+            stall[timed++] = (sim_us - begin) / 1000;
+    }
+    qsort(stall, timed, sizeof(double), compare_double);
+    qsort(call_us, calls, sizeof(double), compare_double);
+    double call_total = 0;
+    for (uint32_t i = 0; i < calls; i++)
+        call_total += call_us[i];
+    double seek_total = 0;
+    for (uint32_t i = 0; i < timed; i++)
+        seek_total += stall[i];
+    printf(" fallbacks=%u call_us=%.1f p99_call_us=%.1f max_call_us=%.1f async_seek_ms=%.1f p99_async_seek_ms=%.1f max_async_seek_ms=%.1f\n",
+           fallbacks, call_total / calls, call_us[calls * 99 / 100], call_us[calls - 1], timed ? seek_total / timed : 0,
+           timed ? stall[timed * 99 / 100] : 0, timed ? stall[timed - 1] : 0);
+    free(call_us);
+
+    // Past the end fails
+    if (flac_read(&fl, buf, len - 4, 8)) {
+        fprintf(stderr, "read past the end succeeded\n");
+        return 1;
+    }
+    flac_close(&fl);
+    free(stall);
+    free(buf);
+    free(pcm);
+    fclose(host);
+    return 0;
+}
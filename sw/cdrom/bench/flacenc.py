@@ -0,0 +1,356 @@
+#!/usr/bin/env python3
+
+"""Writes FLAC test tracks for flacbench, each with the PCM it decodes to
+(<name>.pcm, little endian 16-bit stereo as in a .bin track).
+
+  cd.flac        40 s coded the way flac -5 codes CD audio: fixed 4096
+                 sample blocks, LPC up to order 8 and a SEEKTABLE point
+                 every 2 s; the one to take seek figures from
+  stress.flac    40 s going through every subframe type, stereo mode,
+                 residual coding and header variant the decoder handles,
+                 LPC up to order 32 and escaped partitions
+  probed.flac    stress.flac without a SEEKTABLE, so the decoder probes for
+                 frames to build its own
+  variable.flac  variable block sizes, no SEEKTABLE and an ID3v2 tag in
+                 front
+  short.flac     3 s, shorter than the probe spacing
+  ref.flac       40 s coded by the reference encoder, flac -8, which picks
+                 its own residual partitions and wasted bits; skipped when
+                 flac isn't installed. It never writes variable block sizes,
+                 so variable.flac is the only track with them.
+
+The signal is two tones and noise, with a tenth each of silence, DC, wasted
+low bits and full scale noise. Needs numpy; takes a minute or two.
+"""
+
+import argparse
+import collections
+import os
+import random
+import shutil
+import struct
+import subprocess
+import sys
+
+import numpy as np
+
+RATE = 44100
+FIXED = [[], [1], [2, -1], [3, -3, 1], [4, -6, 4, -1]]
+BLOCK_CODES = {192: 1, 576: 2, 1152: 3, 2304: 4, 4608: 5, 256: 8, 512: 9, 1024: 10, 2048: 11, 4096: 12, 8192: 13}
+
+
+def crc8(data: bytes) -> int:
+    c = 0
+    for x in data:
+        c ^= x
+        for _ in range(8):
+            c = ((c << 1) ^ 0x07) & 0xFF if c & 0x80 else (c << 1) & 0xFF
+    return c
+
+
+def crc16(data: bytes) -> int:
+    c = 0
+    for x in data:
+        c ^= x << 8
+        for _ in range(8):
+            c = ((c << 1) ^ 0x8005) & 0xFFFF if c & 0x8000 else (c << 1) & 0xFFFF
+    return c
+
+
+class BitWriter:
+    def __init__(self) -> None:
+        self.parts: list[str] = []
+        self.n = 0
+
+    def write(self, v: int, n: int) -> None:
+        if n == 0:
+            return
+        assert 0 <= v < (1 << n), (v, n)
+        self.raw(format(v, "0%db" % n))
+
+    def write_signed(self, v: int, n: int) -> None:
+        assert -(1 << (n - 1)) <= v < (1 << (n - 1)), (v, n)
+        self.write(v & ((1 << n) - 1), n)
+
+    def raw(self, bits: str) -> None:
+        self.parts.append(bits)
+        self.n += len(bits)
+
+    def align(self) -> None:
+        if self.n % 8:
+            self.write(0, 8 - self.n % 8)
+
+    def data(self) -> bytes:
+        t = "".join(self.parts)
+        assert len(t) % 8 == 0
+        return int(t, 2).to_bytes(len(t) // 8, "big") if t else b""
+
+
+def utf8(v: int) -> bytes:
+    if v < 0x80:
+        return bytes([v])
+    for n in range(1, 7):
+        if v < (1 << (5 * n + 6)) or n == 6:
+            out = []
+            for _ in range(n):
+                out.append(0x80 | (v & 0x3F))
+                v >>= 6
+            return bytes([((0xFF << (7 - n)) & 0xFF) | v] + out[::-1])
+    raise ValueError(v)
+
+
+def rice_bits(u: np.ndarray, k: int) -> str:
+    return "".join("0" * (int(x) >> k) + "1" + (format(int(x) & ((1 << k) - 1), "0%db" % k) if k else "") for x in u)
+
+
+def residual(bw: BitWriter, res: np.ndarray, order: int, n: int, rng: random.Random, stress: bool) -> None:
+    po = rng.choice([p for p in range(9) if n % (1 << p) == 0 and (n >> p) >= order and (n >> p) > 0])
+    parts, start = [], 0
+    for p in range(1 << po):
+        cnt = (n >> po) - (order if p == 0 else 0)
+        parts.append(res[start:start + cnt])
+        start += cnt
+    ks = []
+    for r in parts:
+        u = np.where(r >= 0, 2 * r, -2 * r - 1).astype(np.int64)
+        ks.append(min(range(25), key=lambda k: int((u >> k).sum()) + len(u) * (k + 1)))
+    method = rng.choice([0, 1]) if max(ks) <= 14 else 1
+    bw.write(method, 2)
+    bw.write(po, 4)
+    pb = 5 if method else 4
+    for r, k in zip(parts, ks):
+        if stress and rng.random() < 0.08:
+            # Escaped partition: raw samples of eb bits
+            m = int(np.abs(r).max()) if len(r) else 0
+            eb = 0 if m == 0 and rng.random() < 0.5 else min(31, max(1, m.bit_length() + 1) + rng.choice([0, 0, 1]))
+            bw.write((1 << pb) - 1, pb)
+            bw.write(eb, 5)
+            if eb:
+                for x in r:
+                    bw.write_signed(int(x), eb)
+        else:
+            bw.write(k, pb)
+            bw.raw(rice_bits(np.where(r >= 0, 2 * r, -2 * r - 1).astype(np.int64), k))
+
+
+def predict(x: np.ndarray, coef, shift: int, order: int) -> np.ndarray:
+    n = len(x)
+    acc = np.zeros(n - order, dtype=np.int64)
+    for j in range(order):
+        acc += int(coef[j]) * x[order - 1 - j:n - 1 - j]
+    return x[order:] - (acc >> shift)
+
+
+def subframe(bw: BitWriter, x: np.ndarray, bps: int, rng: random.Random, stress: bool, max_order: int, stats) -> None:
+    n = len(x)
+    if np.all(x == x[0]) and rng.random() < 0.8:
+        bw.write(0, 8)
+        bw.write_signed(int(x[0]), bps)
+        stats["constant"] += 1
+        return
+    wasted = 0
+    nz = x[x != 0]
+    if len(nz):
+        tz = min((int(v) & -int(v)).bit_length() - 1 for v in nz)
+        if tz > 0 and rng.random() < 0.8:
+            wasted = tz
+    xs = x >> wasted
+    b = bps - wasted
+    choice = rng.random()
+    if not stress:
+        choice = 0.3 if choice < 0.1 else 1
+    if choice < 0.05:
+        t = 1
+    elif choice < 0.35:
+        t = 8 + rng.randint(0, min(4, n))
+    else:
+        t = 31 + rng.randint(1, min(max_order, n))
+    bw.write(0, 1)
+    bw.write(t, 6)
+    if wasted:
+        bw.write(1, 1)
+        bw.raw("0" * (wasted - 1) + "1")
+        stats["wasted"] += 1
+    else:
+        bw.write(0, 1)
+    if t == 1:
+        for v in xs:
+            bw.write_signed(int(v), b)
+        stats["verbatim"] += 1
+        return
+    if t < 32:
+        order = t - 8
+        for v in xs[:order]:
+            bw.write_signed(int(v), b)
+        residual(bw, predict(xs, FIXED[order], 0, order) if order else xs.copy(), order, n, rng, stress)
+        stats["fixed%d" % order] += 1
+        return
+    # LPC with least squares coefficients
+    order = t - 31
+    prec = rng.randint(5, 15) if stress else 12
+    xf = xs.astype(np.float64)
+    c = np.zeros(order)
+    if n > 2 * order:
+        a = np.stack([xf[order - 1 - j:n - 1 - j] for j in range(order)], 1)
+        c, *_ = np.linalg.lstsq(a, xf[order:], rcond=None)
+    c = np.nan_to_num(c)
+    shift = max(0, min(15, (prec - 1) - int(np.ceil(np.log2(max(np.abs(c).max(), 1e-9) + 1e-12)))))
+    q = np.clip(np.round(c * (1 << shift)), -(1 << (prec - 1)), (1 << (prec - 1)) - 1).astype(np.int64)
+    for v in xs[:order]:
+        bw.write_signed(int(v), b)
+    bw.write(prec - 1, 4)
+    bw.write_signed(shift, 5)
+    for v in q:
+        bw.write_signed(int(v), prec)
+    res = predict(xs, q, shift, order)
+    assert np.abs(res).max() < (1 << 30)
+    if b + prec + order.bit_length() > 32:
+        stats["lpc_wide"] += 1
+    residual(bw, res, order, n, rng, stress)
+    stats["lpc"] += 1
+
+
+def encode(left: np.ndarray, right: np.ndarray, path: str, seed: int, stress: bool, variable: bool = False,
+           seektable: bool = True, id3: bool = False, block: int = 4096) -> dict:
+    rng = random.Random(seed)
+    stats = collections.Counter()
+    max_order = 32 if stress else 8
+    total = len(left)
+    frames, sizes = [], []
+    pos = 0
+    while pos < total:
+        if variable:
+            n = rng.choice([192, 576, 1152, 2304, 4608, 256, 4096, rng.randint(16, 255), rng.randint(16, 4608)])
+        else:
+            n = block
+        n = min(n, total - pos)
+        sizes.append(n)
+        l, r = left[pos:pos + n].astype(np.int64), right[pos:pos + n].astype(np.int64)
+        chan = rng.choice([1, 8, 9, 10]) if stress else 10
+        stats["stereo%d" % chan] += 1
+        if chan == 1:
+            c0, c1, b0, b1 = l, r, 16, 16
+        elif chan == 8:
+            c0, c1, b0, b1 = l, l - r, 16, 17
+        elif chan == 9:
+            c0, c1, b0, b1 = l - r, r, 17, 16
+        else:
+            c0, c1, b0, b1 = (l + r) >> 1, l - r, 16, 17
+        h = bytearray([0xFF, 0xF9 if variable else 0xF8])
+        extra = b""
+        if n in BLOCK_CODES and (rng.random() < 0.8 or not stress):
+            bs = BLOCK_CODES[n]
+        elif n <= 256:
+            bs, extra = 6, bytes([n - 1])
+        else:
+            bs, extra = 7, struct.pack(">H", n - 1)
+        src = rng.choice([0, 9, 9, 13, 14]) if stress else 9
+        h.append(bs << 4 | src)
+        h.append(chan << 4 | ((rng.choice([0, 4]) if stress else 4) << 1))
+        h += utf8(pos if variable else len(frames))
+        h += extra
+        if src == 13:
+            h += struct.pack(">H", RATE)
+        if src == 14:
+            h += struct.pack(">H", RATE // 10)
+        h.append(crc8(h))
+        bw = BitWriter()
+        subframe(bw, c0, b0, rng, stress, max_order, stats)
+        subframe(bw, c1, b1, rng, stress, max_order, stats)
+        bw.align()
+        f = bytes(h) + bw.data()
+        frames.append((pos, f + struct.pack(">H", crc16(f))))
+        pos += n
+
+    out = bytearray()
+    if id3:
+        out += b"ID3\x04\x00\x00" + bytes([0, 0, 2, 5]) + b"\x00" * (2 * 128 + 5)
+    out += b"fLaC"
+    lo, hi = (block, block) if not variable else (min(sizes[:-1] or sizes), max(sizes))
+    info = struct.pack(">HH", lo, hi) + b"\x00" * 6
+    info += ((RATE << 44) | (1 << 41) | (15 << 36) | total).to_bytes(8, "big") + b"\x00" * 16
+    blocks = [(0, info)]
+    if seektable:
+        points, off, after = [], 0, 0
+        for sample, f in frames:
+            if sample >= after:
+                points.append(struct.pack(">QQH", sample, off, 4096))
+                after = sample + 2 * RATE
+            off += len(f)
+        points += [struct.pack(">QQH", 0xFFFFFFFFFFFFFFFF, 0, 0)] * 3
+        blocks.append((3, b"".join(points)))
+    blocks.append((4, b"\x10\x00\x00\x00test" + b"\x00" * 4))
+    blocks.append((1, b"\x00" * 100))
+    for i, (t, d) in enumerate(blocks):
+        out.append((0x80 if i == len(blocks) - 1 else 0) | t)
+        out += len(d).to_bytes(3, "big") + d
+    for _, f in frames:
+        out += f
+    with open(path, "wb") as f:
+        f.write(out)
+    return stats
+
+
+def signal(seconds: float, seed: int) -> tuple[np.ndarray, np.ndarray]:
+    rng = np.random.default_rng(seed)
+    n = int(RATE * seconds)
+    t = np.arange(n) / RATE
+    left = 8000 * np.sin(2 * np.pi * 440 * t) + 3000 * np.sin(2 * np.pi * 1234 * t + 1) + rng.normal(0, 300, n)
+    right = 7000 * np.sin(2 * np.pi * 330 * t + 0.5) + 0.6 * left + rng.normal(0, 300, n)
+    left = np.clip(left, -32768, 32767).astype(np.int64)
+    right = np.clip(right, -32768, 32767).astype(np.int64)
+    seg = n // 10
+    left[seg:2 * seg] = right[seg:2 * seg] = 0
+    left[2 * seg:3 * seg], right[2 * seg:3 * seg] = 1234, -5
+    left[3 * seg:4 * seg] &= ~7
+    right[3 * seg:4 * seg] &= ~3
+    left[4 * seg:5 * seg] = rng.integers(-32768, 32768, seg)
+    right[4 * seg:5 * seg] = rng.integers(-32768, 32768, seg)
+    left[5 * seg:5 * seg + 100], right[5 * seg:5 * seg + 100] = 32767, -32768
+    return left, right
+
+
+TRACKS = {
+    "cd": dict(seconds=40, seed=1, stress=False),
+    "stress": dict(seconds=40, seed=2, stress=True),
+    "probed": dict(seconds=40, seed=2, stress=True, seektable=False),
+    "variable": dict(seconds=40, seed=3, stress=True, variable=True, seektable=False, id3=True),
+    "short": dict(seconds=3, seed=4, stress=True),
+    "ref": dict(seconds=40, reference=True),
+}
+
+
+def main(argv: list[str]) -> int:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--out", default=".", help="directory to write the tracks to")
+    parser.add_argument("tracks", nargs="*", help="tracks to write, all by default")
+    args = parser.parse_args(argv[1:])
+    for name in args.tracks:
+        if name not in TRACKS:
+            parser.error("unknown track %s, not one of %s" % (name, " ".join(TRACKS)))
+
+    os.makedirs(args.out, exist_ok=True)
+    for name in args.tracks or TRACKS:
+        opts = dict(TRACKS[name])
+        reference = opts.pop("reference", False)
+        flac = shutil.which("flac") if reference else None
+        if reference and flac is None:
+            print(name, "skipped: needs flac")
+            continue
+        left, right = signal(opts.pop("seconds"), seed=1)
+        base = os.path.join(args.out, name)
+        with open(base + ".pcm", "wb") as f:
+            f.write(np.stack([left, right], 1).astype("<i2").tobytes())
+        if flac is not None:
+            subprocess.run([flac, "-8", "--silent", "--force", "--force-raw-format", "--endian=little",
+                            "--sign=signed", "--channels=2", "--bps=16", "--sample-rate=%d" % RATE,
+                            "-o", base + ".flac", base + ".pcm"], check=True)
+            print(name, "flac -8")
+            continue
+        stats = encode(left, right, base + ".flac", **opts)
+        print(name, " ".join("%s=%d" % kv for kv in sorted(stats.items())))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,337 @@
+/*
+ * tocbench.c — host test and benchmark for the CD image TOC lookups
+ *
+ * Builds random track layouts and checks cdi_get_track() and
+ * cdi_get_audio_sub(), which look sectors up in the TOC table with a hint and
+ * a binary search, against the linear scan of the track list they replaced.
+ * Layouts have 1 to 99 tracks, may start past sector 0 (a pregap before
+ * track 1, reported as index 0 counting down to the track) and may hold
+ * tracks of no length. Each is queried at random, at every track boundary and
+ * sector by sector as playback and subchannel polling do, so stale hints are
+ * covered too. The first mismatch exits with status 1.
+ *
+ *   tocbench [-n layouts] [-s seed]
+ *
+ * Prints one line of key=value results:
+ *   layouts      layouts checked
+ *   queries      lookups checked
+ *   linear_ns    host time per lookup of the linear scan, polling a 99 track
+ *                disc sector by sector
+ *   lookup_ns    the same for cdi_get_track()
+ *   random_ns    cdi_get_track() at random sectors of that disc
+ *   sub_ns       cdi_get_audio_sub() polling sector by sector
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cdrom_image_backend.c"
+
+/* The backend's file access isn't used: layouts are built in memory */
+FRESULT
+f_open(FIL *fp, const TCHAR *path, BYTE mode)
+{
+    (void) fp;
+    (void) path;
+    (void) mode;
+    return FR_NO_FILE;
+}
+
+FRESULT
+f_close(FIL *fp)
+{
+    (void) fp;
+    return FR_OK;
+}
+
+FRESULT
+f_lseek(FIL *fp, FSIZE_t ofs)
+{
+    (void) fp;
+    (void) ofs;
+    return FR_INT_ERR;
+}
+
+FRESULT
+f_read(FIL *fp, void *buff, UINT btr, UINT *br)
+{
+    (void) fp;
+    (void) buff;
+    (void) btr;
+    *br = 0;
+    return FR_INT_ERR;
+}
+
+TCHAR *
+f_gets(TCHAR *buff, int len, FIL *fp)
+{
+    (void) buff;
+    (void) len;
+    (void) fp;
+    return NULL;
+}
+
+uint32_t
+msc_disk_read_count(void)
+{
+    return 0;
+}
+
+bool
+msc_read_async(uint32_t lba, uint16_t count, uint8_t *buff, msc_read_cb_t cb, void *ctx)
+{
+    (void) lba;
+    (void) count;
+    (void) buff;
+    (void) cb;
+    (void) ctx;
+    return false;
+}
+
+bool
+msc_read_busy(const void *buff, uint32_t len)
+{
+    (void) buff;
+    (void) len;
+    return false;
+}
+
+void
+fatal(const char *fmt, ...)
+{
+    va_list ap;
+    va_start(ap, fmt);
+    vfprintf(stderr, fmt, ap);
+    va_end(ap);
+    exit(1);
+}
+
+static uint64_t checked;
+
+/* cdi_get_track() as it was, scanning the track list */
+static int
+linear_get_track(const cd_img_t *cdi, uint32_t sector)
+{
+    if (cdi->tracks_num < 2)
+        return -1;
+
+    for (int i = 0; i < (cdi->tracks_num - 1); i++) {
+        const track_t *cur  = &cdi->tracks[i];
+        const track_t *next = &cdi->tracks[i + 1];
+
+        if ((i == 0) && (sector < cur->start))
+            return cur->number;
+        if ((cur->start <= sector) && (sector < next->start))
+            return cur->number;
+    }
+
+    return -1;
+}
+
+static uint64_t
+now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+// Deterministic, so runs can be compared
+static uint32_t rng = 2463534242u;
+
+static uint32_t
+next_random(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static uint32_t
+msf_frames(const TMSF *msf)
+{
+    return MSF_TO_FRAMES(msf->min, msf->sec, msf->fr);
+}
+
+/* n tracks and the lead out, the first starting at first; tracks of no
+   length when max_len allows it */
+static int
+make_layout(cd_img_t *cdi, int n, uint32_t first, uint32_t max_len)
+{
+    uint32_t start = first;
+
+    memset(cdi, 0, sizeof(*cdi));
+    cdi->tracks_num = n + 1;
+    cdi->tracks     = calloc(n + 1, sizeof(track_t));
+    for (int i = 0; i <= n; i++) {
+        track_t *trk      = &cdi->tracks[i];
+        trk->number       = i + 1;
+        trk->track_number = (i == n) ? 0xAA : i + 1;
+        trk->attr         = (i == n) ? 0x16 : ((next_random() & 1) ? 0x10 : 0x14);
+        trk->start        = start;
+        start += next_random() % (max_len + 1);
+    }
+    return cdi_build_toc(cdi);
+}
+
+static int
+check(cd_img_t *cdi, uint32_t sector)
+{
+    const int   lead_out = cdi->tracks_num - 1;
+    const int   want     = linear_get_track(cdi, sector);
+    const int   got      = cdi_get_track(cdi, sector);
+    uint8_t     attr, track, index;
+    TMSF        rel, abs;
+
+    checked++;
+    if (got != want) {
+        fprintf(stderr, "sector %u of %d tracks: track %d, linear scan %d\n", sector, lead_out, got, want);
+        return 0;
+    }
+    if (cdi_get_audio_sub(cdi, sector, &attr, &track, &index, &rel, &abs) != (want > 0)) {
+        fprintf(stderr, "sector %u of %d tracks: subchannel %s\n", sector, lead_out, want > 0 ? "missing" : "past the lead out");
+        return 0;
+    }
+    if (want < 0)
+        return 1;
+
+    const track_t *trk     = &cdi->tracks[want - 1];
+    const int      pregap  = sector < trk->start;
+    const uint32_t rel_pos = pregap ? trk->start - sector : sector - trk->start;
+    if ((track != want) || (attr != trk->attr) || (index != !pregap) ||
+        (msf_frames(&rel) != rel_pos) || (msf_frames(&abs) != sector + 150)) {
+        fprintf(stderr, "sector %u of %d tracks: track %u attr %02X index %u rel %u abs %u, "
+                "want track %d attr %02X index %d rel %u abs %u\n",
+                sector, lead_out, track, attr, index, msf_frames(&rel), msf_frames(&abs),
+                want, trk->attr, !pregap, rel_pos, sector + 150);
+        return 0;
+    }
+    return 1;
+}
+
+static int
+check_layout(cd_img_t *cdi)
+{
+    const int      lead_out = cdi->tracks_num - 1;
+    const uint32_t end      = cdi->tracks[lead_out].start;
+
+    // Every boundary, including the pregap, the lead out and past it
+    for (int i = 0; i <= lead_out; i++) {
+        const uint32_t start = cdi->tracks[i].start;
+        if ((start && !check(cdi, start - 1)) || !check(cdi, start) || !check(cdi, start + 1))
+            return 0;
+    }
+    if (!check(cdi, 0) || !check(cdi, end + 100) || !check(cdi, UINT32_MAX))
+        return 0;
+
+    // Playing through, then back and forth between two points
+    for (uint32_t sector = 0; sector < end + 2; sector += 1 + next_random() % 8) {
+        if (!check(cdi, sector))
+            return 0;
+    }
+    for (int i = 0; i < 200; i++) {
+        const uint32_t a = next_random() % (end + 2), b = next_random() % (end + 2);
+        if (!check(cdi, a) || !check(cdi, b) || !check(cdi, a + 1))
+            return 0;
+    }
+
+    for (int t = 1; t <= lead_out + 1; t++) {
+        const track_t *trk = &cdi->tracks[t - 1];
+        int            num;
+        TMSF           msf;
+        uint32_t       lba;
+        uint8_t        attr;
+
+        if (!cdi_get_audio_track_info(cdi, 0, t, &num, &msf, &attr) || (num != trk->track_number) ||
+            (attr != trk->attr) || (msf_frames(&msf) != trk->start + 150) ||
+            !cdi_get_audio_track_info_lba(cdi, 0, t, &num, &lba, &attr) || (lba != trk->start)) {
+            fprintf(stderr, "track %d of %d: wrong TOC entry\n", t, lead_out);
+            return 0;
+        }
+    }
+    if (cdi_get_audio_track_info(cdi, 0, 0, NULL, NULL, NULL) ||
+        cdi_get_audio_track_info(cdi, 0, lead_out + 2, NULL, NULL, NULL)) {
+        fprintf(stderr, "%d tracks: TOC entry outside the disc\n", lead_out);
+        return 0;
+    }
+    return 1;
+}
+
+static void
+usage(void)
+{
+    fprintf(stderr, "usage: tocbench [-n layouts] [-s seed]\n");
+    exit(2);
+}
+
+int
+main(int argc, char **argv)
+{
+    uint32_t layouts = 2000;
+    cd_img_t cdi;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc)
+            layouts = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-s") && i + 1 < argc)
+            rng = strtoul(argv[++i], NULL, 0) | 1;
+        else
+            usage();
+    }
+    if (!layouts)
+        usage();
+
+    for (uint32_t i = 0; i < layouts; i++) {
+        // Every fourth layout has no pregap, and some have tracks of no length
+        const int      n     = 1 + next_random() % 99;
+        const uint32_t first = (i % 4) ? next_random() % 300 : 0;
+        if (!make_layout(&cdi, n, first, (i % 3) ? 4000 : 3)) {
+            fprintf(stderr, "no memory for the TOC\n");
+            return 1;
+        }
+        if (!check_layout(&cdi))
+            return 1;
+        cdi_clear_tracks(&cdi);
+    }
+    printf("layouts=%u queries=%llu", layouts, (unsigned long long) checked);
+
+    // A full disc, polled once per sector played
+    make_layout(&cdi, 99, 150, 6000);
+    const uint32_t end = cdi.tracks[99].start;
+    uint8_t        attr, track, index;
+    TMSF           rel, abs;
+    volatile int   sink = 0;
+
+    uint64_t start = now_ns();
+    for (uint32_t sector = 0; sector < end; sector++)
+        sink += linear_get_track(&cdi, sector);
+    const double linear_ns = (double) (now_ns() - start) / end;
+
+    start = now_ns();
+    for (uint32_t sector = 0; sector < end; sector++)
+        sink += cdi_get_track(&cdi, sector);
+    const double lookup_ns = (double) (now_ns() - start) / end;
+
+    uint32_t *random = malloc(end * sizeof(uint32_t));
+    for (uint32_t i = 0; i < end; i++)
+        random[i] = next_random() % end;
+    start = now_ns();
+    for (uint32_t i = 0; i < end; i++)
+        sink += cdi_get_track(&cdi, random[i]);
+    const double random_ns = (double) (now_ns() - start) / end;
+
+    start = now_ns();
+    for (uint32_t sector = 0; sector < end; sector++)
+        sink += cdi_get_audio_sub(&cdi, sector, &attr, &track, &index, &rel, &abs);
+    const double sub_ns = (double) (now_ns() - start) / end;
+
+    printf(" linear_ns=%.1f lookup_ns=%.1f random_ns=%.1f sub_ns=%.1f\n", linear_ns, lookup_ns, random_ns, sub_ns);
+    (void) sink;
+    free(random);
+    cdi_clear_tracks(&cdi);
+    return 0;
+}
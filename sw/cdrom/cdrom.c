@@ -30,6 +30,7 @@
 #include "cdrom.h"
 #include "cdrom_image_manager.h"
 #include "cdrom_error_msg.h"
+#include "msc_app.h"
 #include "pico/multicore.h"
 #include "hardware/structs/timer.h"
 #include "audio/volctrl.h"
@@ -120,6 +121,8 @@ bcd2bin(uint8_t x)
 */
 
 void cdrom_tasks(cdrom_t *dev) {
+    // Time out reads the USB drive never answers
+    msc_app_task();
     // Will almost always be CD_COMMAND_NONE, so use __builtin_expect to tell the compiler
     switch (__builtin_expect(dev->image_command, CD_COMMAND_NONE)) {
     case CD_COMMAND_NONE:
@@ -127,9 +130,9 @@ void cdrom_tasks(cdrom_t *dev) {
         break;
     case CD_COMMAND_IMAGE_LIST:
         cdrom_errorstr_clear();
-        dev->image_list = cdman_list_images(&dev->image_count);
+        dev->image_count = cdman_catalog_list();
         dev->image_command = CD_COMMAND_NONE;
-        dev->image_status = dev->image_list ? CD_STATUS_READY : CD_STATUS_ERROR;
+        dev->image_status = dev->image_count ? CD_STATUS_READY : CD_STATUS_ERROR;
         break;
     case CD_COMMAND_IMAGE_LOAD_INDEX:
         cdman_load_image_index(dev, dev->image_data);
@@ -232,14 +235,18 @@ cdrom_stop(cdrom_t *dev)
 {
     if (dev->cd_status > CD_STATUS_DATA_ONLY)
         dev->cd_status = CD_STATUS_STOPPED;
-    dev->audio_staging_sectors = 0;
-    dev->audio_staging_index = 0;
-    dev->audio_sector_consumed_pairs = 0;
 #if USE_CD_AUDIO_FIFO
     fifo_reset(&dev->audio_fifo);
 #endif
 }
 
+/* Notes that the guest is likely to play from lba next, so the start of it
+   can be read while the drive is idle, see cdrom_audio_prefetch() */
+static void cdrom_audio_prefetch_at(cdrom_t *dev, uint32_t lba, uint32_t settle_us) {
+    dev->audio_prefetch_us = timer_hw->timerawl + settle_us;
+    dev->audio_prefetch_lba = lba;
+}
+
 uint8_t cdrom_seek(cdrom_t *dev, int m, int s, int f) {
     uint32_t pos;
     if (!dev) return 0;
@@ -249,96 +256,302 @@ uint8_t cdrom_seek(cdrom_t *dev, int m, int s, int f) {
     //TODO: Should i check if this is a valid seek?
     dev->seek_pos = pos;
     cdrom_stop(dev);
+    cdrom_audio_prefetch_at(dev, pos, 0);
     return 1;
 }
 
 #if USE_CD_AUDIO_FIFO
-audio_fifo_t* cdrom_audio_fifo_peek(cdrom_t *dev) {
-    return &dev->audio_fifo;
+static void cdrom_audio_read_done(void *ctx, bool ok) {
+    cdrom_t *dev = (cdrom_t *) ctx;
+    dev->audio_read_state = ok ? CD_IO_DONE : CD_IO_FAILED;
 }
-void cdrom_audio_fifo_init(cdrom_t *dev) {
-    fifo_init(&dev->audio_fifo);
+
+/* Hands sectors that landed in the ring at offset to the audio FIFO, which
+   plays them from there */
+static void cdrom_audio_queue(cdrom_t *dev, uint32_t sectors, uint32_t offset) {
+    const uint8_t *ring = (const uint8_t *)dev->audio_ring;
+    cdrom_log("CD-ROM %i: Batch read %u sectors at LBA %08X\n", dev->id, sectors, dev->seek_pos);
+    if (dev->audio_start_pending) {
+        dev->audio_start_pending = 0;
+        dev->audio_start_latency_us = timer_hw->timerawl - dev->audio_play_us;
+    }
+    for (uint32_t i = 0; i < sectors; i++) {
+        fifo_add_slot(&dev->audio_fifo, (const sample_pair *)(ring + offset + i * RAW_SECTOR_SIZE));
+    }
+    dev->seek_pos += sectors;
+    dev->audio_ring_head = offset + sectors * RAW_SECTOR_SIZE;
 }
 
-bool cdrom_audio_callback(cdrom_t *dev, uint32_t len) {
-    bool ret = true;
+// Sectors that fit in size bytes of the ring when read in whole blocks
+static uint32_t cdrom_audio_ring_fit(uint32_t size, uint32_t offset) {
+    size = size / 512 * 512;
+    return (size > offset) ? (size - offset) / RAW_SECTOR_SIZE : 0;
+}
 
-    if (dev->cd_status != CD_STATUS_PLAYING) {
-        return false;
+/* Finds room in the ring for up to count sectors read in whole blocks, the
+   first sector's samples starting offset bytes into the first block. Sets
+   *pos to where the read should land and returns how many sectors fit
+   there, or 0 while it's worth waiting for the FIFO to play enough to make
+   room for a batch. */
+static uint32_t cdrom_audio_ring_room(cdrom_t *dev, uint32_t offset, uint32_t count, uint32_t *pos) {
+    const uint8_t *ring = (const uint8_t *)dev->audio_ring;
+    const sample_pair *oldest = fifo_oldest_slot(&dev->audio_fifo);
+    // Sectors still to be played run from tail up to head, wrapping around
+    // the end of the ring when head is below tail. With nothing left to
+    // play, start over from the beginning.
+    uint32_t tail = oldest ? (uint32_t)((const uint8_t *)oldest - ring) : 0;
+    uint32_t start = oldest ? dev->audio_ring_head : 0;
+    uint32_t end = (oldest && start <= tail) ? tail : AUDIO_RING_SIZE;
+    uint32_t fit = cdrom_audio_ring_fit(end - start, offset);
+
+    // Wrap around to the start if more fits there than before the end
+    if (start > tail && cdrom_audio_ring_fit(tail, offset) > fit) {
+        start = 0;
+        fit = cdrom_audio_ring_fit(tail, offset);
+    }
+    if (fit > count) {
+        fit = count;
+    }
+    if (fit > fifo_free_space(&dev->audio_fifo)) {
+        fit = fifo_free_space(&dev->audio_fifo);
+    }
+    *pos = start;
+    // Hold off on short reads while there is plenty left to play
+    if (fit < count && fifo_level(&dev->audio_fifo) > AUDIO_RING_LOW) {
+        return 0;
     }
+    return fit;
+}
 
-    // --- Fill audio_fifo from staging buffer, batch-reading new sectors as needed ---
-    while (fifo_level(&dev->audio_fifo) < len && ret) {
-        // Advance to next sector in batch if current one is fully consumed
-        if (dev->audio_sector_consumed_pairs >= STEREO_SAMPLES_PER_SECTOR) {
-            dev->audio_staging_index++;
-            dev->audio_sector_consumed_pairs = 0;
+/* Decodes on into the ring the batch of a track that is stored compressed,
+   a step per call so core 1 gets back to the other sound cards in between.
+   The decoder reads the track from the USB drive in the background. */
+static void cdrom_audio_decode(cdrom_t *dev) {
+    const uint32_t start = timer_hw->timerawl;
+    int r = dev->ops ? dev->ops->read_audio_async(dev, (uint8_t *)dev->audio_ring + dev->audio_read_offset,
+                                                  dev->audio_read_lba, dev->audio_read_count,
+                                                  &dev->audio_read_done) : -1;
+    const uint32_t us = timer_hw->timerawl - start;
+
+    dev->audio_decode_us += us;
+    if (us > dev->audio_decode_max_us) {
+        dev->audio_decode_max_us = us;
+    }
+    if (r != 0) {
+        dev->audio_read_decode = 0;
+        if (r > 0) {
+            dev->audio_read_count = r;
+            dev->audio_decode_sectors += r;
         }
+        dev->audio_read_state = (r > 0) ? CD_IO_DONE : CD_IO_FAILED;
+    }
+}
 
-        // Read a new batch when the staging buffer is exhausted
-        if (dev->audio_staging_index >= dev->audio_staging_sectors) {
-            if (dev->seek_pos >= dev->cd_end) {
-                cdrom_log("CD-ROM %i: Playing completed (reached cd_end)\n", dev->id);
-                dev->cd_status = CD_STATUS_PLAYING_COMPLETED;
-                ret = false;
-                break;
-            }
+/* Starts decoding up to count sectors at lba into the ring, see
+   cdrom_audio_decode(). Returns as cdrom_audio_read_async() does. */
+static int cdrom_audio_decode_start(cdrom_t *dev, uint32_t lba, uint32_t count) {
+    uint32_t pos, fit;
+    // A batch that timed out may still land where this one would go
+    if (!(fit = cdrom_audio_ring_room(dev, 0, count, &pos)) ||
+        msc_read_busy((uint8_t *)dev->audio_ring + pos, fit * RAW_SECTOR_SIZE)) {
+        return 0;
+    }
+    dev->audio_read_lba = lba;
+    dev->audio_read_count = fit;
+    dev->audio_read_offset = pos;
+    dev->audio_read_gen = dev->readahead_gen;
+    dev->audio_read_done = 0;
+    dev->audio_read_decode = 1;
+    dev->audio_read_state = CD_IO_PENDING;
+    cdrom_audio_decode(dev);
+    if (dev->audio_read_state == CD_IO_FAILED && !dev->audio_read_done) {
+        // The track can't be decoded this way
+        dev->audio_read_state = CD_IO_IDLE;
+        return -1;
+    }
+    return 1;
+}
 
-            uint32_t avail = dev->cd_end - dev->seek_pos;
-            uint32_t batch = (avail < AUDIO_SECTOR_BATCH) ? avail : AUDIO_SECTOR_BATCH;
-            int sectors_read;
+/* Starts reading up to count sectors at lba straight from the USB drive into
+   the ring. Returns 1 once the read is on its way, 0 while the ring has no
+   room for it yet and -1 if the image or the drive can't take it, so the
+   sectors have to be read through FatFS. */
+static int cdrom_audio_read_async(cdrom_t *dev, uint32_t lba, uint32_t count) {
+    uint32_t block, offset, stride, pos, fit;
+    int mapped = dev->ops->map_sectors ?
+                 dev->ops->map_sectors(dev, 1, lba, count, &block, &offset, &stride) : 0;
+    if (mapped <= 0 && dev->ops->read_audio_async) {
+        return cdrom_audio_decode_start(dev, lba, count);
+    }
+    // Sample pairs are read as words, so they have to stay aligned
+    if (mapped <= 0 || (offset & 3)) {
+        return -1;
+    }
+    if (!(fit = cdrom_audio_ring_room(dev, offset, mapped, &pos))) {
+        return 0;
+    }
+    dev->audio_read_lba = lba;
+    dev->audio_read_count = fit;
+    dev->audio_read_offset = pos + offset;
+    dev->audio_read_gen = dev->readahead_gen;
+    dev->audio_read_state = CD_IO_PENDING;
+    if (!msc_read_async(block, (offset + fit * RAW_SECTOR_SIZE + 511) / 512,
+                        (uint8_t *)dev->audio_ring + pos, cdrom_audio_read_done, dev)) {
+        dev->audio_read_state = CD_IO_IDLE;
+        return -1;
+    }
+    dev->seek_stats.seeks++;
+    return 1;
+}
 
-            if (dev->audio_muted_soft) {
-                cdrom_log("CD-ROM %i: Muted. Faking batch read of %u sectors with silence.\n", dev->id, batch);
-                memset(dev->audio_sector_buffer, 0, batch * RAW_SECTOR_SIZE);
-                sectors_read = batch;
-            } else {
-                sectors_read = dev->ops->read_audio_sectors(dev, dev->audio_sector_buffer, dev->seek_pos, batch);
-            }
+/* Reads the first batch at audio_prefetch_lba while the drive isn't playing
+   and leaves it in the ring. If the guest then plays from there,
+   cdrom_audio_fill() queues it without waiting for the USB drive. */
+static void cdrom_audio_prefetch(cdrom_t *dev) {
+    const uint32_t lba = dev->audio_prefetch_lba;
+    if (dev->audio_read_state == CD_IO_PENDING && dev->audio_read_decode) {
+        if (dev->audio_read_gen == dev->readahead_gen) {
+            cdrom_audio_decode(dev);
+        } else {
+            dev->audio_read_decode = 0;
+            dev->audio_read_state = CD_IO_IDLE;
+        }
+    }
+    if (lba == AUDIO_PREFETCH_NONE || dev->audio_read_state == CD_IO_PENDING ||
+        (int32_t)(timer_hw->timerawl - dev->audio_prefetch_us) < 0) {
+        return;
+    }
+    if (dev->audio_read_state == CD_IO_DONE && dev->audio_read_lba == lba &&
+        dev->audio_read_gen == dev->readahead_gen) {
+        // Already holding it
+        dev->audio_prefetch_lba = AUDIO_PREFETCH_NONE;
+        return;
+    }
+    dev->audio_read_state = CD_IO_IDLE;
+    if (!dev->ops || !(dev->ops->track_type(dev, lba) & CD_TRACK_AUDIO) ||
+        cdrom_audio_read_async(dev, lba, AUDIO_SECTOR_BATCH) != 0) {
+        // Started, or not worth trying again; otherwise wait for the FIFO
+        // to make room
+        if (dev->audio_prefetch_lba == lba) {
+            dev->audio_prefetch_lba = AUDIO_PREFETCH_NONE;
+        }
+    }
+}
 
-            if (sectors_read > 0) {
-                cdrom_log("CD-ROM %i: Batch read %u sectors at LBA %08X\n", dev->id, sectors_read, dev->seek_pos);
-                dev->seek_pos += sectors_read;
-                dev->audio_staging_sectors = sectors_read;
-                dev->audio_staging_index = 0;
-                dev->audio_sector_consumed_pairs = 0;
+/* Keeps the ring the audio FIFO plays from topped up. Batches are read
+   straight from the USB drive into the ring in the background when the
+   image allows it, and queued on a later call; otherwise they are read
+   through FatFS. Returns 1 when sectors were queued, 0 while a read is in
+   flight or the ring is full and -1 when playback has ended or a read
+   failed. */
+static int cdrom_audio_fill(cdrom_t *dev) {
+    uint8_t state = dev->audio_read_state;
+    bool retry = false;
+    if (state == CD_IO_PENDING && dev->audio_read_decode) {
+        // Decode on, unless it's no longer wanted
+        if (dev->audio_read_lba == dev->seek_pos && dev->seek_pos < dev->cd_end &&
+            dev->audio_read_gen == dev->readahead_gen) {
+            cdrom_audio_decode(dev);
+        } else {
+            dev->audio_read_decode = 0;
+            dev->audio_read_state = CD_IO_IDLE;
+        }
+        state = dev->audio_read_state;
+    }
+    if (state == CD_IO_PENDING) {
+        return 0;
+    }
+    if (state != CD_IO_IDLE) {
+        dev->audio_read_state = CD_IO_IDLE;
+        // Drop the result if the guest seeked or changed discs while it was
+        // in flight, or it was prefetched for somewhere else
+        if (dev->audio_read_lba == dev->seek_pos && dev->seek_pos < dev->cd_end &&
+            dev->audio_read_gen == dev->readahead_gen) {
+            if (state == CD_IO_FAILED) {
+                // Read the batch again through FatFS, as the data path does
+                cdrom_log("CD-ROM %i: Batch read at LBA %08X failed, retrying\n", dev->id, dev->seek_pos);
+                retry = true;
             } else {
-                cdrom_log("CD-ROM %i: Batch read at LBA %08X failed\n", dev->id, dev->seek_pos);
-                dev->cd_status = CD_STATUS_STOPPED;
-                ret = false;
-                break;
+                uint32_t sectors = dev->audio_read_count;
+                if (sectors > dev->cd_end - dev->seek_pos) {
+                    sectors = dev->cd_end - dev->seek_pos;
+                }
+                cdrom_audio_queue(dev, sectors, dev->audio_read_offset);
+                return 1;
             }
         }
+    }
 
-        // Point into the current sector within the staging buffer
-        dev->current_sector_samples = (sample_pair *)(dev->audio_sector_buffer
-                                      + dev->audio_staging_index * RAW_SECTOR_SIZE);
+    if (dev->seek_pos >= dev->cd_end) {
+        cdrom_log("CD-ROM %i: Playing completed (reached cd_end)\n", dev->id);
+        dev->cd_status = CD_STATUS_PLAYING_COMPLETED;
+        // While the rest of the FIFO plays out, get ready for the guest to
+        // carry on from here, usually with the next track
+        cdrom_audio_prefetch_at(dev, dev->cd_end, 0);
+        return -1;
+    }
 
-        uint32_t pairs_remaining = STEREO_SAMPLES_PER_SECTOR - dev->audio_sector_consumed_pairs;
-        uint32_t space_in_fifo = fifo_free_space(&dev->audio_fifo);
-        uint32_t pairs_to_transfer = (pairs_remaining < space_in_fifo) ?
-                                      pairs_remaining : space_in_fifo;
+    uint8_t *ring = (uint8_t *)dev->audio_ring;
+    uint32_t avail = dev->cd_end - dev->seek_pos;
+    uint32_t batch = (avail < AUDIO_SECTOR_BATCH) ? avail : AUDIO_SECTOR_BATCH;
+    uint32_t pos, fit;
+    int sectors_read;
 
-        bool added_ok = fifo_add_samples(&dev->audio_fifo,
-                                         &dev->current_sector_samples[dev->audio_sector_consumed_pairs],
-                                         pairs_to_transfer);
-        if (added_ok) {
-            dev->audio_sector_consumed_pairs += pairs_to_transfer;
-        } else {
-            DBG_PUTCHAR('n');
-            cdrom_log("CD-ROM %i: fifo_add_samples failed unexpectedly! Space was %u, tried to add %u.\n",
-                      dev->id, space_in_fifo, pairs_to_transfer);
-            ret = false;
-            break;
+    if (dev->audio_muted_soft) {
+        if (!(fit = cdrom_audio_ring_room(dev, 0, batch, &pos))) {
+            return 0;
+        }
+        if (msc_read_busy(ring + pos, fit * RAW_SECTOR_SIZE)) {
+            return 0;
         }
+        cdrom_log("CD-ROM %i: Muted. Faking batch read of %u sectors with silence.\n", dev->id, fit);
+        memset(ring + pos, 0, fit * RAW_SECTOR_SIZE);
+        sectors_read = fit;
+    } else {
+        if (!retry && cdrom_audio_read_async(dev, dev->seek_pos, batch) >= 0) {
+            return 0;
+        }
+        // A batch that timed out may still land where this one would go
+        if (!(fit = cdrom_audio_ring_room(dev, 0, batch, &pos)) ||
+            msc_read_busy(ring + pos, fit * RAW_SECTOR_SIZE)) {
+            return 0;
+        }
+        sectors_read = dev->ops->read_audio_sectors(dev, ring + pos, dev->seek_pos, fit);
     }
 
-    cdrom_log("CD-ROM %i: Audio cb. FIFO level: %u. Staging consumed: %d/%d. Ret %d\n",
-              dev->id, fifo_level(&dev->audio_fifo),
-              dev->audio_staging_index, dev->audio_staging_sectors, ret);
-    return ret;
+    if (sectors_read <= 0) {
+        cdrom_log("CD-ROM %i: Batch read at LBA %08X failed\n", dev->id, dev->seek_pos);
+        dev->cd_status = CD_STATUS_STOPPED;
+        return -1;
+    }
+    cdrom_audio_queue(dev, sectors_read, pos);
+    return 1;
+}
+
+audio_fifo_t* cdrom_audio_fifo_peek(cdrom_t *dev) {
+    return &dev->audio_fifo;
+}
+void cdrom_audio_fifo_init(cdrom_t *dev) {
+    fifo_init(&dev->audio_fifo);
+}
+
+bool cdrom_audio_callback(cdrom_t *dev) {
+    int filled;
+
+    if (dev->cd_status != CD_STATUS_PLAYING) {
+        cdrom_audio_prefetch(dev);
+        return false;
+    }
+
+    // --- Queue sectors until the ring is full. While a read is in flight,
+    // leave the FIFO to drain what it already has. ---
+    while ((filled = cdrom_audio_fill(dev)) > 0) {
+    }
+
+    cdrom_log("CD-ROM %i: Audio cb. FIFO level: %u sectors. Ret %d\n",
+              dev->id, fifo_level(&dev->audio_fifo), filled == 0);
+    return filled == 0;
 }
-#endif // USE_CD_AUDIO_FIFO
 
 uint32_t cdrom_audio_callback_simple(cdrom_t *dev, int16_t *buffer, uint32_t len, bool pad) {
     if (dev->cd_status != CD_STATUS_PLAYING) {
@@ -347,65 +560,18 @@ uint32_t cdrom_audio_callback_simple(cdrom_t *dev, int16_t *buffer, uint32_t len
 
     uint32_t pairs_produced = 0;
     uint32_t pairs_requested = len / 2;
-    // --- Fill buffer from staging buffer, batch-reading new sectors as needed ---
+    // --- Fill buffer from the FIFO, reading new sectors as needed ---
     while (pairs_produced < pairs_requested) {
-        // Advance to next sector in batch if current one is fully consumed
-        if (dev->audio_sector_consumed_pairs >= STEREO_SAMPLES_PER_SECTOR) {
-            dev->audio_staging_index++;
-            dev->audio_sector_consumed_pairs = 0;
-        }
-
-        // Read a new batch when the staging buffer is exhausted
-        if (dev->audio_staging_index >= dev->audio_staging_sectors) {
-            if (dev->seek_pos >= dev->cd_end) {
-                cdrom_log("CD-ROM %i: Playing completed (reached cd_end)\n", dev->id);
-                dev->cd_status = CD_STATUS_PLAYING_COMPLETED;
-                break;
-            }
-
-            uint32_t avail = dev->cd_end - dev->seek_pos;
-            uint32_t batch = (avail < AUDIO_SECTOR_BATCH) ? avail : AUDIO_SECTOR_BATCH;
-            int sectors_read;
-
-            if (dev->audio_muted_soft) {
-                cdrom_log("CD-ROM %i: Muted. Faking batch read of %u sectors with silence.\n", dev->id, batch);
-                memset(dev->audio_sector_buffer, 0, batch * RAW_SECTOR_SIZE);
-                sectors_read = batch;
-            } else {
-                sectors_read = dev->ops->read_audio_sectors(dev, dev->audio_sector_buffer, dev->seek_pos, batch);
-            }
-
-            if (sectors_read > 0) {
-                cdrom_log("CD-ROM %i: Batch read %u sectors at LBA %08X\n", dev->id, sectors_read, dev->seek_pos);
-                dev->seek_pos += sectors_read;
-                dev->audio_staging_sectors = sectors_read;
-                dev->audio_staging_index = 0;
-                dev->audio_sector_consumed_pairs = 0;
-            } else {
-                cdrom_log("CD-ROM %i: Batch read at LBA %08X failed\n", dev->id, dev->seek_pos);
-                dev->cd_status = CD_STATUS_STOPPED;
-                break;
-            }
-        }
-
-        // Point into the current sector within the staging buffer
-        dev->current_sector_samples = (sample_pair *)(dev->audio_sector_buffer
-                                      + dev->audio_staging_index * RAW_SECTOR_SIZE);
-
-        uint32_t pairs_remaining = STEREO_SAMPLES_PER_SECTOR - dev->audio_sector_consumed_pairs;
-        uint32_t space_in_buffer = pairs_requested - pairs_produced;
-        uint32_t pairs_to_transfer = (pairs_remaining < space_in_buffer) ?
-                                      pairs_remaining : space_in_buffer;
-
-        for (uint32_t i = 0; i < pairs_to_transfer; i++)
-        {
-            sample_pair sp = dev->current_sector_samples[dev->audio_sector_consumed_pairs + i];
-            buffer[(pairs_produced + i) * 2]     = (int16_t)scale_sample(sp.data16[0], cd_audio_volume, 0);
-            buffer[(pairs_produced + i) * 2 + 1] = (int16_t)scale_sample(sp.data16[1], cd_audio_volume, 0);
+        // Read a new batch when the FIFO is exhausted; pad with silence
+        // while the read is in flight
+        if (!fifo_level(&dev->audio_fifo) && cdrom_audio_fill(dev) <= 0) {
+            break;
         }
 
-        pairs_produced += pairs_to_transfer;
-        dev->audio_sector_consumed_pairs += pairs_to_transfer;
+        sample_pair sp = fifo_take_sample(&dev->audio_fifo);
+        buffer[pairs_produced * 2]     = (int16_t)scale_sample(sp.data16[0], cd_audio_volume, 0);
+        buffer[pairs_produced * 2 + 1] = (int16_t)scale_sample(sp.data16[1], cd_audio_volume, 0);
+        pairs_produced++;
     }
 
     uint32_t samples_produced = pairs_produced * 2;
@@ -421,29 +587,119 @@ uint32_t cdrom_audio_callback_simple(cdrom_t *dev, int16_t *buffer, uint32_t len
         return len;
     }
 }
+#endif // USE_CD_AUDIO_FIFO
+
+
+static void cdrom_readahead_done(void *ctx, bool ok) {
+    cdrom_readahead_t *ra = (cdrom_readahead_t *) ctx;
+    ra->state = ok ? CD_IO_DONE : CD_IO_FAILED;
+}
+
+static __inline bool cdrom_readahead_has(const cdrom_t *dev, const cdrom_readahead_t *ra, uint32_t lba) {
+    return ra->gen == dev->readahead_gen && (lba - ra->lba) < ra->count;
+}
+
+// Starts reading up to count sectors from lba into ra in the background, as
+// many as lie in one run of blocks on the USB drive and fit the chunk.
+// Returns false when they have to be read through FatFS.
+static bool cdrom_readahead_start(cdrom_t *dev, cdrom_readahead_t *ra, uint32_t lba, uint32_t count) {
+    uint32_t block, offset, stride;
+    if (!dev->ops->map_sectors) return false;
+    int n = dev->ops->map_sectors(dev, 0, lba, count, &block, &offset, &stride);
+    if (n <= 0 || offset + 2048 > CD_READAHEAD_SIZE) return false;
+    const uint32_t fit = (CD_READAHEAD_SIZE - offset - 2048) / stride + 1;
+    if ((uint32_t) n > fit) n = fit;
+
+    ra->lba = lba;
+    ra->count = n;
+    ra->stride = stride;
+    ra->offset = offset;
+    ra->gen = dev->readahead_gen;
+    ra->state = CD_IO_PENDING;
+    if (msc_read_async(block, (offset + (n - 1) * stride + 2048 + 511) / 512, ra->buf,
+                       cdrom_readahead_done, ra)) {
+        dev->seek_stats.seeks++;
+        return true;
+    }
+    ra->state = CD_IO_IDLE;
+    ra->count = 0;
+    return false;
+}
 
+static void cdrom_data_sector_done(cdrom_t *dev) {
+    dev->data_fifo.tail = (dev->data_fifo.tail + 2048) & 4095;
+    dev->req_cur++;
+    if(dev->req_cur == dev->req_total) {
+        cdrom_output_status(dev);
+        dev->req_total=0;
+    }
+}
 
 void __inline cdrom_read_data(cdrom_t *dev) {
     uint32_t pos;    
     /* uint16_t x; */
     /* uint8_t m,s,f;     */
-    /*
-    TODO, need to handle  when multiple blocks are requested.
-    */   
     if(dev->req_total) {
     /* while(dev->req_total) { */
         if(cdrom_fifo_level(&dev->data_fifo) >= 2048) return;//need to be empty.        
+        // Hold the sector back until the emulated drive would have read it
+        const uint32_t now = timer_hw->timerawl;
+        if (dev->speed && (int32_t) (now - dev->data_next_us) < 0) return;
         pos = MSFtoLBA(dev->req_m,dev->req_s,dev->req_f) - 150;    
         pos += dev->req_cur;
-        // Read CD sector directly from fatfs into data fifo - note this assumes
-        // 2048 byte sectors
-        dev->ops->read_sector(dev, CD_READ_DATA, dev->data_fifo.data + dev->data_fifo.tail, pos);
-        dev->data_fifo.tail = (dev->data_fifo.tail + 2048) & 4095;
-        dev->req_cur++;
-        if(dev->req_cur == dev->req_total) {
-            cdrom_output_status(dev);
-            dev->req_total=0;
+        uint8_t *dest = dev->data_fifo.data + dev->data_fifo.tail;
+        const uint32_t remaining = dev->req_total - dev->req_cur;
+        // The guest reads on from where it left off, so keep a chunk ahead
+        // of it even past the end of this request
+        const bool streaming = (pos == dev->data_last_lba + 1);
+
+        // Sectors are read from the USB drive a chunk at a time into one of
+        // two read-ahead buffers, and the chunk after it goes into the other
+        // one while the guest takes this one
+        cdrom_readahead_t *ra = NULL;
+        for (int i = 0; i < 2; i++) {
+            if (cdrom_readahead_has(dev, &dev->readahead[i], pos)) {
+                ra = &dev->readahead[i];
+                break;
+            }
         }
+        if (ra == NULL) {
+            cdrom_readahead_t *spare = &dev->readahead[dev->readahead[0].state == CD_IO_PENDING];
+            if (spare->state == CD_IO_PENDING) return;
+            if (cdrom_readahead_start(dev, spare, pos, streaming ? CD_READAHEAD_SIZE / 2048 : remaining)) return;
+        } else if (ra->state == CD_IO_PENDING) {
+            return;
+        }
+
+        if (ra && ra->state == CD_IO_DONE) {
+            memcpy(dest, ra->buf + ra->offset + (pos - ra->lba) * ra->stride, 2048);
+        } else {
+            // Not mapped, or the chunk failed: read CD sector directly from
+            // fatfs into data fifo - note this assumes 2048 byte sectors
+            if (ra) {
+                ra->state = CD_IO_IDLE;
+                ra->count = 0;
+                ra = NULL;
+            }
+            dev->ops->read_sector(dev, CD_READ_DATA, dest, pos);
+        }
+        dev->data_last_lba = pos;
+        if (dev->speed) {
+            const uint32_t period = 1000000 / (75 * dev->speed);
+            // Time the guest spent not reading is not banked beyond one sector
+            if ((int32_t) (now - dev->data_next_us) > (int32_t) period) dev->data_next_us = now;
+            dev->data_next_us += period;
+        }
+
+        if (ra) {
+            const uint32_t next = ra->lba + ra->count;
+            cdrom_readahead_t *other = &dev->readahead[ra == &dev->readahead[0]];
+            if ((streaming || pos + remaining > next) && other->state != CD_IO_PENDING &&
+                !cdrom_readahead_has(dev, other, next)) {
+                cdrom_readahead_start(dev, other, next, CD_READAHEAD_SIZE / 2048);
+            }
+        }
+        cdrom_data_sector_done(dev);
     }
 }
 
@@ -513,12 +769,11 @@ uint8_t cdrom_audio_playmsf(cdrom_t *dev, int m,int s, int f, int M, int S, int
 
     dev->seek_pos  = pos;
     dev->cd_end    = pos2;
-    dev->audio_staging_sectors = 0;
-    dev->audio_staging_index = 0;
-    dev->audio_sector_consumed_pairs = 0;
 #if USE_CD_AUDIO_FIFO
     fifo_reset(&dev->audio_fifo);
 #endif
+    dev->audio_play_us = timer_hw->timerawl;
+    dev->audio_start_pending = 1;
     /* Memory barrier: ensure seek_pos, cd_end, and fifo_reset are all
      * visible to core 1 before cd_status is set to PLAYING.  Without this,
      * the Cortex-M0+ compiler or hardware could reorder the store to
@@ -540,24 +795,39 @@ cdrom_audio_pause_resume(cdrom_t *dev, uint8_t resume)
          * Flushing on resume discards already-decoded audio and forces a
          * re-fill from scratch, causing a brief gap at the start of resumed
          * playback. */
-        if (!resume)
+        if (!resume) {
             fifo_reset(&dev->audio_fifo);
+            cdrom_audio_prefetch_at(dev, dev->seek_pos, 0);
+        }
 #endif
     }
 }
 
 
+/* Microseconds from the last play command to its first sector being ready to
+   play, UINT32_MAX before the first one */
+uint32_t cdrom_audio_start_latency(cdrom_t *dev) {
+    return dev->audio_start_latency_us;
+}
+
+/* Time core 1 spent decoding compressed audio tracks since the image was
+   loaded, the longest step of it and the sectors it decoded */
+void cdrom_audio_decode_stats(cdrom_t *dev, uint32_t *us, uint32_t *max_us, uint32_t *sectors) {
+    *us = dev->audio_decode_us;
+    *max_us = dev->audio_decode_max_us;
+    *sectors = dev->audio_decode_sectors;
+}
+
 uint8_t cdrom_get_subq(cdrom_t *dev,uint8_t *b) {    
     subchannel_t subc;
     /* seek_pos points to the next sector to be READ, not the one currently
-     * audible.  Subtract the number of sectors already buffered in the FIFO
+     * audible.  Subtract the number of sectors already queued in the FIFO
      * so the reported position matches what the listener actually hears.
-     * Each sector holds STEREO_SAMPLES_PER_SECTOR stereo pairs.
      * Guard against underflow when the FIFO is empty or seek_pos is at the
      * start of the track. */
 #if USE_CD_AUDIO_FIFO
     {
-        uint32_t buffered_sectors = fifo_level(&dev->audio_fifo) / STEREO_SAMPLES_PER_SECTOR;
+        uint32_t buffered_sectors = fifo_level(&dev->audio_fifo);
         uint32_t report_pos = (buffered_sectors < dev->seek_pos) ?
                               (dev->seek_pos - buffered_sectors) : 0;
         dev->ops->get_subchannel(dev, report_pos, &subc);
@@ -589,6 +859,11 @@ uint8_t cdrom_read_toc(cdrom_t *dev, unsigned char *b, uint8_t track) {
     else if (track > last_track)
         return 0;
     dev->ops->get_track_info(dev, track, 0, &ti);
+    // The guest may be about to play this track. Drivers ask about every
+    // track in turn, so only go by the last one asked about.
+    if (track <= last_track && dev->cd_status != CD_STATUS_PLAYING) {
+        cdrom_audio_prefetch_at(dev, MSFtoLBA(ti.m, ti.s, ti.f) - 150, AUDIO_PREFETCH_SETTLE_US);
+    }
     b[0]=0x0;
     b[1]=ti.attr;
     b[2]=ti.number;
@@ -638,7 +913,8 @@ cdrom_global_init(void)
     /* Clear the global data. */
     memset(&cdrom, 0x00, sizeof(cdrom));
     cdrom.error_str = cdrom_errorstr_get();
-    cdrom.current_sector_samples = (sample_pair*)cdrom.audio_sector_buffer;
+    cdrom.audio_prefetch_lba = AUDIO_PREFETCH_NONE;
+    cdrom.audio_start_latency_us = UINT32_MAX;
     set_volume(CMD_CDVOL);
 }
 
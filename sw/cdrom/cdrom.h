@@ -61,6 +61,34 @@
  * overhead (one SCSI READ10 instead of N) hopefully helping marginal USB drives
  * keep up with 44.1 kHz audio. */
 #define AUDIO_SECTOR_BATCH  4
+/* Smaller batches are only read once the audio FIFO is down to this many
+ * sectors, so a nearly full ring doesn't turn into many small reads. */
+#define AUDIO_RING_LOW      3
+/* Audio batches are read straight from the USB drive in whole 512-byte
+ * blocks into a ring that the audio FIFO's sector slots point into. The
+ * ring has room for a batch starting anywhere in a block on top of the
+ * sectors still playing while it is read. */
+#ifndef AUDIO_RING_SIZE
+#define AUDIO_RING_SIZE     ((((AUDIO_SECTOR_BATCH + AUDIO_RING_LOW) * RAW_SECTOR_SIZE + 511) / 512 + 1) * 512)
+#endif
+/* The first audio batch where the guest is likely to play from next is read
+ * while the drive is idle. Guesses from TOC queries wait this long for the
+ * guest to stop asking about other tracks. */
+#define AUDIO_PREFETCH_NONE       0xFFFFFFFF
+#define AUDIO_PREFETCH_SETTLE_US  20000
+
+/* State of an asynchronous read from the USB drive */
+#define CD_IO_IDLE          0
+#define CD_IO_PENDING       1
+#define CD_IO_DONE          2
+#define CD_IO_FAILED        3
+
+/* Data sectors are read ahead from the USB drive in chunks of whole 512-byte
+ * blocks; two chunks ping-pong so one is read while the other is served. The
+ * default holds four cooked or three raw sectors. */
+#ifndef CD_READAHEAD_SIZE
+#define CD_READAHEAD_SIZE   (8192 + 512)
+#endif
 
 #define STAT_READY	    0x01
 #define STAT_PLAY  	    0x08
@@ -129,6 +157,8 @@ typedef struct cdrom_ops_t {
     int (*sector_size)(struct cdrom *dev, uint32_t lba);
     int (*read_sector)(struct cdrom *dev, int type, uint8_t *b, uint32_t lba);
     int (*read_audio_sectors)(struct cdrom *dev, uint8_t *b, uint32_t lba, uint32_t count);
+    int (*map_sectors)(struct cdrom *dev, int raw, uint32_t lba, uint32_t count, uint32_t *block, uint32_t *offset, uint32_t *stride);
+    int (*read_audio_async)(struct cdrom *dev, uint8_t *b, uint32_t lba, uint32_t count, uint32_t *done);
     int (*track_type)(struct cdrom *dev, uint32_t lba);
     void (*exit)(struct cdrom *dev);
 } cdrom_ops_t;
@@ -141,6 +171,25 @@ typedef struct cdrom_fifo_t {
     volatile uint16_t tail;
 } cdrom_fifo_t;
 
+typedef struct cdrom_readahead_t {
+    uint8_t buf[CD_READAHEAD_SIZE];
+    uint32_t lba;                          // First sector in the chunk
+    uint32_t gen;                          // cdrom_t readahead_gen it was read for
+    uint16_t count;                        // Sectors in the chunk
+    uint16_t stride;                       // Bytes from one sector to the next
+    uint16_t offset;                       // Where the first sector's user data starts
+    volatile uint8_t state;                // CD_IO_*
+} cdrom_readahead_t;
+
+/* How the loaded image's files lie on the USB drive and what seeking in them
+   has cost. Core 1 updates these as it opens and reads the image; they live
+   in cdrom_t rather than the image so core 0 can read them at any time. */
+typedef struct cdrom_seek_stats {
+    volatile uint32_t fragments;           // Runs of clusters the image's files are stored in
+    volatile uint32_t seeks;               // Reads started at a position in a file, through FatFS or mapped
+    volatile uint32_t seek_reads;          // FAT reads FatFS needed to find those positions
+} cdrom_seek_stats_t;
+
 
 #include "audio/audio_fifo.h"
 
@@ -164,7 +213,7 @@ typedef struct cdrom {
 
     uint8_t cd_status; /* Struct variable reserved for
                           media status. */
-    uint8_t speed;
+    uint8_t speed;                         /* Emulated data rate in multiples of 150 KB/s, 0 for unlimited */
     uint8_t cur_speed;
 
 
@@ -173,7 +222,6 @@ typedef struct cdrom {
     int   is_dir;
     void *priv;
 
-    char **image_list;
     int image_count;
     char image_path[128];
 
@@ -202,11 +250,30 @@ typedef struct cdrom {
     const char *error_str;
 
     // int16_t cd_buffer[BUF_SIZE];
-    uint8_t audio_sector_buffer[AUDIO_SECTOR_BATCH * RAW_SECTOR_SIZE];
-    sample_pair *current_sector_samples;   // Points to current sector's audio data within staging buffer
-    int audio_sector_consumed_pairs;       // Stereo pairs consumed from current sector (0..588)
-    int audio_staging_sectors;             // Number of sectors loaded in staging buffer
-    int audio_staging_index;               // Which sector in the batch is being consumed
+    sample_pair audio_ring[AUDIO_RING_SIZE / sizeof(sample_pair)]; // Sectors the audio FIFO plays from
+    uint32_t audio_ring_head;              // Byte offset just past the newest sector in the ring
+
+    // Reads in flight on the USB drive, see cdrom_audio_callback() and cdrom_read_data()
+    volatile uint8_t audio_read_state;     // CD_IO_*
+    uint8_t audio_read_count;              // Sectors being read into the ring
+    uint32_t audio_read_lba;
+    uint32_t audio_read_offset;            // Byte offset in the ring of the first sector's samples
+    uint32_t audio_read_gen;               // readahead_gen it was read for
+    uint8_t audio_read_decode;             // It's being decoded, see cdrom_audio_decode()
+    uint32_t audio_read_done;              // Bytes of it decoded so far
+    volatile uint32_t audio_decode_us;     // Time core 1 spent decoding audio tracks
+    volatile uint32_t audio_decode_max_us; // Longest of the steps it took
+    volatile uint32_t audio_decode_sectors; // Sectors decoded in that time
+    volatile uint32_t audio_prefetch_lba;  // Where play is expected to start, AUDIO_PREFETCH_NONE if unknown
+    volatile uint32_t audio_prefetch_us;   // When to start reading it
+    volatile uint32_t audio_play_us;       // When the last play command came in
+    volatile uint8_t audio_start_pending;  // Until that play's first sector is queued
+    uint32_t audio_start_latency_us;       // From the last play command to its first sector queued, UINT32_MAX before any
+    cdrom_readahead_t readahead[2];        // See cdrom_read_data()
+    uint32_t readahead_gen;                // Bumped when the image changes
+    uint32_t data_last_lba;                // Last data sector sent to the guest
+    uint32_t data_next_us;                 // When the next sector may go out at the emulated speed
+    cdrom_seek_stats_t seek_stats;
 
 #if USE_CD_AUDIO_FIFO
     audio_fifo_t audio_fifo;
@@ -241,7 +308,7 @@ extern int     cdrom_lba_to_msf_accurate(int lba);
 extern double  cdrom_seek_time(cdrom_t *dev);
 extern void    cdrom_stop(cdrom_t *dev);
 extern int     cdrom_is_pre(cdrom_t *dev, uint32_t lba);
-extern bool    cdrom_audio_callback(cdrom_t *dev, uint32_t len);
+extern bool    cdrom_audio_callback(cdrom_t *dev);
 extern uint32_t cdrom_audio_callback_simple(cdrom_t *dev, int16_t *buffer, uint32_t len, bool pad);
 
 extern uint8_t cdrom_audio_track_search(cdrom_t *dev, uint32_t pos, int type, uint8_t playbit);
@@ -257,6 +324,8 @@ extern uint8_t  cdrom_disc_capacity(cdrom_t *dev,unsigned char *b);
 extern uint8_t cdrom_seek(cdrom_t *dev, int m, int s, int f);
 extern uint8_t cdrom_audio_playmsf(cdrom_t *dev, int m,int s, int f, int M, int S, int F);
 extern uint8_t cdrom_get_subq(cdrom_t *dev,uint8_t *b);
+extern uint32_t cdrom_audio_start_latency(cdrom_t *dev);
+extern void cdrom_audio_decode_stats(cdrom_t *dev, uint32_t *us, uint32_t *max_us, uint32_t *sectors);
 
 extern void cdrom_close_handler(uint8_t id);
 extern void cdrom_insert(uint8_t id);
@@ -265,6 +334,7 @@ extern void cdrom_reload(uint8_t id);
 
 extern int  cdrom_image_open(cdrom_t *dev, const char *fn);
 extern void cdrom_image_close(cdrom_t *dev);
+extern void cdrom_image_seek_stats(cdrom_t *dev, uint32_t *fragments, uint32_t *seeks, uint32_t *seek_reads);
 extern void cdrom_image_reset(cdrom_t *dev);
 
 extern void cdrom_ioctl_eject(void);
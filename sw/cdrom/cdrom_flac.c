@@ -0,0 +1,1188 @@
+#include "cdrom_flac.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/pg_debug.h"
+#include "msc_app.h"
+
+#define PGDEBUG_CDROM_FLAC 0
+#define flac_log(fmt, ...) do { if (PGDEBUG_CDROM_FLAC) DBG_PRINTF(fmt "\n", ##__VA_ARGS__); } while(0)
+
+// Longest LPC predictor, so the most history a subframe needs
+#define FLAC_HISTORY       32
+// The second channel of a frame is decoded this many samples at a time
+#define FLAC_CHUNK         256
+// Compressed data is read from the file up to this much at a time
+#define FLAC_INBUF         2048
+// Bytes kept from the previous read, so the bit reader can hand back what
+// it has cached when a frame ends
+#define FLAC_KEEP          4
+
+// Seek table: at most this many entries per file, taken from the file's
+// SEEKTABLE or else found by looking for frames this far apart
+#define FLAC_SEEK_POINTS   128
+#define FLAC_PROBE_SPACING (1024 * 1024)
+// How far on from a probe a frame is looked for
+#define FLAC_SCAN_LIMIT    (64 * 1024)
+// Seeks stop probing once the sample is this close and decode up to it
+#define FLAC_SEEK_LINEAR   (4 * 1024)
+// Longest unary part of a Rice code taken as valid
+#define FLAC_MAX_QUOTIENT  (1u << 24)
+// Most a seek probe and a frame read from the drive at a time in the
+// background
+#define FLAC_PROBE_READ    2048
+#define FLAC_DECODE_READ   4096
+
+// Background reads of the window, see flac_read_async()
+#define FLAC_IO_IDLE       0
+#define FLAC_IO_PENDING    1
+#define FLAC_IO_DONE       2
+#define FLAC_IO_FAILED     3
+
+// Seek in progress, see flac_seek_step()
+typedef struct flac_seek_t {
+    int state;              // FLAC_SEEK_*
+    uint32_t sample;        // Sample sought
+    uint32_t lo, lo_s;      // Frame at or before it, and its first sample
+    uint32_t hi, hi_s;      // Offset past it, and a sample past it
+    uint32_t mid;           // Where the probe in progress started
+    uint32_t probe;         // and where it looks on from
+    uint32_t probe_end;
+    int probing;
+    int bisect;
+} flac_seek_t;
+
+#define FLAC_SEEK_NONE     0
+#define FLAC_SEEK_PROBING  1 // Narrowing down the frame
+#define FLAC_SEEK_FORWARD  2 // Decoding on from lo to the sample
+
+typedef struct flac_dec_t {
+    flac_t *owner;          // Stream the input and the decoded frame are from
+    int users;              // Open streams sharing the decoder
+    // Decoded frame: the first channel is decoded here, then each sample is
+    // replaced by the 16-bit stereo pair once the second channel is known
+    int32_t *pcm;
+    uint32_t pcm_size;
+    uint32_t first;         // First sample of the decoded frame
+    uint32_t count;         // Samples in it, 0 when there is none
+    int32_t win[FLAC_HISTORY + FLAC_CHUNK];
+    // Bit reader: the next bits are cached left aligned in cache
+    uint32_t cache;
+    int bits;
+    uint32_t over;          // Zero bytes fed in past the end of the input
+    // Input: in, read through FatFS, or the window flac_read_async() reads
+    // from the drive
+    uint8_t *buf;
+    uint32_t in_off;        // File offset of buf[0]
+    uint32_t in_pos;
+    uint32_t in_len;
+    int async;              // buf is the window
+    int starved;            // The window ran out and a read for more is on its way
+    int too_big;            // A frame doesn't fit the window
+    uint32_t mark;          // File offset of the first byte the step needs
+    uint32_t fetch;         // Most to read into the window at a time
+    flac_seek_t seek;
+    uint8_t in[FLAC_KEEP + FLAC_INBUF];
+} flac_dec_t;
+
+// Subframe being decoded, see flac_subframe()
+typedef struct flac_sub_t {
+    int32_t *out;
+    uint32_t cap;           // Room in out
+    uint32_t at;            // Where the next sample goes in out
+    uint32_t from;          // First sample in out not passed on yet
+    uint32_t merged;        // Samples of the frame passed on so far
+    int wasted;             // Wasted bits per sample
+    int chan;               // Channel assignment, -1 for the first channel
+} flac_sub_t;
+
+// Only one track plays at a time, so all the FLAC files of a cue sheet
+// share one decoder and its buffers
+static flac_dec_t *dec;
+
+// Window flac_read_async() reads compressed data into from the drive, and
+// the read in flight. A read can land after the decoder is gone, so they
+// live apart from it, and the window is only freed once nothing can write
+// to it.
+static uint8_t *flac_win;
+static uint32_t flac_win_size;
+static volatile uint8_t flac_io;
+static const flac_t *flac_io_owner;
+static uint32_t flac_io_off;    // File offset the read starts at
+static uint32_t flac_io_len;    // Bytes of the file it brings
+
+static int
+flac_read_at(FIL *fp, uint32_t off, uint8_t *buf, uint32_t len)
+{
+    UINT got;
+
+    return f_lseek(fp, off) == FR_OK && f_read(fp, buf, len, &got) == FR_OK && got == len;
+}
+
+static uint32_t
+flac_be32(const uint8_t *p)
+{
+    return (uint32_t) p[0] << 24 | (uint32_t) p[1] << 16 | (uint32_t) p[2] << 8 | p[3];
+}
+
+/* Input */
+
+static void
+flac_fetch_done(void *ctx, bool ok)
+{
+    (void) ctx;
+    flac_io = ok ? FLAC_IO_DONE : FLAC_IO_FAILED;
+}
+
+// Starts reading what follows the window from the drive, and fails the step
+// that needed it: the step is made again once the read has landed. An empty
+// window is read from the start of the sector, as reads are of whole blocks,
+// so the window stays on a sector boundary of the file. Room is made by
+// dropping what lies before the mark.
+static int
+flac_fetch(flac_dec_t *d)
+{
+    const flac_t *fl = d->owner;
+    uint32_t      at = d->in_off + d->in_len;
+    uint32_t      room, len, block;
+
+    if (d->in_len == 0)
+        at -= at % FF_MAX_SS;
+
+    // Past the end of the file come zeros, as through FatFS
+    if (at >= fl->file_size)
+        return 0;
+    d->starved = 1;
+    if (flac_io != FLAC_IO_IDLE)
+        return 0;
+
+    if (flac_win_size - d->in_len < d->fetch && d->mark - d->in_off >= FF_MAX_SS) {
+        uint32_t drop = (d->mark - d->in_off) & ~(uint32_t) (FF_MAX_SS - 1);
+        memmove(d->buf, d->buf + drop, d->in_len - drop);
+        d->in_off += drop;
+        d->in_pos -= drop;
+        d->in_len -= drop;
+    }
+    room = (flac_win_size - d->in_len) & ~(uint32_t) (FF_MAX_SS - 1);
+    if (room == 0) {
+        d->too_big = 1;
+        return 0;
+    }
+    if (room > d->fetch)
+        room = d->fetch;
+    len = fl->map(fl->map_priv, at, room, &block);
+    if (len == 0) {
+        flac_io = FLAC_IO_FAILED;
+        return 0;
+    }
+    flac_io_owner = fl;
+    flac_io_off   = at;
+    flac_io_len   = len;
+    flac_io       = FLAC_IO_PENDING;
+    if (!msc_read_async(block, (uint16_t) ((len + FF_MAX_SS - 1) / FF_MAX_SS), d->buf + d->in_len,
+                        flac_fetch_done, NULL))
+        flac_io = FLAC_IO_FAILED;
+    return 0;
+}
+
+// Appends to the input as much as fits, ending on a sector boundary so
+// FatFS reads whole sectors straight into the buffer
+static int
+flac_load(flac_dec_t *d)
+{
+    FIL     *fp   = d->owner->fp;
+    uint32_t at   = d->in_off + d->in_len;
+    uint32_t want = sizeof(d->in) - d->in_len;
+    UINT     got;
+
+    // Starting afresh in the middle of a sector, read all of it: FatFS would
+    // otherwise read it once for the start and again for the rest
+    if (d->in_len == 0 && d->in_pos == 0 && at % FF_MAX_SS) {
+        d->in_pos = at % FF_MAX_SS;
+        d->in_off -= d->in_pos;
+        at -= d->in_pos;
+    }
+    if (want > FF_MAX_SS)
+        want -= (at + want) % FF_MAX_SS;
+    if (f_tell(fp) != at && f_lseek(fp, at) != FR_OK)
+        return 0;
+    if (f_read(fp, d->in + d->in_len, want, &got) != FR_OK)
+        return 0;
+    d->in_len += got;
+    return got != 0;
+}
+
+static int
+flac_refill(flac_dec_t *d)
+{
+    if (d->async)
+        return flac_fetch(d);
+
+    uint32_t keep = d->in_len < FLAC_KEEP ? d->in_len : FLAC_KEEP;
+
+    memmove(d->in, d->in + d->in_len - keep, keep);
+    d->in_off += d->in_len - keep;
+    d->in_pos = d->in_len = keep;
+    return flac_load(d);
+}
+
+// Makes n bytes available from in_pos on, as far as the file has them.
+// Only used on byte boundaries with nothing cached. Returns how many are.
+static uint32_t
+flac_ensure(flac_dec_t *d, uint32_t n)
+{
+    uint32_t avail = d->in_len - d->in_pos;
+
+    if (avail < n && d->async) {
+        flac_fetch(d);
+    } else if (avail < n) {
+        memmove(d->in, d->in + d->in_pos, avail);
+        d->in_off += d->in_pos;
+        d->in_pos = 0;
+        d->in_len = avail;
+        flac_load(d);
+    }
+    return d->in_len - d->in_pos;
+}
+
+// Byte offset in the file of the next bit, on byte boundaries
+static uint32_t
+flac_tell(const flac_dec_t *d)
+{
+    return d->in_off + d->in_pos + d->over - d->bits / 8;
+}
+
+// Moves the input of the decoder to offset off of fl, keeping what was
+// read already if it's there
+static void
+flac_goto(flac_t *fl, uint32_t off)
+{
+    flac_dec_t *d = dec;
+
+    d->cache = 0;
+    d->bits  = 0;
+    d->over  = 0;
+    d->mark  = off;
+    if (d->owner == fl && off >= d->in_off && off <= d->in_off + d->in_len) {
+        d->in_pos = off - d->in_off;
+        return;
+    }
+    if (d->owner != fl) {
+        d->owner = fl;
+        d->count = 0;
+    }
+    d->in_off = off;
+    d->in_pos = d->in_len = 0;
+}
+
+// Switches the input between in and the window, dropping what was read
+static void
+flac_set_async(flac_dec_t *d, int async)
+{
+    if (d->async == async)
+        return;
+    d->async      = async;
+    d->buf        = async ? flac_win : d->in;
+    d->in_off     = 0;
+    d->in_pos     = 0;
+    d->in_len     = 0;
+    d->starved    = 0;
+    d->too_big    = 0;
+    d->seek.state = FLAC_SEEK_NONE;
+    // What a read in flight brings is of no use now
+    flac_io_owner = NULL;
+}
+
+static inline void
+flac_fill_bits(flac_dec_t *d, uint32_t *cache, int *bits)
+{
+    while (*bits <= 24) {
+        if (d->in_pos == d->in_len && !flac_refill(d)) {
+            // Past the end, or of the window: zeros, which fail the frame
+            // if it gets to them
+            d->over++;
+        } else
+            *cache |= (uint32_t) d->buf[d->in_pos++] << (24 - *bits);
+        *bits += 8;
+    }
+}
+
+static uint32_t
+flac_bits(flac_dec_t *d, int n)
+{
+    uint32_t v = 0;
+
+    if (n > 24) {
+        v = flac_bits(d, n - 16) << 16;
+        n = 16;
+    }
+    if (n == 0)
+        return v;
+    flac_fill_bits(d, &d->cache, &d->bits);
+    v |= d->cache >> (32 - n);
+    d->cache <<= n;
+    d->bits -= n;
+    return v;
+}
+
+static int32_t
+flac_sbits(flac_dec_t *d, int n)
+{
+    if (n == 0)
+        return 0;
+    return (int32_t) (flac_bits(d, n) << (32 - n)) >> (32 - n);
+}
+
+// Reads n Rice coded residuals with parameter k (at most 24)
+static int
+flac_rice(flac_dec_t *d, int32_t *res, uint32_t n, int k)
+{
+    uint32_t cache = d->cache;
+    int      bits  = d->bits;
+
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t q = 0;
+
+        flac_fill_bits(d, &cache, &bits);
+        while (cache == 0) {
+            q += bits;
+            bits = 0;
+            if (q > FLAC_MAX_QUOTIENT || d->over > 4)
+                return 0;
+            flac_fill_bits(d, &cache, &bits);
+        }
+        int z = __builtin_clz(cache);
+        q += z;
+        cache = cache << z << 1;
+        bits -= z + 1;
+        if (k) {
+            flac_fill_bits(d, &cache, &bits);
+            q = (q << k) | (cache >> (32 - k));
+            cache <<= k;
+            bits -= k;
+        }
+        res[i] = (int32_t) (q >> 1) ^ -(int32_t) (q & 1);
+    }
+    d->cache = cache;
+    d->bits  = bits;
+    return 1;
+}
+
+/* Frames */
+
+static uint8_t
+flac_crc8(const uint8_t *p, uint32_t n)
+{
+    uint8_t crc = 0;
+
+    while (n--) {
+        crc ^= *p++;
+        for (int i = 0; i < 8; i++)
+            crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+    }
+    return crc;
+}
+
+// Checks p holds the header of a frame of fl. Returns its length and sets
+// the frame's first sample, length and channel assignment, or returns 0.
+static uint32_t
+flac_header(const flac_t *fl, const uint8_t *p, uint32_t avail, uint32_t *first, uint32_t *n, int *chan)
+{
+    uint32_t len = 5, block;
+    uint64_t num;
+    int      extra = 0;
+
+    if (avail < 6 || p[0] != 0xFF || (p[1] & 0xFE) != 0xF8 || (p[3] & 1))
+        return 0;
+
+    int bs = p[2] >> 4, sr = p[2] & 15, ch = p[3] >> 4, ss = (p[3] >> 1) & 7;
+    // Only what CD audio can be: stereo, 16 bits, 44.1 kHz
+    if (bs == 0 || (ch != 1 && (ch < 8 || ch > 10)) || (ss != 0 && ss != 4)
+        || (sr != 0 && sr != 9 && sr != 13 && sr != 14))
+        return 0;
+
+    // Frame number, or sample number for variable block sizes, UTF-8 coded
+    num = p[4];
+    if (num >= 0x80) {
+        if (num < 0xC0 || num == 0xFF)
+            return 0;
+        while (num & (0x80 >> (extra + 1)))
+            extra++;
+        num &= 0x3F >> extra;
+        while (extra--) {
+            if (len >= avail || (p[len] & 0xC0) != 0x80)
+                return 0;
+            num = num << 6 | (p[len++] & 0x3F);
+        }
+    }
+
+    if (bs == 1)
+        block = 192;
+    else if (bs <= 5)
+        block = 576 << (bs - 2);
+    else if (bs == 6 || bs == 7) {
+        if (len + bs - 5 > avail)
+            return 0;
+        block = (bs == 6 ? p[len] : (p[len] << 8 | p[len + 1])) + 1;
+        len += bs - 5;
+    } else
+        block = 256 << (bs - 8);
+
+    if (sr == 13 || sr == 14) {
+        if (len + 2 > avail || (p[len] << 8 | p[len + 1]) != (sr == 13 ? 44100 : 4410))
+            return 0;
+        len += 2;
+    }
+
+    if (len >= avail || flac_crc8(p, len) != p[len])
+        return 0;
+
+    if (!(p[1] & 1))
+        num *= fl->max_block;
+    if (block > fl->max_block || num >= fl->total_samples)
+        return 0;
+
+    *first = (uint32_t) num;
+    *n     = block;
+    *chan  = ch;
+    return len + 1;
+}
+
+// Passes on the samples of the subframe decoded since the last time: the
+// first channel only loses its wasted bits, the second one is merged into
+// the first as stereo pairs and slid back to make room, keeping the history
+// the predictor needs
+static void
+flac_flush(flac_dec_t *d, flac_sub_t *s)
+{
+    uint32_t *b   = (uint32_t *) s->out + s->from;
+    uint32_t *pcm = (uint32_t *) d->pcm + s->merged;
+    uint32_t  n   = s->at - s->from;
+    int       w   = s->wasted;
+
+    if (s->chan < 0) {
+        if (w)
+            for (uint32_t i = 0; i < n; i++)
+                b[i] <<= w;
+        s->from = s->at;
+        return;
+    }
+
+    // Only the low 16 bits of each channel are kept, so unsigned arithmetic
+    // gives the same pairs
+    switch (s->chan) {
+        case 8: /* left/side */
+            for (uint32_t i = 0; i < n; i++) {
+                uint32_t l = pcm[i], c = b[i] << w;
+                pcm[i] = (l & 0xFFFF) | (l - c) << 16;
+            }
+            break;
+        case 9: /* right/side */
+            for (uint32_t i = 0; i < n; i++) {
+                uint32_t c = b[i] << w;
+                pcm[i] = ((pcm[i] + c) & 0xFFFF) | c << 16;
+            }
+            break;
+        case 10: /* mid/side */
+            for (uint32_t i = 0; i < n; i++) {
+                uint32_t c = b[i] << w;
+                uint32_t m = pcm[i] << 1 | (c & 1);
+                pcm[i] = (((m + c) >> 1) & 0xFFFF) | ((m - c) >> 1) << 16;
+            }
+            break;
+        default: /* left, right */
+            for (uint32_t i = 0; i < n; i++)
+                pcm[i] = (pcm[i] & 0xFFFF) | (b[i] << w) << 16;
+            break;
+    }
+    s->merged += n;
+    if (s->at == s->cap) {
+        memmove(s->out, s->out + s->at - FLAC_HISTORY, FLAC_HISTORY * sizeof(int32_t));
+        s->at = FLAC_HISTORY;
+    }
+    s->from = s->at;
+}
+
+// How many of the left samples fit in out, passing on what's there if full
+static uint32_t
+flac_room(flac_dec_t *d, flac_sub_t *s, uint32_t left)
+{
+    if (s->at == s->cap)
+        flac_flush(d, s);
+    return (left < s->cap - s->at) ? left : s->cap - s->at;
+}
+
+// The predictors work in unsigned arithmetic so corrupt data can only
+// produce wrong samples
+
+static void
+flac_fixed(int32_t *s, int n, int order)
+{
+    uint32_t *u = (uint32_t *) s;
+
+    switch (order) {
+        case 1:
+            for (int i = 0; i < n; i++)
+                u[i] += u[i - 1];
+            break;
+        case 2:
+            for (int i = 0; i < n; i++)
+                u[i] += 2 * u[i - 1] - u[i - 2];
+            break;
+        case 3:
+            for (int i = 0; i < n; i++)
+                u[i] += 3 * (u[i - 1] - u[i - 2]) + u[i - 3];
+            break;
+        case 4:
+            for (int i = 0; i < n; i++)
+                u[i] += 4 * (u[i - 1] + u[i - 3]) - 6 * u[i - 2] - u[i - 4];
+            break;
+    }
+}
+
+static void
+flac_lpc(int32_t *s, uint32_t n, const int32_t *coef, int order, int shift)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        const int32_t *h   = s + i;
+        uint32_t       sum = 0;
+        for (int j = 0; j < order; j++)
+            sum += (uint32_t) coef[j] * (uint32_t) h[-1 - j];
+        s[i] = (int32_t) ((uint32_t) s[i] + (uint32_t) ((int32_t) sum >> shift));
+    }
+}
+
+// For predictors whose sums may not fit in 32 bits
+static void
+flac_lpc_wide(int32_t *s, uint32_t n, const int32_t *coef, int order, int shift)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        const int32_t *h   = s + i;
+        int64_t        sum = 0;
+        for (int j = 0; j < order; j++)
+            sum += (int64_t) coef[j] * h[-1 - j];
+        s[i] = (int32_t) ((uint32_t) s[i] + (uint32_t) (sum >> shift));
+    }
+}
+
+// Reads the residual of a predicted subframe and adds the prediction to it.
+// coef is NULL for the fixed predictors.
+static int
+flac_residual(flac_dec_t *d, flac_sub_t *s, uint32_t n, int order, const int32_t *coef, int shift, int wide)
+{
+    int      method = flac_bits(d, 2);
+    int      pbits  = method ? 5 : 4;
+    int      porder = flac_bits(d, 4);
+    uint32_t psize  = n >> porder;
+
+    if (method > 1 || (psize << porder) != n || psize < (uint32_t) order)
+        return 0;
+
+    for (uint32_t p = 0; p < (1u << porder); p++) {
+        int k      = flac_bits(d, pbits);
+        int escape = (k == (1 << pbits) - 1) ? (int) flac_bits(d, 5) : -1;
+
+        if (escape < 0 && k > 24)
+            return 0;
+        for (uint32_t left = psize - (p ? 0 : order), c; left; left -= c) {
+            c = flac_room(d, s, left);
+            int32_t *r = s->out + s->at;
+            if (escape >= 0) {
+                for (uint32_t i = 0; i < c; i++)
+                    r[i] = flac_sbits(d, escape);
+            } else if (!flac_rice(d, r, c, k))
+                return 0;
+            if (coef == NULL)
+                flac_fixed(r, (int) c, order);
+            else if (wide)
+                flac_lpc_wide(r, c, coef, order, shift);
+            else
+                flac_lpc(r, c, coef, order, shift);
+            s->at += c;
+        }
+    }
+    return 1;
+}
+
+// Decodes a subframe of n samples of bps bits. The first channel (chan -1)
+// goes to pcm whole, the second one through the window into pcm.
+static int
+flac_subframe(flac_dec_t *d, uint32_t n, int bps, int chan)
+{
+    flac_sub_t s = { .chan = chan };
+    int32_t    coef[FLAC_HISTORY];
+    int        type, order;
+
+    if (chan < 0) {
+        s.out = d->pcm;
+        s.cap = n;
+    } else {
+        s.out = d->win;
+        s.cap = FLAC_HISTORY + FLAC_CHUNK;
+    }
+
+    if (flac_bits(d, 1))
+        return 0;
+    type = flac_bits(d, 6);
+    if (flac_bits(d, 1)) {
+        s.wasted = 1;
+        while (!flac_bits(d, 1))
+            if (++s.wasted >= bps)
+                return 0;
+    }
+    bps -= s.wasted;
+
+    if (type == 0) {
+        /* CONSTANT */
+        int32_t v = flac_sbits(d, bps);
+        for (uint32_t left = n, c; left; left -= c) {
+            c = flac_room(d, &s, left);
+            for (uint32_t i = 0; i < c; i++)
+                s.out[s.at++] = v;
+        }
+    } else if (type == 1) {
+        /* VERBATIM */
+        for (uint32_t left = n, c; left; left -= c) {
+            c = flac_room(d, &s, left);
+            for (uint32_t i = 0; i < c; i++)
+                s.out[s.at++] = flac_sbits(d, bps);
+        }
+    } else if ((type >= 8 && type <= 12) || type >= 32) {
+        /* FIXED or LPC */
+        order = (type >= 32) ? type - 31 : type - 8;
+        if ((uint32_t) order > n)
+            return 0;
+        for (int i = 0; i < order; i++)
+            s.out[s.at++] = flac_sbits(d, bps);
+        if (type < 32) {
+            if (!flac_residual(d, &s, n, order, NULL, 0, 0))
+                return 0;
+        } else {
+            int precision = flac_bits(d, 4) + 1;
+            int shift     = flac_sbits(d, 5);
+            if (precision == 16 || shift < 0)
+                return 0;
+            for (int i = 0; i < order; i++)
+                coef[i] = flac_sbits(d, precision);
+            int wide = bps + precision + (32 - __builtin_clz(order)) > 32;
+            if (!flac_residual(d, &s, n, order, coef, shift, wide))
+                return 0;
+        }
+    } else
+        return 0;
+
+    flac_flush(d, &s);
+    return 1;
+}
+
+// Decodes the frame at the input into pcm
+static int
+flac_frame(flac_t *fl)
+{
+    flac_dec_t *d = dec;
+    uint32_t    first, n, len, avail;
+    int         chan;
+
+    // Frames start on a byte boundary: hand back the bytes still cached
+    d->in_pos -= d->bits / 8 - d->over;
+    d->cache = 0;
+    d->bits  = 0;
+    d->over  = 0;
+    d->count = 0;
+    d->mark  = flac_tell(d);
+
+    avail = flac_ensure(d, 16);
+    len   = flac_header(fl, d->buf + d->in_pos, avail, &first, &n, &chan);
+    if (!len)
+        return 0;
+    d->in_pos += len;
+
+    if (!flac_subframe(d, n, 16 + (chan == 9), -1)
+        || !flac_subframe(d, n, 16 + (chan == 8 || chan == 10), chan))
+        return 0;
+
+    // Padding to a byte boundary and the frame's CRC-16, which isn't
+    // checked: the USB transfers are already
+    d->cache <<= d->bits & 7;
+    d->bits &= ~7;
+    flac_bits(d, 16);
+    if (d->over > (uint32_t) d->bits / 8)
+        return 0;
+
+    d->first        = first;
+    d->count        = n;
+    fl->next_offset = flac_tell(d);
+    fl->next_sample = first + n;
+    return 1;
+}
+
+/* Seeking */
+
+// Looks for the first frame from offset from on, before to. Sets where it
+// starts and its first sample. Returns -1 if the window runs out first, with
+// *at where to look on from once more of it has been read.
+static int
+flac_sync(flac_t *fl, uint32_t from, uint32_t to, uint32_t *at, uint32_t *first)
+{
+    flac_dec_t *d = dec;
+    uint32_t    n;
+    int         chan;
+
+    if (to - from > FLAC_SCAN_LIMIT)
+        to = from + FLAC_SCAN_LIMIT;
+    flac_goto(fl, from);
+    while (flac_tell(d) < to) {
+        d->mark        = flac_tell(d);
+        uint32_t avail = flac_ensure(d, 16);
+        if (d->starved) {
+            *at = d->mark;
+            return -1;
+        }
+        if (avail == 0)
+            return 0;
+        if (d->buf[d->in_pos] == 0xFF && flac_header(fl, d->buf + d->in_pos, avail, first, &n, &chan)) {
+            *at = flac_tell(d);
+            return 1;
+        }
+        d->in_pos++;
+    }
+    return 0;
+}
+
+// Starts a seek for the frame holding sample, or one at most
+// FLAC_SEEK_LINEAR bytes before it. The seek table gives the entry before it
+// and the next, and frames found between them narrow it down.
+static void
+flac_seek_start(flac_t *fl, uint32_t sample)
+{
+    flac_seek_t *s    = &dec->seek;
+    int          lo_i = 0, hi_i = fl->points_num;
+
+    while (hi_i - lo_i > 1) {
+        int mid = (lo_i + hi_i) / 2;
+        if (fl->points[mid].sample <= sample)
+            lo_i = mid;
+        else
+            hi_i = mid;
+    }
+    s->state   = FLAC_SEEK_PROBING;
+    s->sample  = sample;
+    s->lo      = fl->points[lo_i].offset;
+    s->lo_s    = fl->points[lo_i].sample;
+    s->hi      = (hi_i < fl->points_num) ? fl->points[hi_i].offset : fl->file_size;
+    s->hi_s    = (hi_i < fl->points_num) ? fl->points[hi_i].sample : fl->total_samples;
+    s->probing = 0;
+    s->bisect  = 0;
+}
+
+// Makes a probe of the seek. Every probe is a read from the drive, so rather
+// than bisecting, a probe goes a frame short of where the sample would be at
+// the span's average bitrate; the next frame from there is usually the one.
+// A probe that overshoots is followed by a plain bisection, in case the
+// bitrate is far from even. Returns 1 when there is nothing left to probe,
+// with the frame in lo, 0 after a probe and -1 if the window ran out, for
+// the probe to go on once more of it has been read.
+static int
+flac_seek_step(flac_t *fl)
+{
+    flac_seek_t *s = &dec->seek;
+    uint32_t     at, first;
+
+    if (!s->probing) {
+        if (s->hi - s->lo <= FLAC_SEEK_LINEAR || s->sample - s->lo_s < fl->max_block)
+            return 1;
+        const uint32_t span = s->hi - s->lo;
+        if (s->bisect) {
+            s->mid = s->lo + span / 2;
+        } else {
+            uint64_t guess = (uint64_t) span * (s->sample - s->lo_s);
+            uint64_t frame = (uint64_t) span * fl->max_block;
+            guess  = guess > frame ? (guess - frame) / (s->hi_s - s->lo_s) : 0;
+            s->mid = s->lo + (guess ? (uint32_t) guess : 1);
+        }
+        s->probe     = s->mid;
+        s->probe_end = (s->hi - s->mid > FLAC_SCAN_LIMIT) ? s->mid + FLAC_SCAN_LIMIT : s->hi;
+        s->probing   = 1;
+    }
+
+    int found = flac_sync(fl, s->probe, s->probe_end, &at, &first);
+    if (found < 0) {
+        s->probe = at;
+        return -1;
+    }
+    s->probing = 0;
+    if (found && first <= s->sample) {
+        s->lo     = at;
+        s->lo_s   = first;
+        s->bisect = 0;
+    } else {
+        s->hi = s->mid;
+        if (found && first < s->hi_s)
+            s->hi_s = first;
+        s->bisect = !s->bisect;
+    }
+    return 0;
+}
+
+static uint32_t
+flac_seek(flac_t *fl, uint32_t sample)
+{
+    flac_seek_start(fl, sample);
+    while (flac_seek_step(fl) == 0)
+        ;
+    dec->seek.state = FLAC_SEEK_NONE;
+    return dec->seek.lo;
+}
+
+static void
+flac_add_point(flac_t *fl, uint32_t sample, uint32_t offset)
+{
+    flac_point_t *last = &fl->points[fl->points_num - 1];
+
+    if (fl->points_num < FLAC_SEEK_POINTS && sample > last->sample && offset > last->offset
+        && sample < fl->total_samples && offset < fl->file_size) {
+        fl->points[fl->points_num].sample = sample;
+        fl->points[fl->points_num].offset = offset;
+        fl->points_num++;
+    }
+}
+
+// Seek table for the file, from the num entries of its SEEKTABLE at
+// offset table if it has one, else by looking for frames through the file
+static int
+flac_build_points(flac_t *fl, uint32_t table, uint32_t num)
+{
+    uint8_t  p[18];
+    uint32_t at, first;
+
+    fl->points = (flac_point_t *) malloc(FLAC_SEEK_POINTS * sizeof(flac_point_t));
+    if (fl->points == NULL)
+        return 0;
+    fl->points[0].sample = 0;
+    fl->points[0].offset = fl->first_frame;
+    fl->points_num       = 1;
+    flac_set_async(dec, 0);
+
+    if (num) {
+        uint32_t step = (num + FLAC_SEEK_POINTS - 2) / (FLAC_SEEK_POINTS - 1);
+        for (uint32_t i = 0; i < num; i += step) {
+            if (!flac_read_at(fl->fp, table + i * 18, p, sizeof(p)))
+                break;
+            // Skips placeholders and whatever is past 4 GB
+            if (flac_be32(p) || flac_be32(p + 8))
+                continue;
+            flac_add_point(fl, flac_be32(p + 4), fl->first_frame + flac_be32(p + 12));
+        }
+    }
+
+    if (fl->points_num == 1) {
+        uint32_t spacing = (fl->file_size - fl->first_frame) / FLAC_SEEK_POINTS + 1;
+        if (spacing < FLAC_PROBE_SPACING)
+            spacing = FLAC_PROBE_SPACING;
+        for (uint32_t off = fl->first_frame + spacing; off < fl->file_size; off += spacing)
+            if (flac_sync(fl, off, fl->file_size, &at, &first))
+                flac_add_point(fl, first, at);
+    }
+
+    flac_point_t *fit = (flac_point_t *) realloc(fl->points, fl->points_num * sizeof(flac_point_t));
+    if (fit != NULL)
+        fl->points = fit;
+    flac_log("FLAC: %d seek points from %s", fl->points_num, num ? "SEEKTABLE" : "probing");
+    return 1;
+}
+
+// Room for a frame of max_block samples a quarter longer than stored
+// verbatim, as encoders can pick a worse coding, with the start of its first
+// sector before it and a sector to read into. Longer frames are read through
+// flac_read().
+static uint32_t
+flac_win_need(uint32_t max_block)
+{
+    return ((max_block * 33 * 5 / 32 + 256 + FF_MAX_SS - 1) / FF_MAX_SS + 2) * FF_MAX_SS;
+}
+
+// Whether the window can be freed or moved: not while a read, even one
+// that timed out, can still land in it
+static int
+flac_win_idle(void)
+{
+    return flac_io != FLAC_IO_PENDING && !msc_read_busy(flac_win, flac_win_size);
+}
+
+// Grows the window for frames of max_block samples. Without it, the file is
+// only read through flac_read().
+static void
+flac_win_get(uint32_t max_block)
+{
+    uint32_t need = flac_win_need(max_block);
+
+    if (flac_win_size >= need || !flac_win_idle())
+        return;
+    free(flac_win);
+    flac_win      = (uint8_t *) malloc(need);
+    flac_win_size = flac_win ? need : 0;
+    flac_io       = FLAC_IO_IDLE;
+    flac_io_owner = NULL;
+}
+
+// Takes a share of the decoder, making room for frames of max_block samples
+static int
+flac_dec_get(uint32_t max_block)
+{
+    if (dec == NULL) {
+        dec = (flac_dec_t *) calloc(1, sizeof(flac_dec_t));
+        if (dec == NULL)
+            return 0;
+        dec->buf = dec->in;
+    }
+    if (dec->pcm_size < max_block) {
+        int32_t *pcm = (int32_t *) realloc(dec->pcm, max_block * sizeof(int32_t));
+        if (pcm == NULL) {
+            if (dec->users == 0) {
+                free(dec->pcm);
+                free(dec);
+                dec = NULL;
+            }
+            return 0;
+        }
+        dec->pcm      = pcm;
+        dec->pcm_size = max_block;
+        dec->count    = 0;
+    }
+    // The window is in use or left over from a read that can still land
+    if (!dec->async)
+        flac_win_get(max_block);
+    dec->users++;
+    return 1;
+}
+
+static void
+flac_dec_put(flac_t *fl)
+{
+    if (dec->owner == fl)
+        dec->owner = NULL;
+    if (flac_io_owner == fl)
+        flac_io_owner = NULL;
+    if (--dec->users == 0) {
+        free(dec->pcm);
+        free(dec);
+        dec = NULL;
+        // Else it goes with the next decoder, or when that is gone
+        if (flac_win_idle()) {
+            free(flac_win);
+            flac_win      = NULL;
+            flac_win_size = 0;
+            flac_io       = FLAC_IO_IDLE;
+        }
+    }
+}
+
+int
+flac_open(flac_t *fl, FIL *fp, int *error)
+{
+    uint8_t  h[34];
+    uint32_t off = 0, min_block = 0, table = 0, table_num = 0;
+    int      last = 0;
+
+    memset(fl, 0, sizeof(*fl));
+    fl->fp        = fp;
+    fl->file_size = f_size(fp);
+    *error        = FLAC_ERR_NOT_FLAC;
+
+    // Some taggers put an ID3v2 tag in front
+    if (!flac_read_at(fp, 0, h, 10))
+        return 0;
+    if (!memcmp(h, "ID3", 3)) {
+        off = 10 + ((h[6] & 0x7F) << 21 | (h[7] & 0x7F) << 14 | (h[8] & 0x7F) << 7 | (h[9] & 0x7F));
+        if (h[5] & 0x10)
+            off += 10;
+    }
+    if (!flac_read_at(fp, off, h, 4) || memcmp(h, "fLaC", 4))
+        return 0;
+    off += 4;
+
+    *error = FLAC_ERR_FORMAT;
+    while (!last) {
+        if (!flac_read_at(fp, off, h, 4))
+            return 0;
+        uint32_t type = h[0] & 0x7F, len = (uint32_t) h[1] << 16 | h[2] << 8 | h[3];
+        last = h[0] & 0x80;
+        off += 4;
+        if (type == 0) {
+            /* STREAMINFO */
+            if (len < 34 || !flac_read_at(fp, off, h, 34))
+                return 0;
+            min_block     = h[0] << 8 | h[1];
+            fl->max_block = h[2] << 8 | h[3];
+            uint32_t rate     = (uint32_t) h[10] << 12 | h[11] << 4 | h[12] >> 4;
+            int      channels = ((h[12] >> 1) & 7) + 1;
+            int      bps      = ((h[12] & 1) << 4 | h[13] >> 4) + 1;
+            // The PCM has to fit the 32-bit offsets of track files
+            if (rate != 44100 || channels != 2 || bps != 16 || (h[13] & 15) || h[14] >= 0x40
+                || fl->max_block < 16 || min_block > fl->max_block)
+                return 0;
+            fl->total_samples = flac_be32(h + 14);
+        } else if (type == 3) {
+            /* SEEKTABLE */
+            table     = off;
+            table_num = len / 18;
+        }
+        off += len;
+    }
+    if (fl->total_samples == 0)
+        return 0;
+    fl->first_frame = off;
+    fl->next_offset = off;
+
+    *error = FLAC_ERR_MEMORY;
+    if (!flac_dec_get(fl->max_block))
+        return 0;
+    if (!flac_build_points(fl, table, table_num)) {
+        flac_dec_put(fl);
+        return 0;
+    }
+    *error = 0;
+    return 1;
+}
+
+void
+flac_close(flac_t *fl)
+{
+    if (fl->points == NULL)
+        return;
+    flac_dec_put(fl);
+    free(fl->points);
+    fl->points = NULL;
+}
+
+int
+flac_read(flac_t *fl, uint8_t *buffer, uint32_t seek, size_t count)
+{
+    flac_dec_t *d = dec;
+
+    if (d == NULL || seek > fl->total_samples * 4 || count > fl->total_samples * 4 - seek)
+        return 0;
+    flac_set_async(d, 0);
+
+    while (count) {
+        uint32_t sample = seek / 4;
+
+        if (d->owner != fl || sample - d->first >= d->count) {
+            // Decodes on from the last frame if the sample is close ahead,
+            // else seeks
+            uint32_t off = fl->next_offset;
+            if (d->owner != fl || sample < fl->next_sample || sample - fl->next_sample >= 2 * fl->max_block)
+                off = flac_seek(fl, sample);
+            flac_goto(fl, off);
+            do {
+                if (!flac_frame(fl) || sample < d->first)
+                    return 0;
+            } while (sample - d->first >= d->count);
+        }
+
+        uint32_t at = seek - d->first * 4;
+        uint32_t c  = d->count * 4 - at;
+        if (c > count)
+            c = count;
+        memcpy(buffer, (const uint8_t *) d->pcm + at, c);
+        buffer += c;
+        seek += c;
+        count -= c;
+    }
+    return 1;
+}
+
+int
+flac_read_async(flac_t *fl, uint8_t *buffer, uint32_t seek, size_t count, uint32_t *done)
+{
+    flac_dec_t  *d = dec;
+    flac_seek_t *s;
+    int          work = 0;
+
+    if (d == NULL || fl->map == NULL || flac_win_size < flac_win_need(fl->max_block)
+        || seek > fl->total_samples * 4 || count > fl->total_samples * 4 - seek)
+        return -1;
+    if (!flac_win_idle())
+        return 0;
+    flac_set_async(d, 1);
+    s = &d->seek;
+
+    if (flac_io == FLAC_IO_FAILED) {
+        flac_io    = FLAC_IO_IDLE;
+        d->in_len  = 0;
+        d->in_pos  = 0;
+        s->state   = FLAC_SEEK_NONE;
+        return -1;
+    }
+    if (flac_io == FLAC_IO_DONE) {
+        // It lands after the window, or fills it from the start of a sector
+        flac_io = FLAC_IO_IDLE;
+        if (flac_io_owner != fl) {
+        } else if (d->in_len && flac_io_off == d->in_off + d->in_len) {
+            d->in_len += flac_io_len;
+        } else if (!d->in_len && !d->in_pos && flac_io_off == d->in_off - d->in_off % FF_MAX_SS) {
+            d->in_pos = d->in_off - flac_io_off;
+            d->in_off = flac_io_off;
+            d->in_len = flac_io_len;
+        }
+    }
+
+    while (*done < count) {
+        uint32_t pos    = seek + *done;
+        uint32_t sample = pos / 4;
+
+        if (d->owner != fl || sample - d->first >= d->count) {
+            // A frame or a seek probe per call
+            if (work++)
+                return 0;
+            d->starved = 0;
+            d->too_big = 0;
+            d->fetch   = FLAC_DECODE_READ;
+            if (s->state != FLAC_SEEK_NONE && s->sample != sample)
+                s->state = FLAC_SEEK_NONE;
+            // Decodes on from the last frame if the sample is close ahead,
+            // else seeks
+            if (s->state == FLAC_SEEK_NONE
+                && (d->owner != fl || sample < fl->next_sample || sample - fl->next_sample >= 2 * fl->max_block))
+                flac_seek_start(fl, sample);
+            if (s->state == FLAC_SEEK_PROBING) {
+                // Probes only look at a frame header
+                d->fetch = FLAC_PROBE_READ;
+                int r    = flac_seek_step(fl);
+                if (r <= 0)
+                    return 0;
+                s->state        = FLAC_SEEK_FORWARD;
+                fl->next_offset = s->lo;
+                fl->next_sample = s->lo_s;
+                d->fetch        = FLAC_DECODE_READ;
+            }
+
+            flac_goto(fl, fl->next_offset);
+            if (!flac_frame(fl))
+                return (d->starved && !d->too_big) ? 0 : -1;
+            if (sample < d->first) {
+                s->state = FLAC_SEEK_NONE;
+                return -1;
+            }
+            if (sample - d->first < d->count)
+                s->state = FLAC_SEEK_NONE;
+
+            // Reads on while the frame is copied out and played
+            if (flac_io == FLAC_IO_IDLE && d->in_len - d->in_pos < flac_win_size / 2) {
+                d->mark = flac_tell(d);
+                flac_fetch(d);
+                d->starved = 0;
+            }
+            continue;
+        }
+
+        uint32_t at = pos - d->first * 4;
+        uint32_t c  = d->count * 4 - at;
+        if (c > count - *done)
+            c = count - *done;
+        memcpy(buffer + *done, (const uint8_t *) d->pcm + at, c);
+        *done += c;
+    }
+    return 1;
+}
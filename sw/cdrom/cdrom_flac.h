@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "ff.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Streaming FLAC decoder for the audio tracks of cue sheets. Only CD audio
+// (44.1 kHz, 16-bit stereo) is accepted, and it comes out as the same little
+// endian PCM a .bin track holds, so the image backend can read FLAC tracks
+// by PCM byte offset like any other track file.
+
+// Where a frame starts in the file and the first sample it holds
+typedef struct flac_point_t {
+    uint32_t sample;
+    uint32_t offset;
+} flac_point_t;
+
+typedef struct flac_t {
+    FIL *fp;
+    uint32_t file_size;
+    uint32_t total_samples;
+    uint32_t max_block;        // Longest frame in samples, from STREAMINFO
+    uint32_t first_frame;      // File offset of the first frame
+    // Seek table built when the file is opened, see flac_open()
+    flac_point_t *points;
+    int points_num;
+    // Frame after the last one decoded
+    uint32_t next_offset;
+    uint32_t next_sample;
+    // Where the file lies on the drive, for flac_read_async(): maps count
+    // bytes from offset seek to a first block, returning how many of them
+    // follow on from it, or 0
+    uint32_t (*map)(void *priv, uint32_t seek, uint32_t count, uint32_t *block);
+    void *map_priv;
+} flac_t;
+
+// Error codes of flac_open()
+#define FLAC_ERR_NOT_FLAC    1
+#define FLAC_ERR_MEMORY      2
+#define FLAC_ERR_FORMAT      4
+
+// Checks fp holds CD audio in FLAC and builds its seek table. Returns 0 and
+// sets *error to one of FLAC_ERR_* if it can't be played.
+int  flac_open(flac_t *fl, FIL *fp, int *error);
+void flac_close(flac_t *fl);
+// Reads count bytes of PCM from byte offset seek. Returns 1 on success.
+int  flac_read(flac_t *fl, uint8_t *buffer, uint32_t seek, size_t count);
+// The same without waiting for the drive: reads the file through map with
+// msc_read_async() and decodes a frame, or makes a seek probe, per call.
+// *done counts the bytes so far, from 0. Returns 1 once all are there, 0 to
+// be called again later and -1 if flac_read() has to take over.
+int  flac_read_async(flac_t *fl, uint8_t *buffer, uint32_t seek, size_t count, uint32_t *done);
+
+#ifdef __cplusplus
+}
+#endif
@@ -183,6 +183,20 @@ image_read_audio_sectors(struct cdrom *dev, uint8_t *b, uint32_t lba, uint32_t c
     return cdi_read_audio_sectors(img, b, lba, count);
 }
 
+static int
+image_map_sectors(struct cdrom *dev, int raw, uint32_t lba, uint32_t count, uint32_t *block, uint32_t *offset, uint32_t *stride)
+{
+    cd_img_t *img = (cd_img_t *) dev->image;
+    return cdi_map_sectors(img, raw, lba, count, block, offset, stride);
+}
+
+static int
+image_read_audio_async(struct cdrom *dev, uint8_t *b, uint32_t lba, uint32_t count, uint32_t *done)
+{
+    cd_img_t *img = (cd_img_t *) dev->image;
+    return cdi_read_audio_sectors_async(img, b, lba, count, done);
+}
+
 static int
 image_track_type(cdrom_t *dev, uint32_t lba)
 {
@@ -212,6 +226,7 @@ image_exit(cdrom_t *dev)
         cdi_close(img);
         dev->image = NULL;
     }
+    dev->seek_stats.fragments = dev->seek_stats.seeks = dev->seek_stats.seek_reads = 0;
     // printf("wiped ops in image exit\n");
     dev->ops = NULL;
 }
@@ -224,6 +239,8 @@ static const cdrom_ops_t cdrom_image_ops = {
     image_sector_size,
     image_read_sector,
     image_read_audio_sectors,
+    image_map_sectors,
+    image_read_audio_async,
     image_track_type,
     image_exit
 };
@@ -260,6 +277,11 @@ cdrom_image_open(cdrom_t *dev, const char *fn)
 
     // putchar('b');
     dev->image = img;
+    /* Sectors read ahead from the previous image are stale. */
+    dev->readahead_gen++;
+    dev->seek_stats.fragments = dev->seek_stats.seeks = dev->seek_stats.seek_reads = 0;
+    dev->audio_decode_us = dev->audio_decode_max_us = dev->audio_decode_sectors = 0;
+    img->stats = &dev->seek_stats;
 
     /* Open the image. */
     int i = cdi_set_device(img, fn);
@@ -285,6 +307,17 @@ cdrom_image_open(cdrom_t *dev, const char *fn)
     return 0;
 }
 
+/* How the loaded image's files are laid out on the USB drive and how many
+   FAT reads seeking in them has cost so far, for pgusinit. Only reads the
+   totals in dev, so it's safe while the other core opens or closes images. */
+void
+cdrom_image_seek_stats(cdrom_t *dev, uint32_t *fragments, uint32_t *seeks, uint32_t *seek_reads)
+{
+    *fragments  = dev->seek_stats.fragments;
+    *seeks      = dev->seek_stats.seeks;
+    *seek_reads = dev->seek_stats.seek_reads;
+}
+
 void
 cdrom_image_close(cdrom_t *dev)
 {
@@ -36,8 +36,11 @@
 #define HAVE_STDARG_H
 #include "../include/pg_debug.h"
 #include "cdrom_image_backend.h"
+#include "cdrom.h"
 #include "cdrom_error_msg.h"
+#include "cdrom_flac.h"
 #include "86box_compat.h"
+#include "msc_app.h"
 
 
 /* #define CDROM_BCD(x)        (((x) % 10) | (((x) / 10) << 4)) */
@@ -97,7 +100,18 @@ bin_read(void *priv, uint8_t *buffer, uint32_t seek, size_t count)
     if (tf->fp == NULL)
         return 0;    
     //if (fseeko64(tf->fp, seek, SEEK_SET) == -1) {    
-    if (f_lseek(tf->fp, seek) != FR_OK) {
+    // Finding the sector only takes FAT reads when the seek table doesn't
+    // cover the file. Seeking into the middle of it reads the sector too,
+    // which is file data rather than seek cost, so that's done separately.
+    uint32_t reads = msc_disk_read_count();
+    FRESULT  res   = f_lseek(tf->fp, seek - seek % FF_MAX_SS);
+    if (tf->stats) {
+        tf->stats->seeks++;
+        tf->stats->seek_reads += msc_disk_read_count() - reads;
+    }
+    if (res == FR_OK && (seek % FF_MAX_SS))
+        res = f_lseek(tf->fp, seek);
+    if (res != FR_OK) {
         cdrom_image_backend_log("CDROM: binary_read failed during seek!\n");
         return 0;
     }
@@ -112,6 +126,45 @@ bin_read(void *priv, uint8_t *buffer, uint32_t seek, size_t count)
     return 1;
 }
 
+/* Walks the fast seek cluster link map instead of the FAT, so it never
+   touches the drive. */
+static uint32_t
+bin_map(void *priv, uint32_t seek, uint32_t count, uint32_t *block)
+{
+    track_file_t *tf = (track_file_t *) priv;
+
+    if (tf->fp == NULL || tf->fp->cltbl == NULL || seek >= f_size(tf->fp))
+        return 0;
+
+    FATFS         *fs    = tf->fp->obj.fs;
+    uint32_t       csize = (uint32_t) fs->csize * FF_MAX_SS;
+    uint32_t       cl    = seek / csize;
+    const DWORD   *tbl   = tf->fp->cltbl + 1;
+    uint32_t       ncl;
+
+    if (fs->id != tf->fp->obj.id)
+        return 0; /* volume was remounted */
+
+    /* The map is a list of (cluster count, first cluster) fragments */
+    for (;;) {
+        ncl = *tbl++;
+        if (ncl == 0)
+            return 0;
+        if (cl < ncl)
+            break;
+        cl -= ncl;
+        tbl++;
+    }
+
+    uint32_t in_cluster = seek % csize;
+    *block = fs->database + (*tbl + cl - 2) * fs->csize + in_cluster / FF_MAX_SS;
+
+    uint32_t contig = (ncl - cl) * csize - in_cluster;
+    if (count > f_size(tf->fp) - seek)
+        count = f_size(tf->fp) - seek;
+    return (contig < count) ? contig : count;
+}
+
 /* static uint64_t */
 static uint32_t
 bin_get_length(void *priv)
@@ -150,6 +203,8 @@ bin_close(void *priv)
         free(tf->fp);
         tf->fp = NULL;
     }
+    free(tf->clmt_ext);
+    tf->clmt_ext = NULL;
 
     tf->fn[0] = 0;
     /* memset(tf->fn, 0x00, sizeof(tf->fn)); */
@@ -182,15 +237,38 @@ bin_init(const char *filename, int *error)
     if (result == FR_OK) {
         cdrom_image_backend_log("all good\n");
         // Set up fast seek for the file (avoids reading the FAT for each seek)
+        tf->clmt_ext = NULL;
+        tf->stats = NULL;
         tf->fp->cltbl = tf->clmt;
         tf->clmt[0] = SZ_TBL;
-        if (f_lseek(tf->fp, CREATE_LINKMAP) == FR_NOT_ENOUGH_CORE) {
-            // Size of clmt is too small for the file - it is too fragmented
-            cdrom_image_backend_log("File too fragmented for the cluster link map table. Falling back to slow seek\n");
+        tf->fragments = 0;
+        result = f_lseek(tf->fp, CREATE_LINKMAP);
+        if (result == FR_OK || result == FR_NOT_ENOUGH_CORE) {
+            // FatFS leaves the size the map needs in its first entry: two
+            // per fragment and two more
+            tf->fragments = (tf->clmt[0] - 2) / 2;
+        }
+        if (result == FR_NOT_ENOUGH_CORE) {
+            // Too fragmented for clmt, so build the map again in one that fits
+            tf->clmt_ext = (uint32_t *) malloc(tf->clmt[0] * sizeof(uint32_t));
+            if (tf->clmt_ext != NULL) {
+                tf->clmt_ext[0] = tf->clmt[0];
+                tf->fp->cltbl = tf->clmt_ext;
+                result = f_lseek(tf->fp, CREATE_LINKMAP);
+            }
+        }
+        if (result != FR_OK) {
+            // The partial map is unusable, so let FatFS follow the FAT.
+            cdrom_image_backend_log("No cluster link map table for %u fragments. Falling back to slow seek\n", tf->fragments);
+            tf->fp->cltbl = NULL;
+            free(tf->clmt_ext);
+            tf->clmt_ext = NULL;
         }
         tf->read       = bin_read;
         tf->get_length = bin_get_length;
         tf->close      = bin_close;
+        tf->map        = bin_map;
+        tf->read_async = NULL;
     } else {
         free(tf);
         tf = NULL;
@@ -200,12 +278,97 @@ bin_init(const char *filename, int *error)
     return tf;
 }
 
+/* FLAC file functions. Reads give the PCM a .BIN audio track would hold,
+   decoded as it's read, so the file can't be mapped for reading it from
+   the drive directly; the decoder reads it from the drive itself in
+   flac_file_read_async(). */
+static int
+flac_file_read(void *priv, uint8_t *buffer, uint32_t seek, size_t count)
+{
+    track_file_t *tf = (track_file_t *) priv;
+
+    return flac_read((flac_t *) tf->priv, buffer, seek, count);
+}
+
+static int
+flac_file_read_async(void *priv, uint8_t *buffer, uint32_t seek, size_t count, uint32_t *done)
+{
+    track_file_t *tf = (track_file_t *) priv;
+
+    return flac_read_async((flac_t *) tf->priv, buffer, seek, count, done);
+}
+
+static uint32_t
+flac_file_get_length(void *priv)
+{
+    track_file_t *tf = (track_file_t *) priv;
+
+    return ((flac_t *) tf->priv)->total_samples * 4;
+}
+
+static void
+flac_file_close(void *priv)
+{
+    track_file_t *tf = (track_file_t *) priv;
+
+    if (tf == NULL)
+        return;
+
+    if (tf->priv != NULL) {
+        flac_close((flac_t *) tf->priv);
+        free(tf->priv);
+        tf->priv = NULL;
+    }
+    bin_close(priv);
+}
+
+static track_file_t *
+flac_file_init(const char *filename, int *error)
+{
+    track_file_t *tf = bin_init(filename, error);
+    flac_t       *fl;
+
+    if (tf == NULL)
+        return NULL;
+
+    fl = (flac_t *) malloc(sizeof(flac_t));
+    if (fl == NULL) {
+        *error = 2;
+        bin_close(tf);
+        return NULL;
+    }
+    if (!flac_open(fl, tf->fp, error)) {
+        cdrom_image_backend_log("CDROM: %s is not CD audio in FLAC (%d)\n", filename, *error);
+        free(fl);
+        bin_close(tf);
+        return NULL;
+    }
+
+    tf->priv       = fl;
+    tf->read       = flac_file_read;
+    tf->get_length = flac_file_get_length;
+    tf->close      = flac_file_close;
+    tf->map        = NULL;
+    tf->read_async = flac_file_read_async;
+    /* The decoder maps the compressed data with the file's cluster link map */
+    if (tf->fp->cltbl != NULL) {
+        fl->map      = bin_map;
+        fl->map_priv = tf;
+    }
+
+    return tf;
+}
+
 static track_file_t *
-track_file_init(const char *filename, int *error)
+track_file_init(const char *filename, const char *type, int *error)
 {
-    /* Current we only support .BIN files, either combined or one per
-       track. In the future, more is planned. */
-    return bin_init(filename, error);
+    /* .BIN files, either combined or one per track, and FLAC audio tracks,
+       which cue sheets list as WAVE. */
+    if (!strcmp(type, "BINARY"))
+        return bin_init(filename, error);
+    if (!strcmp(type, "WAVE") || !strcmp(type, "FLAC"))
+        return flac_file_init(filename, error);
+    return NULL;
 }
 
 static void
@@ -248,6 +411,9 @@ cdi_clear_tracks(cd_img_t *cdi)
     /* Now free the array. */
     free(cdi->tracks); /// maybe not
     cdi->tracks = NULL;
+    free(cdi->toc);
+    cdi->toc      = NULL;
+    cdi->toc_hint = 0;
 
     /* Mark that there's no tracks. */
     cdi->tracks_num = 0;
@@ -260,19 +426,69 @@ cdi_close(cd_img_t *cdi)
     free(cdi);
 }
 
+/* The track list doesn't change once the image is loaded, so the TOC is
+   worked out once for all the guest's queries. */
+static int
+cdi_build_toc(cd_img_t *cdi)
+{
+    cdi->toc = (cd_toc_t *) malloc(cdi->tracks_num * sizeof(cd_toc_t));
+    if (cdi->toc == NULL)
+        return 0;
+
+    for (int i = 0; i < cdi->tracks_num; i++) {
+        const track_t *trk = &cdi->tracks[i];
+        cd_toc_t      *toc = &cdi->toc[i];
+
+        toc->start        = trk->start;
+        toc->track_number = (uint8_t) trk->track_number;
+        toc->attr         = (uint8_t) trk->attr;
+        frames_to_msf(trk->start + 150, &toc->msf.min, &toc->msf.sec, &toc->msf.fr);
+    }
+    cdi->toc_hint = 0;
+
+    return 1;
+}
+
+/* Totals the fragments of the image's files and has their reads count seeks
+   from here on, for telling how much a fragmented USB drive costs. */
+static void
+cdi_count_seeks(cd_img_t *cdi)
+{
+    const track_file_t *last = NULL;
+    uint32_t            fragments = 0;
+
+    for (int i = 0; i < cdi->tracks_num; i++) {
+        track_file_t *tf = cdi->tracks[i].file;
+        if (tf == NULL || tf == last)
+            continue;
+        last = tf;
+        fragments += tf->fragments;
+        tf->stats = cdi->stats;
+    }
+    cdi->stats->fragments = fragments;
+}
+
 int
 cdi_set_device(cd_img_t *cdi, const char *path)
 {
     int len = strlen(path);
+    int ret;
     if (len < 4) return 0;
     if (strncasecmp(path + (len - 4), ".cue", 4) == 0) {
-        return cdi_load_cue(cdi, path);
+        ret = cdi_load_cue(cdi, path);
     } else if (strncasecmp(path + (len - 4), ".iso", 4) == 0) {
-        return cdi_load_iso(cdi, path);
+        ret = cdi_load_iso(cdi, path);
     } else {
         cdrom_errorstr_set("File '%s' not a cue or iso", path);
         return 0;
     }
+    if (ret && !cdi_build_toc(cdi)) {
+        cdrom_errorstr_set("Error allocating memory for the TOC of '%s'", path);
+        return 0;
+    }
+    if (ret && cdi->stats)
+        cdi_count_seeks(cdi);
+    return ret;
 }
 
 void
@@ -280,7 +496,7 @@ cdi_get_audio_tracks(cd_img_t *cdi, int *st_track, int *end, TMSF *lead_out)
 {
     *st_track = 1;
     *end      = cdi->tracks_num - 1;
-    frames_to_msf(cdi->tracks[*end].start + 150, &lead_out->min, &lead_out->sec, &lead_out->fr);
+    *lead_out = cdi->toc[*end].msf;
 }
 
 void
@@ -288,25 +504,23 @@ cdi_get_audio_tracks_lba(cd_img_t *cdi, int *st_track, int *end, uint32_t *lead_
 {
     *st_track = 1;
     *end      = cdi->tracks_num - 1;
-    *lead_out = cdi->tracks[*end].start;
+    *lead_out = cdi->toc[*end].start;
 }
 
 /* This replaces both Info and EndInfo, they are specified by a variable. */
 int
 cdi_get_audio_track_info(cd_img_t *cdi, UNUSED(int end), int track, int *track_num, TMSF *start, uint8_t *attr)
 {
-    const track_t *trk = &cdi->tracks[track - 1];
-    int      pos = trk->start + 150;
+    const cd_toc_t *toc;
 
     if ((track < 1) || (track > cdi->tracks_num))
         return 0;
 
-    pos = trk->start + 150;
-
-    frames_to_msf(pos, &start->min, &start->sec, &start->fr);
+    toc = &cdi->toc[track - 1];
 
-    *track_num = trk->track_number;
-    *attr      = trk->attr;
+    *start     = toc->msf;
+    *track_num = toc->track_number;
+    *attr      = toc->attr;
 
     return 1;
 }
@@ -314,65 +528,94 @@ cdi_get_audio_track_info(cd_img_t *cdi, UNUSED(int end), int track, int *track_n
 int
 cdi_get_audio_track_info_lba(cd_img_t *cdi, UNUSED(int end), int track, int *track_num, uint32_t *start, uint8_t *attr)
 {
-    const track_t *trk = &cdi->tracks[track - 1];
+    const cd_toc_t *toc;
 
     if ((track < 1) || (track > cdi->tracks_num))
         return 0;
 
-    *start = (uint32_t) trk->start;
+    toc = &cdi->toc[track - 1];
 
-    *track_num = trk->track_number;
-    *attr      = trk->attr;
+    *start     = toc->start;
+    *track_num = toc->track_number;
+    *attr      = toc->attr;
 
     return 1;
 }
 
-int
-cdi_get_track(cd_img_t *cdi, uint32_t sector)
+/* TOC entry of the track sector is in, -1 if it's past the last one.
+   Playback and subchannel polling mostly ask about the track asked about
+   last or the one after it, so those are tried before searching. */
+static int
+cdi_toc_find(cd_img_t *cdi, uint32_t sector)
 {
-    const track_t *cur;
-    const track_t *next;
+    const cd_toc_t *toc      = cdi->toc;
+    int             lead_out = cdi->tracks_num - 1;
+    int             i        = cdi->toc_hint;
+    int             lo, hi;
 
     /* There must be at least two tracks - data and lead out. */
-    if (cdi->tracks_num < 2)
+    if ((toc == NULL) || (lead_out < 1) || (sector >= toc[lead_out].start))
         return -1;
 
-    /* This has a problem - the code skips the last track, which is
-       lead out - is that correct? */
-    for (int i = 0; i < (cdi->tracks_num - 1); i++) {
-        cur  = &cdi->tracks[i];
-        next = &cdi->tracks[i + 1];
+    if ((i < lead_out) && (toc[i].start <= sector) && (sector < toc[i + 1].start))
+        return i;
+    if ((i + 1 < lead_out) && (toc[i + 1].start <= sector) && (sector < toc[i + 2].start)) {
+        cdi->toc_hint = i + 1;
+        return i + 1;
+    }
 
-        /* Take into account cue sheets that do not start on sector 0. */
-        if ((i == 0) && (sector < cur->start))
-            return cur->number;
+    /* Take into account cue sheets that do not start on sector 0. */
+    if (sector < toc[0].start)
+        return 0;
 
-        if ((cur->start <= sector) && (sector < next->start))
-            return cur->number;
+    /* The last track starting at or before sector */
+    lo = 0;
+    hi = lead_out;
+    while (hi - lo > 1) {
+        int mid = (lo + hi) / 2;
+        if (toc[mid].start <= sector)
+            lo = mid;
+        else
+            hi = mid;
     }
+    cdi->toc_hint = lo;
+
+    return lo;
+}
+
+int
+cdi_get_track(cd_img_t *cdi, uint32_t sector)
+{
+    int i = cdi_toc_find(cdi, sector);
 
-    return -1;
+    return (i < 0) ? -1 : cdi->tracks[i].number;
 }
 
 /* TODO: See if track start is adjusted by 150 or not. */
 int
 cdi_get_audio_sub(cd_img_t *cdi, uint32_t sector, uint8_t *attr, uint8_t *track, uint8_t *index, TMSF *rel_pos, TMSF *abs_pos)
 {
-    int            cur_track = cdi_get_track(cdi, sector);
-    const track_t *trk;
+    int             i = cdi_toc_find(cdi, sector);
+    const cd_toc_t *toc;
 
-    if (cur_track < 1)
+    if (i < 0)
         return 0;
 
-    *track = (uint8_t) cur_track;
-    trk    = &cdi->tracks[*track - 1];
-    *attr  = trk->attr;
+    toc    = &cdi->toc[i];
+    *track = (uint8_t) cdi->tracks[i].number;
+    *attr  = toc->attr;
     *index = 1;
 
     frames_to_msf(sector + 150, &abs_pos->min, &abs_pos->sec, &abs_pos->fr);
 
-    /* Absolute position should be adjusted by 150, not the relative ones. */
-    frames_to_msf(sector - trk->start, &rel_pos->min, &rel_pos->sec, &rel_pos->fr);
+    /* Absolute position should be adjusted by 150, not the relative ones.
+       In the pregap of the first track it counts down to the track's start,
+       as on a real disc. */
+    if (sector < toc->start) {
+        *index = 0;
+        frames_to_msf(toc->start - sector, &rel_pos->min, &rel_pos->sec, &rel_pos->fr);
+    } else
+        frames_to_msf(sector - toc->start, &rel_pos->min, &rel_pos->sec, &rel_pos->fr);
 
     return 1;
 }
@@ -496,12 +739,12 @@ cdi_read_audio_sectors(cd_img_t *cdi, uint8_t *buffer, uint32_t sector, uint32_t
 
     track_t *trk = &cdi->tracks[track];
 
-    /* clip to track boundary */
+    /* clip to track boundary; a pregap past the track's length isn't read */
     uint32_t track_end = trk->start + trk->length;
+    if (sector >= track_end)
+        return 0;
     if (sector + num > track_end)
         num = track_end - sector;
-    if (num == 0)
-        return 0;
 
     uint32_t seek = trk->skip + ((sector - trk->start) * trk->sector_size);
     if (!trk->file->read(trk->file, buffer, seek, num * trk->sector_size))
@@ -509,6 +752,89 @@ cdi_read_audio_sectors(cd_img_t *cdi, uint8_t *buffer, uint32_t sector, uint32_t
     return (int) num;
 }
 
+/* cdi_read_audio_sectors() in steps that don't wait for the drive, for
+   tracks that can't be mapped. *done counts the bytes read so far, from 0.
+   Returns the number of sectors read once they all are, 0 to be called again
+   and -1 if cdi_read_audio_sectors() has to read them. */
+int
+cdi_read_audio_sectors_async(cd_img_t *cdi, uint8_t *buffer, uint32_t sector, uint32_t num, uint32_t *done)
+{
+    int      track = cdi_get_track(cdi, sector) - 1;
+    if (track < 0 || num == 0)
+        return -1;
+
+    track_t *trk = &cdi->tracks[track];
+    if (trk->file == NULL || trk->file->read_async == NULL)
+        return -1;
+
+    /* clip to track boundary, as cdi_read_audio_sectors() does */
+    uint32_t track_end = trk->start + trk->length;
+    if (sector >= track_end)
+        return -1;
+    if (sector + num > track_end)
+        num = track_end - sector;
+
+    uint32_t seek = trk->skip + ((sector - trk->start) * trk->sector_size);
+    int      r    = trk->file->read_async(trk->file, buffer, seek, num * trk->sector_size, done);
+    return (r > 0) ? (int) num : r;
+}
+
+/* Locates what cdi_read_audio_sectors() (raw) or cooked cdi_read_sector()
+   calls of 2048-byte sectors would read, so it can be read from the drive
+   without FatFS. Returns how many of the num sectors from sector lie in one
+   run of blocks from *block; 0 when the data has to go through FatFS. The
+   first sector's data starts *offset bytes into the run and the following
+   ones are *stride bytes apart. */
+int
+cdi_map_sectors(cd_img_t *cdi, int raw, uint32_t sector, uint32_t num, uint32_t *block, uint32_t *offset, uint32_t *stride)
+{
+    int      track = cdi_get_track(cdi, sector) - 1;
+    track_t *trk;
+    uint32_t seek;
+    uint32_t header = 0;
+    uint32_t length;
+
+    if (track < 0 || num == 0)
+        return 0;
+
+    trk = &cdi->tracks[track];
+    if (trk->file == NULL || trk->file->map == NULL)
+        return 0;
+
+    /* clip to track boundary; a pregap past the track's length isn't read */
+    uint32_t track_end = trk->start + trk->length;
+    if (sector >= track_end)
+        return 0;
+    if (sector + num > track_end)
+        num = track_end - sector;
+
+    seek = trk->skip + ((sector - trk->start) * trk->sector_size);
+    if (raw) {
+        if (trk->sector_size != RAW_SECTOR_SIZE)
+            return 0;
+        length = RAW_SECTOR_SIZE;
+    } else {
+        /* Same offsets as cdi_read_sector(), Mode 1 and Mode 2 Form 1 only */
+        if (trk->mode2 && (trk->form != 1))
+            return 0;
+        if ((trk->sector_size == RAW_SECTOR_SIZE) || (trk->sector_size == 2448))
+            header = (trk->mode2 ? 24 : 16);
+        else if (trk->sector_size != COOKED_SECTOR_SIZE)
+            return 0;
+        length = COOKED_SECTOR_SIZE;
+    }
+
+    /* Every sector but the last is read whole */
+    uint32_t contig = trk->file->map(trk->file, seek, (num - 1) * trk->sector_size + header + length, block);
+    if (contig < header + length)
+        return 0;
+    num = (contig - header - length) / trk->sector_size + 1;
+
+    *offset = seek % FF_MAX_SS + header;
+    *stride = trk->sector_size;
+    return (int) num;
+}
+
 /* TODO: Do CUE+BIN images with a sector size of 2448 even exist? */
 int
 cdi_read_sector_sub(cd_img_t *cdi, uint8_t *buffer, uint32_t sector)
@@ -1072,12 +1398,10 @@ cdi_load_cue(cd_img_t *cdi, const char *cuefile)
             error    = 1;
 
             // putchar('6');
-            if (!strcmp(type, "BINARY")) {
-                strncpy(filename,ansi,MAX_FILENAME_LENGTH);
-                trk.file = track_file_init(filename, &error);
-                if (trk.file) {
-                    error = 0;
-                }
+            strncpy(filename,ansi,MAX_FILENAME_LENGTH);
+            trk.file = track_file_init(filename, type, &error);
+            if (trk.file) {
+                error = 0;
             }
             // putchar('7');
             if (error) {
@@ -1088,6 +1412,9 @@ cdi_load_cue(cd_img_t *cdi, const char *cuefile)
                 case 2:
                     cdrom_errorstr_set("Error allocating memory for file '%s' in cue sheet '%s'", filename, cuefile);
                     break;
+                case FLAC_ERR_FORMAT:
+                    cdrom_errorstr_set("File '%s' in cue sheet '%s' is not 44.1 kHz 16-bit stereo FLAC", filename, cuefile);
+                    break;
                 default:
                     cdrom_errorstr_set("Cannot open file '%s' in cue sheet '%s'", filename, cuefile);
                     break;
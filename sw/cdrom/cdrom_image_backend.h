@@ -59,18 +59,32 @@ typedef struct SMSF {
 
 #define SZ_TBL 32
 
+struct cdrom_seek_stats;
+
 /* Track file struct. */
 typedef struct track_file_t {
     int (*read)(void *priv, uint8_t *buffer, uint32_t seek, size_t count);
     // uint64_t (*get_length)(void *priv);
     uint32_t (*get_length)(void *priv);
     void (*close)(void *priv);
+    // Where seek lies on the drive: sets *block to the 512-byte block holding
+    // it and returns how many of the count bytes from there on are contiguous
+    // on the drive, 0 if not known. NULL if the file can't be mapped.
+    uint32_t (*map)(void *priv, uint32_t seek, uint32_t count, uint32_t *block);
+    // read() in steps that don't wait for the drive, for files that can't be
+    // mapped: *done counts the bytes read so far. Returns 1 when all are
+    // there, 0 to be called again and -1 to use read(). NULL if there is none.
+    int (*read_async)(void *priv, uint8_t *buffer, uint32_t seek, size_t count, uint32_t *done);
 
     char  fn[128];
     FIL *fp;
     void *priv;
-    // fast seek cluster link map table
+    // fast seek cluster link map table, or clmt_ext sized to fit when the
+    // file is in more fragments than clmt has room for
     uint32_t clmt[SZ_TBL];
+    uint32_t *clmt_ext;
+    uint32_t fragments;   // Runs of clusters the file is stored in
+    struct cdrom_seek_stats *stats; // Where read() counts its seeks, NULL while loading
 } track_file_t;
 
 typedef struct track_t {
@@ -90,9 +104,22 @@ typedef struct track_t {
     track_file_t *file;
 } track_t;
 
+/* Where each track starts, built once the image is loaded so the guest's
+   TOC and subchannel queries are table lookups. The last entry is the lead
+   out. */
+typedef struct cd_toc_t {
+    uint32_t start;
+    uint8_t  track_number;
+    uint8_t  attr;
+    TMSF     msf;         /* start + 150, as the TOC reports it */
+} cd_toc_t;
+
 typedef struct cd_img_t {
-    int      tracks_num;
-    track_t *tracks;
+    int       tracks_num;
+    track_t  *tracks;
+    cd_toc_t *toc;
+    int       toc_hint;   /* TOC entry of the last lookup, tried first */
+    struct cdrom_seek_stats *stats; /* Set before cdi_set_device(), NULL to not count */
 } cd_img_t;
 
 /* Binary file functions. */
@@ -107,7 +134,9 @@ extern int  cdi_get_audio_sub(cd_img_t *cdi, uint32_t sector, uint8_t *attr, uin
 extern int  cdi_read_sector(cd_img_t *cdi, uint8_t *buffer, int raw, uint32_t sector);
 extern int  cdi_read_sectors(cd_img_t *cdi, uint8_t *buffer, int raw, uint32_t sector, uint32_t num);
 extern int  cdi_read_audio_sectors(cd_img_t *cdi, uint8_t *buffer, uint32_t sector, uint32_t count);
+extern int  cdi_read_audio_sectors_async(cd_img_t *cdi, uint8_t *buffer, uint32_t sector, uint32_t count, uint32_t *done);
 extern int  cdi_read_sector_sub(cd_img_t *cdi, uint8_t *buffer, uint32_t sector);
+extern int  cdi_map_sectors(cd_img_t *cdi, int raw, uint32_t sector, uint32_t num, uint32_t *block, uint32_t *offset, uint32_t *stride);
 extern int  cdi_get_sector_size(cd_img_t *cdi, uint32_t sector);
 extern int  cdi_is_mode2(cd_img_t *cdi, uint32_t sector);
 extern int  cdi_get_mode2_form(cd_img_t *cdi, uint32_t sector);
@@ -12,57 +12,6 @@
 // Maximum filename length
 #define MAX_FILENAME_LEN 127
 
-// Node structure for the linked list of CD image files
-typedef struct CDImageNode {
-    char *filename;
-    struct CDImageNode *next;
-} CDImageNode;
-
-static CDImageNode* create_cd_node(const char *filename) {
-    CDImageNode *new_node = malloc(sizeof(CDImageNode));
-    if (!new_node) {
-        return NULL; // Memory allocation failed
-    }
-    
-    // Allocate memory for the filename and copy it
-    new_node->filename = malloc(strlen(filename) + 1);
-    if (!new_node->filename) {
-        free(new_node);
-        return NULL; // Memory allocation failed
-    }
-    
-    strcpy(new_node->filename, filename);
-    new_node->next = NULL;
-    return new_node;
-}
-
-// Add a filename to the sorted list (case insensitive)
-static bool add_cd_image_sorted(CDImageNode **head, const char *filename) {
-    CDImageNode *new_node = create_cd_node(filename);
-    if (!new_node) {
-        return false; // Memory allocation failed
-    }
-    
-    // Case 1: Empty list or new filename should be first
-    if (!*head || strncasecmp(filename, (*head)->filename, MAX_FILENAME_LEN) < 0) {
-        new_node->next = *head;
-        *head = new_node;
-        return true;
-    }
-    
-    // Case 2: Find the correct position to insert
-    CDImageNode *current = *head;
-    while (current->next && strncasecmp(filename, current->next->filename, MAX_FILENAME_LEN) > 0) {
-        current = current->next;
-    }
-    
-    // Insert the new node
-    new_node->next = current->next;
-    current->next = new_node;
-    
-    return true;
-}
-
 static bool isCDImage(const char *filename) {
     int len = strlen(filename);
     if (len <= 4) return false;
@@ -74,135 +23,178 @@ static bool isCDImage(const char *filename) {
             strncasecmp(filename + (len - 4), ".cue", 4) == 0);
 }
 
-// convert linked list to array and free the list
-static char** cd_list_to_array(CDImageNode *head, int *count) {
-    if (!head || !count) {
-        return NULL;
-    }
-    
-    // Count nodes
-    *count = 0;
-    CDImageNode *current = head;
-    while (current) {
-        (*count)++;
-        current = current->next;
+// Catalog of the CD images on the USB drive, built the first time it is
+// needed after the drive is inserted: the names are packed back to back in
+// one block and sorted (case insensitive) through the array of where each
+// one starts, so listing and loading by index never rescan the directory.
+static char *catalog_names;
+static uint32_t *catalog_offsets;
+static int catalog_count = -1; // -1 until built
+
+// The catalog last handed to the guest to list. Core 0 reads it while core 1
+// may be rebuilding the catalog for a new drive, so it stays allocated until
+// the next listing replaces it, even once it is no longer current.
+static char *listed_names;
+static uint32_t *listed_offsets;
+
+static int catalog_compare(const void *a, const void *b) {
+    return strncasecmp(catalog_names + *(const uint32_t *)a,
+                       catalog_names + *(const uint32_t *)b, MAX_FILENAME_LEN);
+}
+
+// Grows *buf to hold at least need bytes, doubling so the directory scan
+// only reallocates a few times
+static bool catalog_reserve(void **buf, uint32_t *size, uint32_t need) {
+    if (need <= *size) {
+        return true;
     }
-    
-    // Allocate array of string pointers
-    char **fileList = (char **)malloc(*count * sizeof(char *));
-    if (!fileList) {
-        return NULL;
+    uint32_t new_size = *size ? *size : 256;
+    while (new_size < need) {
+        new_size *= 2;
     }
-    
-    // Transfer filename ownership from nodes to array and free nodes
-    current = head;
-    int i = 0;
-    while (current) {
-        CDImageNode *temp = current;
-        
-        // Transfer ownership of filename string
-        fileList[i] = current->filename;
-        i++;
-        
-        current = current->next;
-        free(temp); // Only free the node, not the filename
+    void *p = realloc(*buf, new_size);
+    if (!p) {
+        return false;
     }
-    
-    return fileList;
+    *buf = p;
+    *size = new_size;
+    return true;
 }
 
-static void free_cd_list(CDImageNode *head) {
-    CDImageNode *current = head;
-    while (current) {
-        CDImageNode *temp = current;
-        current = current->next;
-        free(temp->filename);
-        free(temp);
+void cdman_catalog_invalidate(void) {
+    if (catalog_names != listed_names) {
+        free(catalog_names);
+        free(catalog_offsets);
     }
+    catalog_names = NULL;
+    catalog_offsets = NULL;
+    catalog_count = -1;
 }
 
-/**
- * Lists files in a directory with .iso and .cue extensions, sorted alphabetically
- * 
- * @param fileCount: Pointer to int that will receive the number of files found
- * @return: Array of strings containing filenames, or NULL on error
- *          Caller needs to free memory with cdman_list_images_free
- */
-char** cdman_list_images(int *fileCount) {
-    if (!fileCount) {
-        return NULL;
-    }
-    
-    *fileCount = 0;
-    
-    // Open the directory
+static bool catalog_build(void) {
     DIR dp;
     FRESULT res = f_opendir(&dp, "");
     if (res != FR_OK) {
         cdrom_errorstr_set("No USB disk or error mounting it");
-        return NULL;
+        return false;
     }
-    
-    CDImageNode *head = NULL;
+
+    uint32_t names_size = 0, names_len = 0, offsets_size = 0;
+    int count = 0;
     FILINFO fno;
-    
-    // Read directory entries and build sorted linked list
     while (1) {
         res = f_readdir(&dp, &fno);
         if (res != FR_OK || fno.fname[0] == 0) {
             break; // End of directory or error
         }
-        
         // Skip directories
-        if (fno.fattrib & AM_DIR) {
+        if ((fno.fattrib & AM_DIR) || !isCDImage(fno.fname)) {
             continue;
         }
-        
-        // Check if it has valid extension and add to sorted list
-        if (isCDImage(fno.fname)) {
-            if (!add_cd_image_sorted(&head, fno.fname)) {
-                // Memory allocation failed, clean up and return error
-                f_closedir(&dp);
-                free_cd_list(head);
-                cdrom_errorstr_set("Memory allocation failed");
-                return NULL;
-            }
+        uint32_t len = strnlen(fno.fname, MAX_FILENAME_LEN) + 1;
+        if (!catalog_reserve((void **)&catalog_names, &names_size, names_len + len) ||
+            !catalog_reserve((void **)&catalog_offsets, &offsets_size, (count + 1) * sizeof(uint32_t))) {
+            f_closedir(&dp);
+            cdman_catalog_invalidate();
+            cdrom_errorstr_set("Memory allocation failed");
+            return false;
         }
+        memcpy(catalog_names + names_len, fno.fname, len - 1);
+        catalog_names[names_len + len - 1] = 0;
+        catalog_offsets[count++] = names_len;
+        names_len += len;
     }
-    
     f_closedir(&dp);
-    
-    if (!head) {
+
+    qsort(catalog_offsets, count, sizeof(uint32_t), catalog_compare);
+    // Give back what the doubling left unused, keeping the larger blocks if
+    // that fails
+    if (count) {
+        char *names = realloc(catalog_names, names_len);
+        if (names) {
+            catalog_names = names;
+        }
+        uint32_t *offsets = realloc(catalog_offsets, count * sizeof(uint32_t));
+        if (offsets) {
+            catalog_offsets = offsets;
+        }
+    }
+    catalog_count = count;
+    DBG_PRINTF("CD image catalog: %d images, %u bytes\n", count, names_len + count * sizeof(uint32_t));
+    return true;
+}
+
+/**
+ * Number of .iso and .cue files on the USB drive, building the catalog if
+ * the drive has changed since it was last built
+ *
+ * @return: Number of images, 0 if there are none or on error (with the
+ *          reason in the CD error string)
+ */
+int cdman_catalog_count(void) {
+    if (catalog_count < 0 && !catalog_build()) {
+        return 0;
+    }
+    if (!catalog_count) {
         cdrom_errorstr_set("No image files on USB disk");
-        return NULL;
     }
-    
-    // Convert linked list to array and clean up list
-    char **fileList = cd_list_to_array(head, fileCount);
-    if (!fileList) {
-        free_cd_list(head);
-        cdrom_errorstr_set("Memory allocation failed");
-        return NULL;
+    return catalog_count;
+}
+
+/**
+ * Name of an image in the catalog, in alphabetical order
+ *
+ * @param index: 0 to cdman_catalog_count() - 1
+ */
+const char *cdman_catalog_name(int index) {
+    return catalog_names + catalog_offsets[index];
+}
+
+/**
+ * Hands the catalog to the guest to list, building it if needed, and frees
+ * the one it listed before. Runs on core 1 while the guest waits for the
+ * list, so core 0 isn't reading the old one.
+ *
+ * @return: Number of images, as cdman_catalog_count()
+ */
+int cdman_catalog_list(void) {
+    if (listed_names != catalog_names) {
+        free(listed_names);
+        free(listed_offsets);
     }
-    
-    return fileList;
+    listed_names = NULL;
+    listed_offsets = NULL;
+    int count = cdman_catalog_count();
+    listed_names = catalog_names;
+    listed_offsets = catalog_offsets;
+    return count;
 }
 
 /**
- * Helper function to free the array returned by cdman_list_images
- * 
- * @param fileList: Array of strings returned by cdman_list_images
- * @param fileCount: Number of files in the array
+ * Name of an image in the list last handed to the guest, for core 0
+ *
+ * @param index: 0 to what cdman_catalog_list() returned - 1
  */
-void cdman_list_images_free(char **fileList, int fileCount) {
-    if (fileList) {
-        for (int i = 0; i < fileCount; i++) {
-            if (fileList[i]) {
-                free(fileList[i]);
-            }
+const char *cdman_listed_name(int index) {
+    return listed_names + listed_offsets[index];
+}
+
+// Index of name in the catalog, -1 if it isn't there
+static int catalog_find(const char *name) {
+    int lo = 0, hi = catalog_count;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        int cmp = strncasecmp(name, cdman_catalog_name(mid), MAX_FILENAME_LEN);
+        if (cmp == 0) {
+            return mid;
+        }
+        if (cmp < 0) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
         }
-        free(fileList);
     }
+    return -1;
 }
 
 static uint8_t current_index, last_loaded_index;
@@ -217,9 +209,8 @@ void cdman_load_image_index(cdrom_t *dev, int imageIndex) {
     if (imageIndex == 0) {
         cdman_unload_image(dev);
     } else {
-        int imageCount;
-        char** images = cdman_list_images(&imageCount);
-        if (!images) {
+        int imageCount = cdman_catalog_count();
+        if (!imageCount) {
             dev->image_command = CD_COMMAND_NONE;
             dev->image_status = CD_STATUS_ERROR;
             return;
@@ -228,36 +219,29 @@ void cdman_load_image_index(cdrom_t *dev, int imageIndex) {
             // Wrap around index for autoadvance
             imageIndex = 1;
         }
-        strncpy(dev->image_path, images[imageIndex - 1], sizeof(dev->image_path) - 1);
+        strncpy(dev->image_path, cdman_catalog_name(imageIndex - 1), sizeof(dev->image_path) - 1);
         dev->image_path[sizeof(dev->image_path) - 1] = '\0';
-        cdman_list_images_free(images, imageCount);
         dev->image_command = CD_COMMAND_IMAGE_LOAD;
     }
     current_index = last_loaded_index = imageIndex;
 }
 
 void cdman_set_image_index(cdrom_t *dev) {
-    int imageCount;
-    char** images = cdman_list_images(&imageCount);
-    if (!images) {
+    if (!cdman_catalog_count()) {
         dev->image_command = CD_COMMAND_NONE;
         dev->image_status = CD_STATUS_ERROR;
         return;
     }
     current_index = 0;
-    for (int i = 0; i < imageCount; ++i) {
-        if (strncasecmp(dev->image_path, images[i], MAX_FILENAME_LEN) == 0) {
-            current_index = last_loaded_index = i + 1;
-            // Copy back the canonical name to image_path with proper case
-            strncpy(dev->image_path, images[i], sizeof(dev->image_path) - 1);
-            dev->image_path[sizeof(dev->image_path) - 1] = '\0';
-            break;
-        }
+    int i = catalog_find(dev->image_path);
+    if (i >= 0) {
+        current_index = last_loaded_index = i + 1;
+        // Copy back the canonical name to image_path with proper case
+        strncpy(dev->image_path, cdman_catalog_name(i), sizeof(dev->image_path) - 1);
+        dev->image_path[sizeof(dev->image_path) - 1] = '\0';
     }
-    cdman_list_images_free(images, imageCount);
 }
 
-
 void cdman_unload_image(cdrom_t *dev) {
     dev->image_path[0] = 0;
     dev->image_command = CD_COMMAND_IMAGE_LOAD;
@@ -285,6 +269,9 @@ void cdman_reload_image(cdrom_t *dev) {
 
 
 void cdman_set_serial(cdrom_t *dev, uint32_t serial) {
+    // A drive was just inserted; its images may have changed even if it is
+    // the same one
+    cdman_catalog_invalidate();
     if (drive_serial == serial) {
         // If we are re-inserting the same drive, maybe advance the disc image
         DBG_PRINTF("Inserting the same drive...\n");
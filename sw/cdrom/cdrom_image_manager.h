@@ -6,8 +6,11 @@
 extern "C" {
 #endif
 
-char** cdman_list_images(int *fileCount);
-void cdman_list_images_free(char **fileList, int fileCount);
+int cdman_catalog_count(void);
+const char *cdman_catalog_name(int index);
+void cdman_catalog_invalidate(void);
+int cdman_catalog_list(void);
+const char *cdman_listed_name(int index);
 
 uint8_t cdman_current_image_index(void);
 void cdman_load_image_index(cdrom_t *dev, int imageIndex);
@@ -24,6 +24,7 @@
  */
 
 #include <ctype.h>
+#include <string.h>
 #include "tusb.h"
 /* #include "bsp/board_api.h" */
 #include "pico/stdlib.h"
@@ -42,6 +43,69 @@ static volatile bool _disk_busy;
 static volatile bool _disk_error;
 static uint8_t mounted_dev;
 
+//------------- Read queue -------------//
+/* Reads are queued here and sent to the drive one at a time, so the CD-ROM
+ * code can start a read and carry on with the main loop while it completes.
+ * FatFS's blocking disk_read() goes through the same queue. */
+#define MSC_QUEUE_LEN 4 // must be a power of 2
+#define MSC_QUEUE_MASK (MSC_QUEUE_LEN - 1)
+/* 2-second timeout — prevents a hung or disconnected USB drive from
+ * locking the firmware forever.  At 44100 Hz stereo, 2 s is far longer
+ * than any legitimate sector read should take over USB Full Speed. */
+#define MSC_IO_TIMEOUT_US 2000000u
+
+typedef struct {
+    uint32_t lba;
+    uint8_t *buff;
+    uint16_t count;
+    msc_read_cb_t cb;
+    void *ctx;
+} msc_request_t;
+
+static msc_request_t msc_queue[MSC_QUEUE_LEN];
+static uint8_t msc_head;      // oldest request, the one in flight when msc_in_flight
+static uint8_t msc_tail;
+static bool msc_in_flight;
+static uint32_t msc_tag;      // identifies the read in flight, so a late completion after a timeout is ignored
+static uint32_t msc_deadline;
+/* A read that timed out is still on the drive's pipe and can land in its
+ * buffer at any time, so nothing else is sent until it does, and the buffer
+ * is reported busy. */
+static uint8_t *msc_stale_buff;
+static uint32_t msc_stale_len;
+static uint32_t msc_stale_tag;
+
+//------------- Sector cache -------------//
+/* FatFS reads the FAT, directories and CUE sheets a sector at a time, and
+ * the same ones over and over while listing and opening images, so its
+ * single-sector reads can be kept in an LRU cache of MSC_CACHE_SECTORS.
+ * Only the USB-only firmware has the RAM for one that pays off: on a stick
+ * with 300 images, listing and loading one took 505 USB reads uncached, 268
+ * with 64 sectors and still 460 with 16, so the sound card firmwares go
+ * without.
+ * Listing or opening an image scans the whole directory, usually more
+ * sectors than the cache holds, and plain LRU would have every scan push
+ * out the last one before it comes round again. So a sector read right
+ * after the one before it goes in at the LRU end instead: a scan then only
+ * recycles one slot and the start of the directory stays cached. Sectors
+ * move to the MRU end when they are read again. */
+#ifndef MSC_CACHE_SECTORS
+#define MSC_CACHE_SECTORS 0
+#endif
+
+#if MSC_CACHE_SECTORS
+#define MSC_CACHE_NONE 0xFFFFFFFFu
+
+static uint8_t msc_cache_data[MSC_CACHE_SECTORS][FF_MAX_SS];
+static uint32_t msc_cache_lba[MSC_CACHE_SECTORS];
+static int32_t msc_cache_used[MSC_CACHE_SECTORS]; // lowest is evicted first
+static int32_t msc_cache_mru;                     // stamps counting up from the MRU end...
+static int32_t msc_cache_lru;                     // ...and down from the LRU end
+static uint32_t msc_cache_next;                   // sector after the last one FatFS read
+#endif
+static uint32_t msc_cache_hits;
+static uint32_t msc_cache_misses;
+
 // define the buffer to be place in USB/DMA memory with correct alignment/cache line size
 CFG_TUH_MEM_SECTION static struct {
   TUH_EPBUF_TYPE_DEF(scsi_inquiry_resp_t, inquiry);
@@ -52,9 +116,124 @@ bool msc_app_init(void)
 {
     _disk_busy = false;
     _disk_error = false;
+    msc_head = msc_tail = 0;
+    msc_in_flight = false;
+    msc_stale_buff = NULL;
+    msc_cache_invalidate();
     return true;
 }
 
+void msc_cache_invalidate(void)
+{
+#if MSC_CACHE_SECTORS
+    for (int i = 0; i < MSC_CACHE_SECTORS; i++) {
+        msc_cache_lba[i] = MSC_CACHE_NONE;
+        msc_cache_used[i] = INT32_MIN;
+    }
+    msc_cache_mru = msc_cache_lru = 0;
+    msc_cache_next = MSC_CACHE_NONE;
+#endif
+}
+
+void msc_cache_stats(uint32_t *hits, uint32_t *misses)
+{
+    *hits = msc_cache_hits;
+    *misses = msc_cache_misses;
+}
+
+static void msc_read_finish(bool ok)
+{
+    msc_request_t const req = msc_queue[msc_head & MSC_QUEUE_MASK];
+    msc_head++;
+    msc_in_flight = false;
+    req.cb(req.ctx, ok);
+}
+
+static bool msc_read_complete(uint8_t dev_addr, tuh_msc_complete_data_t const * cb_data);
+
+static void msc_read_start(void)
+{
+    while (!msc_in_flight && msc_head != msc_tail) {
+        msc_request_t const *req = &msc_queue[msc_head & MSC_QUEUE_MASK];
+        uint8_t const lun = 0;
+        if (msc_stale_buff) {
+            // The drive hasn't finished the read that timed out
+            msc_read_finish(false);
+            continue;
+        }
+        msc_in_flight = true;
+        msc_tag++;
+        msc_deadline = time_us_32() + MSC_IO_TIMEOUT_US;
+        if (!mounted_dev ||
+            !tuh_msc_read10(mounted_dev, lun, req->buff, req->lba, req->count, msc_read_complete, msc_tag)) {
+            DBG_PRINTF("disk_io: could not start read\n");
+            msc_read_finish(false);
+        }
+    }
+}
+
+static bool msc_read_complete(uint8_t dev_addr, tuh_msc_complete_data_t const * cb_data)
+{
+    (void) dev_addr;
+    if (msc_stale_buff && cb_data->user_arg == msc_stale_tag) {
+        DBG_PRINTF("disk_io: timed out read completed\n");
+        msc_stale_buff = NULL;
+        return true;
+    }
+    if (!msc_in_flight || cb_data->user_arg != msc_tag) {
+        // Completion of a read that already timed out
+        return true;
+    }
+    /* Propagate SCSI command status — non-zero CSW status means the drive
+     * reported an error (e.g. medium error, illegal request). */
+    bool const ok = (cb_data->csw->status == 0);
+    if (!ok)
+        DBG_PRINTF("disk_io: SCSI error status %u\n", cb_data->csw->status);
+    msc_read_finish(ok);
+    msc_read_start();
+    return true;
+}
+
+bool msc_read_async(uint32_t lba, uint16_t count, uint8_t *buff, msc_read_cb_t cb, void *ctx)
+{
+    if (!mounted_dev || (uint8_t)(msc_tail - msc_head) >= MSC_QUEUE_LEN) {
+        return false;
+    }
+    msc_queue[msc_tail & MSC_QUEUE_MASK] = (msc_request_t){
+        .lba = lba, .buff = buff, .count = count, .cb = cb, .ctx = ctx
+    };
+    msc_tail++;
+    msc_read_start();
+    return true;
+}
+
+// Fails everything queued, e.g. when the drive is removed
+static void msc_read_abort(void)
+{
+    while (msc_head != msc_tail) {
+        msc_read_finish(false);
+    }
+}
+
+void msc_app_task(void)
+{
+    if (msc_in_flight && (int32_t)(time_us_32() - msc_deadline) >= 0) {
+        DBG_PRINTF("disk_io: timeout waiting for USB transfer\n");
+        msc_request_t const *req = &msc_queue[msc_head & MSC_QUEUE_MASK];
+        msc_stale_buff = req->buff;
+        msc_stale_len = (uint32_t) req->count * FF_MAX_SS;
+        msc_stale_tag = msc_tag;
+        msc_read_finish(false);
+        msc_read_start();
+    }
+}
+
+bool msc_read_busy(const void *buff, uint32_t len)
+{
+    const uint8_t *p = (const uint8_t *) buff;
+    return msc_stale_buff && p < msc_stale_buff + msc_stale_len && msc_stale_buff < p + len;
+}
+
 static bool inquiry_complete_cb(uint8_t dev_addr, tuh_msc_complete_data_t const * cb_data) {
     msc_cbw_t const* cbw = cb_data->cbw;
     msc_csw_t const* csw = cb_data->csw;
@@ -100,6 +279,7 @@ void tuh_msc_mount_cb(uint8_t dev_addr)
         return;
     }
     mounted_dev = dev_addr;  // may not actually be mounted, but does indicate the drive is inserted
+    msc_cache_invalidate();
     uint8_t const lun = 0;
     tuh_msc_inquiry(dev_addr, lun, &scsi_resp.inquiry, inquiry_complete_cb, 0);
 }
@@ -114,6 +294,10 @@ void tuh_msc_umount_cb(uint8_t dev_addr)
 
     // printf("A MassStorage device is unmounted\r\n");
     mounted_dev = 0;
+    msc_stale_buff = NULL;
+    msc_read_abort();
+    msc_cache_invalidate();
+    cdman_catalog_invalidate();
 
     f_unmount("");
 
@@ -124,33 +308,26 @@ void tuh_msc_umount_cb(uint8_t dev_addr)
 // DiskIO
 //--------------------------------------------------------------------+
 
+static uint32_t msc_disk_reads;
+
+uint32_t msc_disk_read_count(void)
+{
+    return msc_disk_reads;
+}
+
 static void wait_for_disk_io(void)
 {
-    /* 2-second timeout — prevents a hung or disconnected USB drive from
-     * locking the firmware forever.  At 44100 Hz stereo, 2 s is far longer
-     * than any legitimate sector read should take over USB Full Speed. */
-    uint32_t deadline = time_us_32() + 2000000u;
     while (_disk_busy) {
         tuh_task();
-        if ((int32_t)(time_us_32() - deadline) >= 0) {
-            DBG_PRINTF("disk_io: timeout waiting for USB transfer\n");
-            _disk_busy = false;
-            _disk_error = true;
-            return;
-        }
+        msc_app_task();
     }
 }
 
-static bool disk_io_complete(uint8_t dev_addr, tuh_msc_complete_data_t const * cb_data)
+static void disk_read_done(void *ctx, bool ok)
 {
-    (void) dev_addr;
-    /* Propagate SCSI command status — non-zero CSW status means the drive
-     * reported an error (e.g. medium error, illegal request). */
-    _disk_error = (cb_data->csw->status != 0);
-    if (_disk_error)
-        DBG_PRINTF("disk_io: SCSI error status %u\n", cb_data->csw->status);
+    (void) ctx;
+    _disk_error = !ok;
     _disk_busy = false;
-    return true;
 }
 
 DSTATUS disk_status (
@@ -177,18 +354,73 @@ DRESULT disk_read (
 )
 {
     (void)pdrv;
-    uint8_t const lun = 0;
 
+    int slot = -1;
+#if MSC_CACHE_SECTORS
+    // Multi-sector reads are file data going straight to the caller's
+    // buffer; caching them would only push out the FAT and directories
+    if (count == 1) {
+        int lru = 0;
+        for (int i = 0; i < MSC_CACHE_SECTORS; i++) {
+            if (msc_cache_lba[i] == sector) {
+                msc_cache_used[i] = ++msc_cache_mru;
+                msc_cache_next = sector + 1;
+                msc_cache_hits++;
+                memcpy(buff, msc_cache_data[i], FF_MAX_SS);
+                return RES_OK;
+            }
+            if (msc_cache_used[i] < msc_cache_used[lru])
+                lru = i;
+        }
+        msc_cache_misses++;
+        slot = lru;
+        msc_cache_lba[slot] = MSC_CACHE_NONE;
+        msc_cache_used[slot] = INT32_MIN;
+    }
+    uint8_t *const dest = slot >= 0 ? msc_cache_data[slot] : buff;
+#else
+    uint8_t *const dest = buff;
+#endif
+
+    msc_disk_reads++;
     _disk_busy = true;
     _disk_error = false;
-    tuh_msc_read10(mounted_dev, lun, buff, sector, (uint16_t) count, disk_io_complete, 0);
+    if (!msc_read_async(sector, (uint16_t) count, dest, disk_read_done, NULL)) {
+        _disk_busy = false;
+        return RES_ERROR;
+    }
     wait_for_disk_io();
+    if (slot < 0) {
+        // A read that timed out can still land in FatFS's buffer, so it
+        // can't be handed back until the drive finishes or goes away
+        while (msc_read_busy(buff, count * FF_MAX_SS)) {
+            tuh_task();
+        }
+    }
 
-    return _disk_error ? RES_ERROR : RES_OK;
+    if (_disk_error)
+        return RES_ERROR;
+#if MSC_CACHE_SECTORS
+    if (slot >= 0) {
+        msc_cache_lba[slot] = sector;
+        msc_cache_used[slot] = (sector == msc_cache_next) ? --msc_cache_lru : ++msc_cache_mru;
+        memcpy(buff, msc_cache_data[slot], FF_MAX_SS);
+    }
+    msc_cache_next = sector + count;
+#endif
+    return RES_OK;
 }
 
 #if FF_FS_READONLY == 0
 
+static bool disk_write_complete(uint8_t dev_addr, tuh_msc_complete_data_t const * cb_data)
+{
+    (void) dev_addr;
+    _disk_error = (cb_data->csw->status != 0);
+    _disk_busy = false;
+    return true;
+}
+
 DRESULT disk_write (
 	BYTE pdrv,			/* Physical drive nmuber to identify the drive */
 	const BYTE *buff,	/* Data to be written */
@@ -199,10 +431,29 @@ DRESULT disk_write (
     (void)pdrv;
     uint8_t const lun = 0;
 
+#if MSC_CACHE_SECTORS
+    for (int i = 0; i < MSC_CACHE_SECTORS; i++) {
+        if (msc_cache_lba[i] - sector < count)
+            msc_cache_lba[i] = MSC_CACHE_NONE;
+    }
+#endif
+
+    // Let queued reads finish first; the drive takes one command at a time
+    while (msc_head != msc_tail) {
+        tuh_task();
+        msc_app_task();
+    }
     _disk_busy = true;
     _disk_error = false;
-    tuh_msc_write10(mounted_dev, lun, buff, sector, (uint16_t) count, disk_io_complete, 0);
-    wait_for_disk_io();
+    tuh_msc_write10(mounted_dev, lun, buff, sector, (uint16_t) count, disk_write_complete, 0);
+    uint32_t deadline = time_us_32() + MSC_IO_TIMEOUT_US;
+    while (_disk_busy) {
+        tuh_task();
+        if ((int32_t)(time_us_32() - deadline) >= 0) {
+            _disk_busy = false;
+            _disk_error = true;
+        }
+    }
 
     return _disk_error ? RES_ERROR : RES_OK;
 }
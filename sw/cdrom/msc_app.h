@@ -27,9 +27,42 @@
 #define MSC_APP_H
 
 #include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Completion callback for msc_read_async(). Runs from tuh_task(), or from
+// msc_app_task() when the drive times out or goes away; ok is false then and
+// on a SCSI error.
+typedef void (*msc_read_cb_t)(void *ctx, bool ok);
 
 bool msc_app_init(void);
 void msc_app_task(void);
 
+// Queues a read of count 512-byte blocks starting at lba into buff and returns
+// straight away. Reads are sent to the drive one at a time, in order, and
+// FatFS's own reads queue up behind them. Returns false if no drive is
+// mounted or the queue is full.
+bool msc_read_async(uint32_t lba, uint16_t count, uint8_t *buff, msc_read_cb_t cb, void *ctx);
+
+// True while a read that timed out can still write to len bytes at buff.
+// Reads fail until the drive finishes it or is removed.
+bool msc_read_busy(const void *buff, uint32_t len);
+
+// Number of reads FatFS has sent to the drive so far, to see what a file
+// operation costs
+uint32_t msc_disk_read_count(void);
+
+// FatFS's single-sector reads are served from a cache of MSC_CACHE_SECTORS
+// sectors, if the firmware has one, emptied when the drive is unmounted
+void msc_cache_invalidate(void);
+void msc_cache_stats(uint32_t *hits, uint32_t *misses);
+
+#ifdef __cplusplus
+}
+#endif
+
 
 #endif
@@ -1,19 +1,65 @@
 #pragma once
 /*
- * Command buffers for CMS and Tandy bus events
+ * Command buffers for CMS, Tandy and OPL bus events
  */
 
+// Tandy and CMS writes, packed into one word each: bits 31..12 hold the low 20
+// bits of psg_sample_clock (output frames played by the PSG audio ISR) when the
+// data byte arrived on the bus, bits 11..8 the low nibble of the port and bits
+// 7..0 the value. Core 1 renders each write on the frame it arrived on plus a
+// fixed latency. The 8-bit indices wrap at PSG_CMD_BUFFER_SIZE, so the queue
+// holds one write less; a write that finds it full is dropped and counted.
+#define PSG_CMD_BUFFER_SIZE 256
+// Above this fill level the renderer applies writes as soon as it sees them
+#define PSG_CMD_HIGH_WATER  (PSG_CMD_BUFFER_SIZE * 3 / 4)
+
 typedef struct cms_buffer_t {
-    struct {
-        uint16_t addr;
-        uint8_t data;
-    } cmds[256];
+    uint32_t cmds[PSG_CMD_BUFFER_SIZE];
     volatile uint8_t head;
     volatile uint8_t tail;
+    uint32_t dropped;   // writes lost because the queue was full
 } cms_buffer_t;
 
 typedef struct tandy_buffer_t {
-    uint8_t cmds[256];
+    uint32_t cmds[PSG_CMD_BUFFER_SIZE];
     volatile uint8_t head;
     volatile uint8_t tail;
+    uint32_t dropped;   // writes lost because the queue was full
 } tandy_buffer_t;
+
+static inline uint32_t psg_cmd_pack(uint32_t time, uint16_t port, uint8_t data) {
+    return (time << 12) | ((uint32_t)(port & 0xF) << 8) | data;
+}
+
+// OPL register writes, packed into one word each: bits 31..17 hold the low 15
+// bits of opl_sample_clock (output frames played by the audio ISR) when the
+// data byte arrived on the bus, bits 16..8 the register (bit 16 = OPL3 bank 1)
+// and bits 7..0 the value. 512 entries fit in the same SRAM as the old 256
+// unpacked ones, which covers the register bursts of a full OPL3 patch load.
+#define OPL_CMD_BUFFER_SIZE 512
+#define OPL_CMD_BUFFER_MASK (OPL_CMD_BUFFER_SIZE - 1)
+// Above this fill level the renderer stops honouring timestamps and applies
+// writes as fast as it can so the producer never has to wait on the bus.
+#define OPL_CMD_HIGH_WATER  (OPL_CMD_BUFFER_SIZE * 3 / 4)
+// Longest a write to a full queue holds IOCHRDY before it is dropped. ISA
+// hosts expect the bus back well within a DRAM refresh period (15.6 us).
+// Writes are only lost when core 1 stops taking them for long enough that the
+// queue fills: over oplbench's 3000 writes/s captures (oplbench -s) none are
+// lost while core 1 stops for up to 80 ms at a time, and at 100 ms the
+// writes of that stop past the 512th are.
+#define OPL_CMD_STALL_US    8
+
+typedef struct opl_buffer_t {
+    uint32_t cmds[OPL_CMD_BUFFER_SIZE];
+    volatile uint16_t head;
+    volatile uint16_t tail;
+    uint32_t near_full; // times the fill level crossed OPL_CMD_HIGH_WATER
+    uint32_t stalls;    // writes that had to hold IOCHRDY until a slot was free
+    uint32_t dropped;   // of those, dropped after OPL_CMD_STALL_US without one
+    // consumer (core 1) side, see opl_cmd_queue.h
+    uint32_t keys;      // key-on bits of the writes taken out so far
+} opl_buffer_t;
+
+static inline uint32_t opl_cmd_pack(uint32_t time, uint16_t addr, uint8_t data) {
+    return (time << 17) | ((uint32_t)(addr & 0x1FF) << 8) | data;
+}
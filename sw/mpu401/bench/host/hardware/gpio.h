@@ -0,0 +1,8 @@
+// Host stand-in for the pico-sdk header, for the MPU-401 clock check build
+#pragma once
+#include "pico/platform.h"
+
+#define GPIO_FUNC_UART 2
+
+static inline void gpio_set_function(unsigned gpio, unsigned fn) { (void)gpio; (void)fn; }
+static inline void gpio_put(unsigned gpio, bool value) { (void)gpio; (void)value; }
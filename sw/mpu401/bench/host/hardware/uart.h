@@ -0,0 +1,12 @@
+// Host stand-in for the pico-sdk header, for the MPU-401 clock check build
+#pragma once
+#include "pico/platform.h"
+
+typedef struct uart_inst uart_inst_t;
+#define uart0 ((uart_inst_t *)0)
+#define PICO_DEFAULT_UART_BAUD_RATE 115200
+#define PICO_DEFAULT_UART_TX_PIN 0
+
+static inline bool uart_is_enabled(uart_inst_t *uart) { (void)uart; return true; }
+static inline void uart_init(uart_inst_t *uart, unsigned baud) { (void)uart; (void)baud; }
+static inline void uart_puts(uart_inst_t *uart, const char *s) { (void)uart; (void)s; }
@@ -0,0 +1,25 @@
+// Host stand-in for the pico-sdk header, for the MPU-401 clock check build
+#pragma once
+#include <stdio.h>
+#include <stdlib.h>
+#include "pico/platform.h"
+
+// Everything runs on one thread, alarms between host port accesses
+typedef struct {
+    bool initialized;
+    bool held;
+} critical_section_t;
+
+static inline void critical_section_init(critical_section_t *crit) { crit->initialized = true; crit->held = false; }
+static inline bool critical_section_is_initialized(critical_section_t *crit) { return crit->initialized; }
+
+static inline void critical_section_enter_blocking(critical_section_t *crit) {
+    // Would spin forever on the RP2040
+    if (crit->held) {
+        fprintf(stderr, "critical section entered while held\n");
+        abort();
+    }
+    crit->held = true;
+}
+
+static inline void critical_section_exit(critical_section_t *crit) { crit->held = false; }
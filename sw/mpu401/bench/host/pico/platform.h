@@ -0,0 +1,8 @@
+// Host stand-in for the pico-sdk header, for the MPU-401 clock check build
+#pragma once
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define __force_inline inline __attribute__((always_inline))
+#define PICO_HIGHEST_IRQ_PRIORITY 0
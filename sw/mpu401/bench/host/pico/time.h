@@ -0,0 +1,33 @@
+// Host stand-in for the pico-sdk header, for the MPU-401 clock check build.
+// The alarm pool is simulated by mpuclock.c.
+#pragma once
+#include "pico/platform.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PICO_TIME_DEFAULT_ALARM_POOL_MAX_TIMERS 16
+
+typedef int32_t alarm_id_t;
+typedef uint64_t absolute_time_t;
+typedef struct alarm_pool alarm_pool_t;
+typedef int64_t (*alarm_callback_t)(alarm_id_t id, void *user_data);
+
+static inline absolute_time_t from_us_since_boot(uint64_t us) { return us; }
+
+uint64_t time_us_64(void);
+alarm_id_t alarm_pool_add_alarm_at(alarm_pool_t *pool, absolute_time_t time, alarm_callback_t callback,
+                                   void *user_data, bool fire_if_past);
+alarm_id_t alarm_pool_add_alarm_in_us(alarm_pool_t *pool, uint64_t us, alarm_callback_t callback,
+                                      void *user_data, bool fire_if_past);
+bool alarm_pool_cancel_alarm(alarm_pool_t *pool, alarm_id_t alarm_id);
+alarm_pool_t *alarm_pool_create_with_unused_hardware_alarm(unsigned max_timers);
+
+static inline unsigned alarm_pool_timer_alarm_num(alarm_pool_t *pool) { (void)pool; return 0; }
+static inline unsigned hardware_alarm_get_irq_num(unsigned alarm_num) { (void)alarm_num; return 0; }
+static inline void irq_set_priority(unsigned num, unsigned priority) { (void)num; (void)priority; }
+
+#ifdef __cplusplus
+}
+#endif
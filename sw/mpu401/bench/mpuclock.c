@@ -0,0 +1,576 @@
+/*
+ * mpuclock.c — host check of the tickless MPU-401 clock against the ticked one
+ *
+ * mpu401.c is built twice: as the firmware builds it, with the tickless
+ * clock that sets MPU401_Event only for ticks with work to do, and with
+ * MPU401_TICKED, which fires it on every tick of the timebase as the clock
+ * did before. Both run the same intelligent-mode session on a simulated
+ * alarm pool, through the real pico_pic.c: a sequencer host polls the data
+ * port, answers track and conductor requests after a random delay, and
+ * every couple of seconds changes the tempo or timebase, stops and restarts
+ * playback, or toggles clock to host.
+ *
+ * The alarm pool follows the pico-sdk: alarms fire in time order; a
+ * negative callback return re-sets the alarm from the time it was set for;
+ * and an alarm added for a time already past is refused, or with
+ * fire_if_past run in place with id 0. With -l, alarms fire up to
+ * max_late_us late, though never after the host's next port access, so the
+ * handler sees a clock past the time its event was set for. With -a, every
+ * nth alarm added for an absolute time finds that time gone, as when the
+ * caller is interrupted for longer than MPU401_CLOCK_MARGIN; adding it again
+ * at once gets through. Taking a critical section that is held already, as
+ * an alarm run in place from under mpu_crit would, aborts.
+ *
+ *   mpuclock [-s first_seed] [-n seeds] [-t seconds] [-l max_late_us] [-a n]
+ *
+ * The MIDI bytes sent and the bytes the host reads must come out the same
+ * from both clocks, each within MPU401_CLOCK_MARGIN us of the other, plus
+ * max_late_us: the tickless clock sets a tick that is already due that far
+ * out, and runs ticks with work that fall inside one alarm's latency
+ * together. With -l the tickless clock also runs with its alarms on time,
+ * and must not take more alarms late than on time: re-setting its event
+ * from the time it fired rather than the time it was set for takes an
+ * early alarm for every late one.
+ *
+ * Running a due tick MPU401_CLOCK_MARGIN late can change which of the
+ * host's port accesses come before the tick's requests, and from there the
+ * sessions part ways. A first difference within PART_WINDOW_US of that,
+ * where the tickless clock set its event MPU401_CLOCK_MARGIN out and the
+ * ticked one sent MIDI or queued data in between, ends the comparison for
+ * that seed and is reported as parted. Any other difference is printed and
+ * exits with status 1.
+ *
+ * Prints one line of key=value results per seed:
+ *   events          MIDI bytes sent plus bytes read by the host
+ *   ticked_alarms   alarms fired with MPU401_TICKED
+ *   alarms          alarms fired by the tickless clock
+ *   on_time_alarms  alarms it fired with none late, with -l
+ *   past_adds       alarms the tickless clock added for a time already past
+ *   max_skew_us     largest time difference between matching events
+ *   parted_us       time the sessions parted, if they did
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pico/time.h"
+#include "system/pico_pic.h"
+#include "export.h"
+
+#define MPU401_CLOCK_MARGIN 50  // As in mpu401.c
+#define MAX_ALARMS          PICO_TIME_DEFAULT_ALARM_POOL_MAX_TIMERS
+#define MAX_EVENTS          (1 << 20)
+#define PART_WINDOW_US      20000
+
+// The ticked build of mpu401.c, its exports renamed
+void  ticked_MPU401_Init(bool delaysysex, bool fakeallnotesoff);
+void  ticked_MPU401_WriteCommand(Bit8u val, bool crit);
+void  ticked_MPU401_WriteData(Bit8u val, bool crit);
+Bit8u ticked_MPU401_ReadData(void);
+Bit8u ticked_MPU401_ReadStatus(void);
+Bit8u ticked_QueueUsed(void);
+
+typedef struct {
+    void (*init)(bool delaysysex, bool fakeallnotesoff);
+    void (*write_command)(Bit8u val, bool crit);
+    void (*write_data)(Bit8u val, bool crit);
+    Bit8u (*read_data)(void);
+    Bit8u (*read_status)(void);
+    Bit8u (*queue_used)(void);
+} mpu_model_t;
+
+static const mpu_model_t ticked = {
+    ticked_MPU401_Init, ticked_MPU401_WriteCommand, ticked_MPU401_WriteData,
+    ticked_MPU401_ReadData, ticked_MPU401_ReadStatus, ticked_QueueUsed
+};
+static const mpu_model_t tickless = {
+    MPU401_Init, MPU401_WriteCommand, MPU401_WriteData,
+    MPU401_ReadData, MPU401_ReadStatus, QueueUsed
+};
+
+// What the host sees: a MIDI byte sent or a byte read from the data port
+typedef struct {
+    uint64_t time;
+    char     kind;
+    uint8_t  val;
+} event_t;
+
+typedef struct {
+    event_t  *events;
+    uint32_t  count;
+    uint32_t  alarms;
+    uint32_t  past_adds;
+    uint64_t *work;      // Ticks that sent MIDI or queued data, with MPU401_TICKED
+    uint32_t  work_count;
+    uint64_t *margins;   // Times MPU401_Event was set MPU401_CLOCK_MARGIN out
+    uint32_t  margin_count;
+} run_t;
+
+static const mpu_model_t *mpu;
+static run_t             *run;
+
+// ---------------------------------------------------------------------------
+// Simulated alarm pool
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    alarm_id_t       id;  // 0 if free
+    uint64_t         time;
+    alarm_callback_t callback;
+    void            *user_data;
+} alarm_t;
+
+static alarm_t    alarms[MAX_ALARMS];
+static alarm_id_t next_id;
+static uint64_t   now_us;
+static uint32_t   late_us;      // Latency of the alarms fired in this host wait
+static uint32_t   max_late_us;
+static uint32_t   late_random;
+static uint32_t   interrupt_every;
+static uint32_t   absolute_adds;
+static uint64_t   interrupted_at;  // Time of the last interrupted add, +1
+
+// Deterministic, so both clocks see the same session
+static uint32_t
+next_random(uint32_t *x)
+{
+    *x ^= *x << 13;
+    *x ^= *x >> 17;
+    *x ^= *x << 5;
+    return *x;
+}
+
+uint64_t
+time_us_64(void)
+{
+    return now_us;
+}
+
+alarm_pool_t *
+alarm_pool_create_with_unused_hardware_alarm(unsigned max_timers)
+{
+    (void) max_timers;
+    return (alarm_pool_t *) alarms;
+}
+
+static alarm_id_t
+add_alarm(absolute_time_t time, alarm_callback_t callback, void *user_data, bool fire_if_past, bool interrupted)
+{
+    for (;;) {
+        if (time > now_us && !interrupted) {
+            for (int i = 0; i < MAX_ALARMS; i++) {
+                if (!alarms[i].id) {
+                    alarms[i] = (alarm_t) { ++next_id, time, callback, user_data };
+                    return next_id;
+                }
+            }
+            return -1;
+        }
+        run->past_adds++;
+        if (!fire_if_past)
+            return 0;
+        const int64_t repeat = callback(0, user_data);
+        if (!repeat)
+            return 0;
+        time        = repeat < 0 ? time + (uint64_t) -repeat : now_us + (uint64_t) repeat;
+        interrupted = false;
+    }
+}
+
+alarm_id_t
+alarm_pool_add_alarm_at(alarm_pool_t *pool, absolute_time_t time, alarm_callback_t callback, void *user_data,
+                        bool fire_if_past)
+{
+    (void) pool;
+    if (!fire_if_past && time == now_us + MPU401_CLOCK_MARGIN && run->margin_count < MAX_EVENTS)
+        run->margins[run->margin_count++] = now_us;
+    // Retrying at once gets through
+    bool interrupted = false;
+    if (interrupt_every && interrupted_at != now_us + 1)
+        interrupted = ++absolute_adds % interrupt_every == 0;
+    if (interrupted)
+        interrupted_at = now_us + 1;
+    return add_alarm(time, callback, user_data, fire_if_past, interrupted);
+}
+
+alarm_id_t
+alarm_pool_add_alarm_in_us(alarm_pool_t *pool, uint64_t us, alarm_callback_t callback, void *user_data,
+                           bool fire_if_past)
+{
+    (void) pool;
+    return add_alarm(now_us + us, callback, user_data, fire_if_past, false);
+}
+
+bool
+alarm_pool_cancel_alarm(alarm_pool_t *pool, alarm_id_t alarm_id)
+{
+    (void) pool;
+    for (int i = 0; i < MAX_ALARMS; i++) {
+        if (alarms[i].id && alarms[i].id == alarm_id) {
+            alarms[i].id = 0;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Fires the alarms due by `until`, in time order, late_us late but no later
+// than `until`
+static void
+run_alarms(uint64_t until)
+{
+    for (;;) {
+        alarm_t *next = NULL;
+        for (int i = 0; i < MAX_ALARMS; i++) {
+            if (alarms[i].id && (!next || alarms[i].time < next->time))
+                next = &alarms[i];
+        }
+        if (!next || next->time > until)
+            return;
+        const alarm_t  a    = *next;
+        const uint64_t fire = a.time + late_us < until ? a.time + late_us : until;
+        next->id            = 0;
+        if (fire > now_us)
+            now_us = fire;
+        run->alarms++;
+        const uint32_t count  = run->count;
+        const uint8_t  queued = mpu->queue_used();
+        const int64_t  repeat = a.callback(a.id, a.user_data);
+        if (repeat) {
+            // Only MPU401_Event re-sets itself
+            if ((run->count != count || mpu->queue_used() > queued) && run->work_count < MAX_EVENTS)
+                run->work[run->work_count++] = now_us;
+            // Re-set under the same id, as the SDK does
+            const uint64_t time = repeat < 0 ? a.time + (uint64_t) -repeat : now_us + (uint64_t) repeat;
+            for (int i = 0; i < MAX_ALARMS; i++) {
+                if (!alarms[i].id) {
+                    alarms[i] = (alarm_t) { a.id, time, a.callback, a.user_data };
+                    break;
+                }
+            }
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// MIDI out, as midi.c provides it
+// ---------------------------------------------------------------------------
+
+volatile bool midi_output_busy;
+
+static void
+log_event(char kind, uint8_t val)
+{
+    if (run->count < MAX_EVENTS)
+        run->events[run->count++] = (event_t) { now_us, kind, val };
+}
+
+void
+MIDI_Init(bool delaysysex, bool fakeallnotesoff)
+{
+    (void) delaysysex;
+    (void) fakeallnotesoff;
+}
+
+bool
+MIDI_Available(void)
+{
+    return true;
+}
+
+uint32_t
+MIDI_BufferFree(void)
+{
+    return 256;
+}
+
+void
+send_midi_bytes(int maxbytes)
+{
+    (void) maxbytes;
+}
+
+void
+MIDI_RawOutByte(Bit8u data)
+{
+    log_event('M', data);
+}
+
+// ---------------------------------------------------------------------------
+// Sequencer host
+// ---------------------------------------------------------------------------
+
+static uint32_t host_random;
+
+static uint32_t
+host_rand(uint32_t n)
+{
+    return next_random(&host_random) % n;
+}
+
+static void
+host_wait(uint32_t us)
+{
+    const uint64_t until = now_us + us;
+    late_us = 0;
+    if (next_random(&late_random) % 4 == 0)
+        late_us = next_random(&late_random) % (max_late_us + 1);
+    run_alarms(until);
+    now_us = until;
+}
+
+static void
+command(uint8_t val)
+{
+    mpu->write_command(val, true);
+    host_wait(8 + host_rand(20));
+}
+
+static void
+data(uint8_t val)
+{
+    mpu->write_data(val, true);
+    host_wait(8 + host_rand(20));
+}
+
+static void
+session(const mpu_model_t *model, uint32_t seed, uint64_t end_us, run_t *out)
+{
+    mpu              = model;
+    run              = out;
+    host_random      = seed;
+    late_random      = seed ^ 0x9e3779b9u;
+    now_us           = 0;
+    absolute_adds    = 0;
+    interrupted_at   = 0;
+    run->count = run->alarms = run->past_adds = 0;
+    run->work_count = run->margin_count = 0;
+    memset(alarms, 0, sizeof(alarms));
+    PIC_Init();
+
+    mpu->init(false, false);
+    host_wait(20000);
+    command(0xff);  // Reset, into intelligent mode
+    host_wait(20000);
+    while (!(mpu->read_status() & 0x80)) {
+        mpu->read_data();
+        host_wait(10);
+    }
+    command(0xe0);  // Tempo
+    data(120);
+    command(0xc8);  // Timebase 192
+    command(0xec);  // Active tracks 0-3
+    data(0x0f);
+    command(0x8f);  // Conductor on
+    command(0xe7);  // Clock to host rate
+    data(0x40);
+    command(0x95);  // Clock to host on
+    command(0x0a);  // Start playback
+
+    uint64_t next_change = 2000000;
+    uint32_t change      = 0;
+    while (now_us < end_us) {
+        if (!(mpu->read_status() & 0x80)) {
+            const uint8_t val = mpu->read_data();
+            log_event('R', val);
+            host_wait(5 + host_rand(40));
+            if (val >= 0xf0 && val <= 0xf7) {
+                // Track data request: a note, an overflow or the end of the track
+                const uint8_t  track = val & 7;
+                const uint32_t r     = host_rand(100);
+                if (r < 3) {
+                    data(0xf8);
+                } else if (r < 4 && track) {
+                    data(host_rand(50));
+                    data(0xfc);
+                } else {
+                    data(host_rand(r < 50 ? 8 : 200));
+                    data(0x90 | track);
+                    data(36 + host_rand(40));
+                    data(host_rand(128));
+                }
+            } else if (val == 0xf9) {
+                // Conductor request: a relative tempo, an overflow or a tempo
+                data(20 + host_rand(200));
+                switch (host_rand(3)) {
+                case 0:
+                    data(0xe0);
+                    data(60 + host_rand(100));
+                    break;
+                case 1:
+                    data(0xf8);
+                    break;
+                default:
+                    data(0xe1);
+                    data(0x30 + host_rand(0x20));
+                    break;
+                }
+            }
+        } else {
+            host_wait(10 + host_rand(20));
+        }
+        if (now_us >= next_change) {
+            next_change += 1500000 + host_rand(1000000);
+            switch (change++ % 6) {
+            case 0:
+                command(0xe0);
+                data(50 + host_rand(150));
+                break;
+            case 1:
+                command(0xc0 | (2 + host_rand(7)));
+                break;
+            case 2:
+                command(0x05);  // Stop, then start again
+                host_wait(300000);
+                command(0xec);
+                data(0x0f);
+                command(0x0a);
+                break;
+            case 3:
+                command(0x94);
+                break;
+            case 4:
+                command(0x95);
+                command(0xe7);
+                data(host_rand(0x100));
+                break;
+            default:
+                command(0xb8);  // Clear play counters
+                command(0xa0 | host_rand(4));
+                break;
+            }
+        }
+    }
+}
+
+// True if the tickless clock set MPU401_Event MPU401_CLOCK_MARGIN out, past
+// a tick that did work with MPU401_TICKED, in the PART_WINDOW_US up to `time`
+static bool
+margin_before(const run_t *ref, const run_t *got, uint64_t time)
+{
+    uint32_t w = 0;
+
+    for (uint32_t m = 0; m < got->margin_count && got->margins[m] <= time; m++) {
+        const uint64_t at = got->margins[m];
+        while (w < ref->work_count && ref->work[w] <= at)
+            w++;
+        if (at + PART_WINDOW_US >= time && w < ref->work_count && ref->work[w] <= at + MPU401_CLOCK_MARGIN)
+            return true;
+    }
+    return false;
+}
+
+// Compares the tickless events with the ticked ones: 0 if they match, 1 if
+// the sessions parted after a tick ran late by the margin, -1 on any other
+// difference
+static int
+compare(uint32_t seed, const run_t *ref, const run_t *got, uint64_t *skew, uint64_t *parted)
+{
+    uint32_t i;
+
+    *skew = 0;
+    for (i = 0; i < ref->count && i < got->count; i++) {
+        const event_t *a = &ref->events[i], *b = &got->events[i];
+        const uint64_t d = a->time > b->time ? a->time - b->time : b->time - a->time;
+        if (a->kind != b->kind || a->val != b->val || d > MPU401_CLOCK_MARGIN + max_late_us)
+            break;
+        if (d > *skew)
+            *skew = d;
+    }
+    if (ref->count >= MAX_EVENTS || got->count >= MAX_EVENTS) {
+        fprintf(stderr, "seed %u: more than %u events\n", seed, MAX_EVENTS);
+        return -1;
+    }
+    if (i == ref->count && i == got->count)
+        return 0;
+
+    *parted = UINT64_MAX;
+    if (i < ref->count)
+        *parted = ref->events[i].time;
+    if (i < got->count && got->events[i].time < *parted)
+        *parted = got->events[i].time;
+    if (margin_before(ref, got, *parted))
+        return 1;
+
+    fprintf(stderr, "seed %u: event %u differs:", seed, i);
+    if (i < ref->count)
+        fprintf(stderr, " ticked %c %02x at %llu us", ref->events[i].kind, ref->events[i].val,
+                (unsigned long long) ref->events[i].time);
+    if (i < got->count)
+        fprintf(stderr, " tickless %c %02x at %llu us", got->events[i].kind, got->events[i].val,
+                (unsigned long long) got->events[i].time);
+    fprintf(stderr, "\n");
+    return -1;
+}
+
+static void
+usage(void)
+{
+    fprintf(stderr, "usage: mpuclock [-s first_seed] [-n seeds] [-t seconds] [-l max_late_us] [-a n]\n");
+    exit(2);
+}
+
+int
+main(int argc, char **argv)
+{
+    uint32_t first = 1, seeds = 8, seconds = 60;
+    int      failed = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-s") && i + 1 < argc)
+            first = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-n") && i + 1 < argc)
+            seeds = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-t") && i + 1 < argc)
+            seconds = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-l") && i + 1 < argc)
+            max_late_us = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-a") && i + 1 < argc)
+            interrupt_every = atoi(argv[++i]);
+        else
+            usage();
+    }
+    if (!seeds || !seconds || !first)
+        usage();
+
+    run_t ref, got, on_time;
+    run_t *runs[] = { &ref, &got, &on_time };
+    for (int i = 0; i < 3; i++) {
+        runs[i]->events  = malloc(MAX_EVENTS * sizeof(event_t));
+        runs[i]->work    = malloc(MAX_EVENTS * sizeof(uint64_t));
+        runs[i]->margins = malloc(MAX_EVENTS * sizeof(uint64_t));
+    }
+    for (uint32_t seed = first; seed < first + seeds; seed++) {
+        const uint64_t end_us = seconds * 1000000ull;
+        uint64_t       skew, parted;
+
+        session(&ticked, seed, end_us, &ref);
+        session(&tickless, seed, end_us, &got);
+        const int diff = compare(seed, &ref, &got, &skew, &parted);
+        if (diff < 0)
+            failed = 1;
+        printf("seed=%u events=%u ticked_alarms=%u alarms=%u", seed, ref.count, ref.alarms, got.alarms);
+        if (max_late_us) {
+            const uint32_t late = max_late_us;
+            max_late_us         = 0;
+            session(&tickless, seed, end_us, &on_time);
+            max_late_us = late;
+            printf(" on_time_alarms=%u", on_time.alarms);
+            if (got.alarms > on_time.alarms) {
+                fprintf(stderr, "seed %u: %u alarms late, %u on time\n", seed, got.alarms, on_time.alarms);
+                failed = 1;
+            }
+        }
+        printf(" past_adds=%u max_skew_us=%llu", got.past_adds, (unsigned long long) skew);
+        if (diff > 0)
+            printf(" parted_us=%llu", (unsigned long long) parted);
+        printf("\n");
+    }
+    for (int i = 0; i < 3; i++) {
+        free(runs[i]->events);
+        free(runs[i]->work);
+        free(runs[i]->margins);
+    }
+    return failed;
+}
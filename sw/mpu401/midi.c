@@ -38,6 +38,8 @@
 #include <util/delay.h>
 */
 #include "hardware/timer.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
 #include "pico/critical_section.h"
 static critical_section_t midi_crit;
 
@@ -143,11 +145,7 @@ __force_inline static void wait_for_uart()
     uart_tx_wait_blocking(uart0);
 }
 
-/* HardMPU: Check UART TX status, returns 0 for ready */
-__force_inline static Bit8u uart_tx_status()
-{
-    return uart_is_writable(uart0) ? 0 : 1;
-}
+static void midi_dma_service(void);
 
 __force_inline static void PlayMsg(Bit8u* msg, Bitu len)
 {
@@ -164,6 +162,10 @@ __force_inline static void PlayMsg(Bit8u* msg, Bitu len)
     }
     uint32_t used = (midi_out_buff.head - midi_out_buff.tail) & RAWBUF_BITS;
     midi_output_busy = used >= (RAWBUF - 2);
+    // PicoGUS: start sending right away if the DMA is idle
+    critical_section_enter_blocking(&midi_crit);
+    midi_dma_service();
+    critical_section_exit(&midi_crit);
 }
 
 __force_inline static void send_midi_byte_now(Bit8u byte) {
@@ -254,91 +256,134 @@ void MIDI_RawOutByte(Bit8u data) {
     }
 }
 
-__force_inline static bool send_midi_byte() {
-    if (uart_tx_status()) return false;   // can't send yet
-    if (midi_out_buff.head == midi_out_buff.tail) return false; // nothing to send
-    /* putchar('s'); */
-    critical_section_enter_blocking(&midi_crit);
-    if (midi.sysex.start) {
-        Bit32u passed_ticks = time_us_32() - midi.sysex.start;
-        if (passed_ticks < midi.sysex.delay) { // still waiting for sysex delay
-            critical_section_exit(&midi_crit);
-            return false; // Don't send data yet
-        }
-    }
-    Bit8u data = midi_out_buff.buffer[midi_out_buff.tail];
-    midi_out_buff.tail = (midi_out_buff.tail + 1) & RAWBUF_BITS;
-    uint32_t used = (midi_out_buff.head - midi_out_buff.tail) & RAWBUF_BITS;
-    midi_output_busy = used >= (RAWBUF - 2);
-    critical_section_exit(&midi_crit);
-
+/* PicoGUS: MIDI out is fed to the UART by DMA straight from midi_out_buff, so
+   it runs at wire speed however busy the core 1 loop is. Each transfer is a
+   short run of the ring, cut after the end of a sysex so the sysex delay can
+   be inserted before the next one; the ring space (and so the DRR status bit)
+   is released as each run completes. */
+#define MIDI_DMA_CHUNK 16
+
+static int midi_dma_chan = -1;
+static uint32_t midi_dma_len;       // ring bytes in the running transfer, 0 when idle
+static bool midi_dma_sysex_end;     // the running transfer ends a delayed sysex
+
+/* Track sysex state for a byte about to be sent. A status byte that ends a
+   sysex is sent as 0xf7 instead. Returns true when the byte ends a sysex that
+   must be followed by a delay. */
+static bool midi_sysex_track(Bit8u* data) {
     if (midi.sysex.status==0xf0) { // Start
-        /* putchar('s'); */
-        if (!(data&0x80)) {
-            /*
-            if (midi.sysex.used==SYSEX_SIZE) {
-                midi.sysex.used = 0;
-                midi.sysex.usedbufs++;
-            }
-            */
-            
-            output_to_uart(data);
-            if (midi.sysex.used < SYSEX_SIZE) midi.sysex.buf[midi.sysex.used] = data;
+        if (!(*data&0x80)) {
+            if (midi.sysex.used < SYSEX_SIZE) midi.sysex.buf[midi.sysex.used] = *data;
             midi.sysex.used++;
-            /* midi.sysex.buf[midi.sysex.used++] = data; */
-            return true;
+            return false;
+        }
+        *data = 0xf7;
+        if (midi.sysex.used < SYSEX_SIZE) midi.sysex.buf[midi.sysex.used] = 0xf7;
+        midi.sysex.used++;
+        midi.sysex.status = 0xf7;
+        /*LOG(LOG_ALL,LOG_NORMAL)("Play sysex; address:%02X %02X %02X, length:%4d, delay:%3d", midi.sysex.buf[5], midi.sysex.buf[6], midi.sysex.buf[7], midi.sysex.used, midi.sysex.delay);*/
+        if (!midi.sysex.start) {
+            return false;
+        }
+        if (midi.sysex.buf[5] == 0x7F) {
+            midi.sysex.delay = 290000; // All Parameters reset (290 ms)
+        } else if (midi.sysex.buf[5] == 0x10 && midi.sysex.buf[6] == 0x00 && midi.sysex.buf[7] == 0x04) {
+            midi.sysex.delay = 145000; // Viking Child (145 ms)
+        } else if (midi.sysex.buf[5] == 0x10 && midi.sysex.buf[6] == 0x00 && midi.sysex.buf[7] == 0x01) {
+            midi.sysex.delay = 30000;  // Dark Sun 1 (30 ms)
         } else {
-            output_to_uart(0xf7);
-            if (midi.sysex.used < SYSEX_SIZE) midi.sysex.buf[midi.sysex.used] = 0xf7;
-            midi.sysex.used++;
-            midi.sysex.status = 0xf7;
-                /*LOG(LOG_ALL,LOG_NORMAL)("Play sysex; address:%02X %02X %02X, length:%4d, delay:%3d", midi.sysex.buf[5], midi.sysex.buf[6], midi.sysex.buf[7], midi.sysex.used, midi.sysex.delay);*/
-            if (midi.sysex.start) {
-                /* if (midi.sysex.usedbufs == 0 && midi.sysex.buf[5] == 0x7F) { */
-                if (midi.sysex.buf[5] == 0x7F) {
-                    midi.sysex.delay = 290000; // All Parameters reset (290 ms)
-                } else if (midi.sysex.buf[5] == 0x10 && midi.sysex.buf[6] == 0x00 && midi.sysex.buf[7] == 0x04) {
-                    midi.sysex.delay = 145000; // Viking Child (145 ms)
-                } else if (midi.sysex.buf[5] == 0x10 && midi.sysex.buf[6] == 0x00 && midi.sysex.buf[7] == 0x01) {
-                    midi.sysex.delay = 30000;  // Dark Sun 1 (30 ms)
-                } else {
-                    // DOSBox formula: (used * 1.25 * 1000 / 3125) + 2 ms = (used * 0.4 + 2) ms
-                    // Convert to µs for time_us_32() comparison
-                    midi.sysex.delay = (Bitu)(midi.sysex.used * 400.0f) + 2000;
-                    if (midi.sysex.extra_delay && midi.sysex.delay < 40000) {
-                        midi.sysex.delay = 40000;
-                    }
-                }
-                midi.sysex.start = time_us_32();  // PicoGUS
+            // DOSBox formula: (used * 1.25 * 1000 / 3125) + 2 ms = (used * 0.4 + 2) ms
+            // Convert to µs for time_us_32() comparison
+            midi.sysex.delay = (Bitu)(midi.sysex.used * 400.0f) + 2000;
+            if (midi.sysex.extra_delay && midi.sysex.delay < 40000) {
+                midi.sysex.delay = 40000;
             }
-            return true;
-            /*LOG(LOG_ALL,LOG_NORMAL)("Sysex message size %d",midi.sysex.used);*/ /* SOFTMPU */
-            /*if (CaptureState & CAPTURE_MIDI) {
-                CAPTURE_AddMidi( true, midi.sysex.used-1, &midi.sysex.buf[1]);
-            }*/ /* SOFTMPU */
         }
+        return true;
     }
-    if (data&0x80) {
-        midi.sysex.status=data;
+    if (*data&0x80) {
+        midi.sysex.status=*data;
         if (midi.sysex.status==0xf0) {
-            output_to_uart(0xf0);
             midi.sysex.used=1;
             midi.sysex.buf[0]=0xf0;
-            /* midi.sysex.usedbufs=0; */
-            return true;
         }
     }
-    
-    output_to_uart(data);   // not sysex
-    return true;
+    return false;
 }
 
-void send_midi_bytes(int maxbytes) {
-    for(int i = 0; i < maxbytes; ++i) {
-        if (!send_midi_byte()) {
+/* Retire a finished transfer and start the next one if the ring has data and
+   no sysex delay is pending. Called with midi_crit held, from the DMA
+   interrupt and from send_midi_bytes(), which also covers callers that spin
+   in a higher priority interrupt than the DMA one. */
+static void midi_dma_service(void) {
+    if (midi_dma_len) {
+        if (dma_channel_is_busy(midi_dma_chan)) return;
+        midi_out_buff.tail = (midi_out_buff.tail + midi_dma_len) & RAWBUF_BITS;
+        midi_dma_len = 0;
+        if (midi_dma_sysex_end) {
+            // the delay runs from the last byte going into the UART FIFO
+            midi.sysex.start = time_us_32();  // PicoGUS
+            midi_dma_sysex_end = false;
+        }
+        uint32_t used = (midi_out_buff.head - midi_out_buff.tail) & RAWBUF_BITS;
+        midi_output_busy = used >= (RAWBUF - 2);
+    }
+
+    if (midi_out_buff.head == midi_out_buff.tail) return; // nothing to send
+    if (midi.sysex.start) {
+        Bit32u passed_ticks = time_us_32() - midi.sysex.start;
+        if (passed_ticks < midi.sysex.delay) return; // still waiting for sysex delay
+    }
+
+    // contiguous run from the tail, ending early after a delayed sysex
+    uint32_t tail = midi_out_buff.tail;
+    uint32_t len = 0;
+    while (len < MIDI_DMA_CHUNK && tail + len < RAWBUF && tail + len != midi_out_buff.head) {
+        if (midi_sysex_track(&midi_out_buff.buffer[tail + len++])) {
+            midi_dma_sysex_end = true;
             break;
         }
     }
+    midi_dma_len = len;
+    dma_channel_transfer_from_buffer_now(midi_dma_chan, &midi_out_buff.buffer[tail], len);
+}
+
+static void __isr midi_dma_irq(void) {
+    if (!dma_channel_get_irq1_status(midi_dma_chan)) return;
+    dma_channel_acknowledge_irq1(midi_dma_chan);
+    critical_section_enter_blocking(&midi_crit);
+    midi_dma_service();
+    critical_section_exit(&midi_crit);
+}
+
+/* Poll MIDI output. Bytes go out by DMA on their own; this only restarts the
+   transfers after a sysex delay, and completes them for callers that spin with
+   the DMA interrupt masked. maxbytes is kept for the existing callers. */
+void send_midi_bytes(int maxbytes) {
+    (void)maxbytes;
+    critical_section_enter_blocking(&midi_crit);
+    midi_dma_service();
+    critical_section_exit(&midi_crit);
+}
+
+static void midi_dma_init(void) {
+    if (midi_dma_chan < 0) {
+        midi_dma_chan = dma_claim_unused_channel(true);
+        dma_channel_config c = dma_channel_get_default_config(midi_dma_chan);
+        channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+        channel_config_set_read_increment(&c, true);
+        channel_config_set_write_increment(&c, false);
+        channel_config_set_dreq(&c, uart_get_dreq(uart0));
+        dma_channel_configure(midi_dma_chan, &c, &uart_get_hw(uart0)->dr, NULL, 0, false);
+        dma_channel_set_irq1_enabled(midi_dma_chan, true);
+        irq_add_shared_handler(DMA_IRQ_1, midi_dma_irq, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+        irq_set_enabled(DMA_IRQ_1, true);
+    } else if (midi_dma_len) {
+        dma_channel_abort(midi_dma_chan);
+        dma_channel_acknowledge_irq1(midi_dma_chan);
+    }
+    midi_dma_len = 0;
+    midi_dma_sysex_end = false;
 }
 
 
@@ -367,6 +412,7 @@ void MIDI_Init(bool delaysysex,bool fakeallnotesoff){
     midi.fakeallnotesoff = fakeallnotesoff;
     midi.available=true;
 
+    midi_dma_init();
     midi_out_buff.head = midi_out_buff.tail = 0;
         
     /* SOFTMPU: Display welcome message on MT-32 */
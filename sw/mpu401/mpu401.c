@@ -72,11 +72,14 @@ static PIC_TimerEvent MPU401_InitEvent = {
     .handler = MPU401_InitHandler
 };
 static uint32_t MPU401_EOIHandler(Bitu val);
+static uint32_t MPU401_EOIEventHandler(Bitu val);
 static PIC_TimerEvent MPU401_EOI = {
-    .handler = MPU401_EOIHandler
+    .handler = MPU401_EOIEventHandler
 };
 static void MPU401_Reset(void);
 static void MPU401_EOIHandlerDispatch(void);
+static void MPU401_SyncClock(void);
+static void MPU401_ScheduleClock(void);
 
 #define MPU401_VERSION  0x15
 #define MPU401_REVISION 0x01
@@ -135,6 +138,11 @@ static struct {
         Bit8u tempo,tempo_rel, tempo_grad;
         Bit8u cth_rate,cth_counter,cth_savecount;
         bool clock_to_host;
+        /* PicoGUS: tickless clock, see MPU401_AdvanceClock() */
+        bool running;           // ticking for playback or clock to host
+        bool in_handler;        // inside MPU401_EventHandler()
+        uint64_t next_tick;     // time of the next tick, us since boot
+        uint64_t fire_at;       // time MPU401_Event is set for, 0 if not set
     } clock;
 } mpu;
 
@@ -164,6 +172,29 @@ __force_inline static void ClrQueue(void) {
     mpu.queue_pos=0;
 }
 
+__force_inline static uint32_t MPU401_TickPeriod(void) {
+    return MPU401_TIMECONSTANT/((mpu.clock.tempo*mpu.clock.timebase*mpu.clock.tempo_rel)/0x40);
+}
+
+/* PicoGUS: first tick one period from now, as when the tick event was added.
+   MPU401_TICKED builds the clock as it was before it went tickless, firing
+   MPU401_Event on every tick; bench/mpuclock checks the two against each
+   other. */
+__force_inline static void MPU401_StartClock(void) {
+    mpu.clock.running=true;
+    mpu.clock.next_tick=time_us_64()+MPU401_TickPeriod();
+#if MPU401_TICKED
+    PIC_AddEvent(&MPU401_Event,MPU401_TickPeriod(),0);
+#endif
+}
+
+__force_inline static void MPU401_StopClock(void) {
+    mpu.clock.running=false;
+#if MPU401_TICKED
+    PIC_RemoveEvent(&MPU401_Event);
+#endif
+}
+
 __force_inline Bit8u MPU401_ReadStatus(void) { /* SOFTMPU */
     critical_section_enter_blocking(&mpu_crit);
     uint8_t ret=0x3f;   /* Bits 6 and 7 clear */
@@ -177,6 +208,7 @@ __force_inline void MPU401_WriteCommand(Bit8u val, bool crit) { /* SOFTMPU */
     if (mpu.mode==M_UART && val!=0xff) return;
     if (crit) {
         critical_section_enter_blocking(&mpu_crit);
+        MPU401_SyncClock();
     }
     Bit8u i; /* SOFTMPU */
     if (mpu.state.reset) {
@@ -197,7 +229,7 @@ __force_inline void MPU401_WriteCommand(Bit8u val, bool crit) { /* SOFTMPU */
         switch (val&0xc) {
             case  0x4:      /* Stop */
                 if (mpu.state.playing && !mpu.clock.clock_to_host)
-                    PIC_RemoveEvent(&MPU401_Event);
+                    MPU401_StopClock();
                 mpu.state.playing=false;
                 for (i=0xb0;i<0xbf;i++) {  /* All notes off */
                     MIDI_RawOutByte(i);
@@ -208,7 +240,7 @@ __force_inline void MPU401_WriteCommand(Bit8u val, bool crit) { /* SOFTMPU */
             case 0x8:       /* Play */
                 /*LOG(LOG_MISC,LOG_NORMAL)("MPU-401:Intelligent mode playback started");*/ /* SOFTMPU */
                 if (!mpu.state.playing && !mpu.clock.clock_to_host)
-                    PIC_AddEvent(&MPU401_Event,MPU401_TIMECONSTANT/((mpu.clock.tempo*mpu.clock.timebase*mpu.clock.tempo_rel)/0x40), 0);
+                    MPU401_StartClock();
                 mpu.state.playing=true;
                 ClrQueue();
                 break;
@@ -239,12 +271,12 @@ __force_inline void MPU401_WriteCommand(Bit8u val, bool crit) { /* SOFTMPU */
             break;
         case 0x94: /* Clock to host */
             if (mpu.clock.clock_to_host && !mpu.state.playing)
-                PIC_RemoveEvent(&MPU401_Event);
+                MPU401_StopClock();
             mpu.clock.clock_to_host=false;
             break;
         case 0x95:
             if (!mpu.clock.clock_to_host && !mpu.state.playing)
-                PIC_AddEvent(&MPU401_Event,MPU401_TIMECONSTANT/((mpu.clock.tempo*mpu.clock.timebase*mpu.clock.tempo_rel)/0x40), 0);
+                MPU401_StartClock();
             mpu.clock.clock_to_host=true;
             break;
         case 0xc2: /* Internal timebase */
@@ -338,12 +370,14 @@ __force_inline void MPU401_WriteCommand(Bit8u val, bool crit) { /* SOFTMPU */
     QueueByte(MSG_MPU_ACK);
 write_command_return:
     if (crit) {
+        MPU401_ScheduleClock();
         critical_section_exit(&mpu_crit);
     }
 }
 
 __force_inline Bit8u MPU401_ReadData(void) { /* SOFTMPU */
     critical_section_enter_blocking(&mpu_crit);
+    MPU401_SyncClock();
     Bit8u ret=MSG_MPU_ACK;  // HardMPU: we shouldn't be running this function if the queue is empty.
     if (mpu.queue_used) {
         if (mpu.queue_pos>=MPU401_QUEUE) mpu.queue_pos-=MPU401_QUEUE;
@@ -378,6 +412,7 @@ __force_inline Bit8u MPU401_ReadData(void) { /* SOFTMPU */
         mpu.state.data_onoff=-1;
         MPU401_EOIHandlerDispatch();
     }
+    MPU401_ScheduleClock();
     critical_section_exit(&mpu_crit);
     return ret;
 }
@@ -401,6 +436,7 @@ __force_inline void MPU401_WriteData(Bit8u val, bool crit) { /* SOFTMPU */
         }
         goto write_return;
     }
+    if (crit) MPU401_SyncClock();
     switch (mpu.state.command_byte) {       /* 0xe# command data */
         case 0x00:
             break;
@@ -577,6 +613,7 @@ __force_inline void MPU401_WriteData(Bit8u val, bool crit) { /* SOFTMPU */
     }
 write_return:
     if (crit) {
+        if (mpu.mode!=M_UART) MPU401_ScheduleClock();
         critical_section_exit(&mpu_crit);
     }
 }
@@ -639,20 +676,17 @@ __force_inline static void UpdateConductor(void) {
     mpu.state.req_mask|=(1<<9);
 }
 
-uint32_t MPU401_EventHandler(Bitu val) {
-    /* SOFTMPU */
-    /* putchar('.'); */
+/* One tick of the sequencer clock */
+__force_inline static void MPU401_Tick(void) {
     Bit8u i;
-    if (mpu.mode==M_UART) return 0;
-    critical_section_enter_blocking(&mpu_crit);
-    if (mpu.state.irq_pending) goto next_event;
-        if (mpu.state.playing) {
+    if (mpu.state.irq_pending) return;
+    if (mpu.state.playing) {
         for (i=0;i<8;i++) { /* Decrease counters */
             if (mpu.state.amask&(1<<i)) {
                 mpu.playbuf[i].counter--;
                 if (mpu.playbuf[i].counter<=0) UpdateTrack(i);
             }
-        }               
+        }
         if (mpu.state.conductor) {
             mpu.condbuf.counter--;
             if (mpu.condbuf.counter<=0) UpdateConductor();
@@ -666,9 +700,142 @@ uint32_t MPU401_EventHandler(Bitu val) {
         }
     }
     if (!mpu.state.irq_pending && mpu.state.req_mask) MPU401_EOIHandler(0);
-next_event:
+}
+
+/* PicoGUS: ticks from the next one until the first that does more than count
+   down a counter; UINT32_MAX if none will */
+static uint32_t MPU401_TicksToEvent(void) {
+    uint32_t ticks=UINT32_MAX;
+    Bits left;
+    Bit8u i;
+    if (mpu.state.req_mask) return 1;
+    if (mpu.state.playing) {
+        for (i=0;i<8;i++) {
+            if (mpu.state.amask&(1<<i)) {
+                left=mpu.playbuf[i].counter>1 ? mpu.playbuf[i].counter : 1;
+                if ((uint32_t)left<ticks) ticks=left;
+            }
+        }
+        if (mpu.state.conductor) {
+            left=mpu.condbuf.counter>1 ? mpu.condbuf.counter : 1;
+            if ((uint32_t)left<ticks) ticks=left;
+        }
+    }
+    if (mpu.clock.clock_to_host) {
+        left=mpu.clock.cth_rate-mpu.clock.cth_counter;
+        if (left<1) left=1;
+        if ((uint32_t)left<ticks) ticks=left;
+    }
+    return ticks;
+}
+
+/* PicoGUS: `ticks` ticks that only count down */
+__force_inline static void MPU401_CountTicks(uint32_t ticks) {
+    Bit8u i;
+    if (mpu.state.playing) {
+        for (i=0;i<8;i++) {
+            if (mpu.state.amask&(1<<i)) mpu.playbuf[i].counter-=ticks;
+        }
+        if (mpu.state.conductor) mpu.condbuf.counter-=ticks;
+    }
+    if (mpu.clock.clock_to_host) mpu.clock.cth_counter+=ticks;
+}
+
+/* PicoGUS: the clock is tickless. Rather than firing MPU401_Event on every tick
+   of the timebase, the ticks that only count down are applied in bulk and the
+   event is set for the first tick that sends data or raises a request. Tick
+   times stay on the same grid as before: each one a tick period (at the
+   tempo of the tick before it) after the previous one. Runs the ticks due by
+   `now`; with `run` false it stops short of the first one with work to do,
+   for callers that must not send MIDI. */
+static void MPU401_AdvanceClock(uint64_t now, bool run) {
+    while (mpu.mode!=M_UART && mpu.clock.running && mpu.clock.next_tick<=now) {
+        uint32_t period=MPU401_TickPeriod();
+        uint32_t ticks=1+(uint32_t)((now-mpu.clock.next_tick)/period);
+        if (!mpu.state.irq_pending) { /* ticks while an IRQ is pending are skipped */
+            uint32_t quiet=MPU401_TicksToEvent()-1;
+            if (ticks>quiet) {
+                MPU401_CountTicks(quiet);
+                mpu.clock.next_tick+=(uint64_t)quiet*period;
+                if (!run) return;
+                MPU401_Tick();
+                mpu.clock.next_tick+=MPU401_TickPeriod();
+                continue;
+            }
+            MPU401_CountTicks(ticks);
+        }
+        mpu.clock.next_tick+=(uint64_t)ticks*period;
+    }
+}
+
+/* PicoGUS: time of the next tick with work to do, 0 if the clock can sleep
+   until the host does something */
+static uint64_t MPU401_NextDeadline(void) {
+    if (mpu.mode==M_UART || !mpu.clock.running || mpu.state.irq_pending) return 0;
+    uint32_t ticks=MPU401_TicksToEvent();
+    if (ticks==UINT32_MAX) return 0;
+    return mpu.clock.next_tick+(uint64_t)(ticks-1)*MPU401_TickPeriod();
+}
+
+/* PicoGUS: bring the counters up to date before the host changes them.
+   Called with mpu_crit held. */
+static void MPU401_SyncClock(void) {
+#if MPU401_TICKED
+    return;
+#endif
+    if (mpu.clock.in_handler) return;
+    MPU401_AdvanceClock(time_us_64(), false);
+}
+
+/* PicoGUS: after the host has changed the state, pull MPU401_Event in if a
+   tick with work to do now comes sooner. A later deadline is left to the
+   event, which works out the next one itself when it fires; so is one that
+   is about to fire. A deadline that is due already is set MPU401_CLOCK_MARGIN
+   out, so the alarm is never in the past when it is added. fire_at is only
+   left set while the event really is pending. Called with mpu_crit held. */
+#define MPU401_CLOCK_MARGIN 50
+static void MPU401_ScheduleClock(void) {
+#if MPU401_TICKED
+    return;
+#endif
+    if (mpu.clock.in_handler) return;
+    uint64_t fire=MPU401_NextDeadline();
+    if (!fire) return;
+    uint64_t earliest=time_us_64()+MPU401_CLOCK_MARGIN;
+    if (fire<earliest) fire=earliest;
+    if (mpu.clock.fire_at) {
+        if (fire>=mpu.clock.fire_at || mpu.clock.fire_at<=earliest) return;
+        PIC_RemoveEvent(&MPU401_Event);
+        mpu.clock.fire_at=0;
+    }
+    if (!PIC_AddEventAt(&MPU401_Event, fire, 0)) {
+        /* interrupted for longer than the margin: try once more from now */
+        fire=time_us_64()+MPU401_CLOCK_MARGIN;
+        if (!PIC_AddEventAt(&MPU401_Event, fire, 0)) return;
+    }
+    mpu.clock.fire_at=fire;
+}
+
+uint32_t MPU401_EventHandler(Bitu val) {
+    /* SOFTMPU */
+    /* putchar('.'); */
+#if MPU401_TICKED
+    if (mpu.mode==M_UART) return 0;
+    critical_section_enter_blocking(&mpu_crit);
+    MPU401_Tick();
+    uint32_t ret=MPU401_TickPeriod();
+#else
+    critical_section_enter_blocking(&mpu_crit);
+    mpu.clock.in_handler=true;
+    MPU401_AdvanceClock(time_us_64(), true);
+    uint64_t fire=MPU401_NextDeadline();
+    /* returned delays count from the time this event was set for */
+    uint32_t ret=fire ? (uint32_t)(fire-mpu.clock.fire_at) : 0;
+    mpu.clock.fire_at=fire;
+    mpu.clock.in_handler=false;
+#endif
     critical_section_exit(&mpu_crit);
-    return MPU401_TIMECONSTANT/((mpu.clock.tempo*mpu.clock.timebase*mpu.clock.tempo_rel)/0x40);
+    return ret;
 }
 
 __force_inline static void MPU401_EOIHandlerDispatch(void) {
@@ -711,13 +878,25 @@ __force_inline uint32_t MPU401_EOIHandler(Bitu val) {
     return 0;
 }
 
+/* PicoGUS: delayed EOI; ending the pending IRQ restarts the clock */
+static uint32_t MPU401_EOIEventHandler(Bitu val) {
+    critical_section_enter_blocking(&mpu_crit);
+    MPU401_SyncClock();
+    MPU401_EOIHandler(0);
+    MPU401_ScheduleClock();
+    critical_section_exit(&mpu_crit);
+    return 0;
+}
+
 static uint32_t  MPU401_ResetDoneHandler(Bitu val) { /* SOFTMPU */
     critical_section_enter_blocking(&mpu_crit);
+    MPU401_SyncClock();
     mpu.state.reset=false;
     if (mpu.state.cmd_pending) {
         MPU401_WriteCommand(mpu.state.cmd_pending-1, false);
         mpu.state.cmd_pending=0;
     }
+    MPU401_ScheduleClock();
     critical_section_exit(&mpu_crit);
     return 0;
 }
@@ -731,6 +910,8 @@ __force_inline static void MPU401_Reset(void) {
     mpu.mode=(mpu.intelligent ? M_INTELLIGENT : M_UART);
     PIC_RemoveEvent(&MPU401_Event);
     PIC_RemoveEvent(&MPU401_EOI);
+    mpu.clock.running=false;
+    mpu.clock.fire_at=0;
     mpu.state.eoi_scheduled=false;
     mpu.state.wsd=false;
     mpu.state.wsm=false;
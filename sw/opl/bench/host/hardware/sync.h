@@ -0,0 +1,5 @@
+// Host stand-in for the pico-sdk header, for the OPL benchmark build
+#pragma once
+
+static inline void __dmb(void) { __sync_synchronize(); }
+static inline void __dsb(void) { __sync_synchronize(); }
@@ -0,0 +1,10 @@
+// Host stand-in for the pico-sdk header, for the OPL benchmark build
+#pragma once
+#include <stdint.h>
+#include <time.h>
+
+static inline uint64_t time_us_64(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u;
+}
@@ -0,0 +1,3 @@
+// Host stand-in for the pico-sdk header, for the OPL benchmark build
+#pragma once
+#include "hardware/sync.h"
@@ -0,0 +1,2 @@
+// Host stand-in for the pico-sdk header, for the OPL benchmark build
+#pragma once
@@ -0,0 +1,158 @@
+// OPL_Pico_* glue for the Nuked OPL3 core (opl3.c), used as the accuracy
+// reference by the host benchmark only; far too slow for the RP2040.
+// Same structure as opl_emu8950_opl3.c.
+
+#include <string.h>
+
+#include "hardware/sync.h"
+#include "hardware/timer.h"
+
+#include "opl3.h"
+#include "opl.h"
+#include "opl_cmd_queue.h"
+
+typedef struct
+{
+    unsigned int rate;        // Number of times the timer is advanced per sec.
+    unsigned int enabled;     // Non-zero if timer is enabled.
+    unsigned int value;       // Last value that was set.
+    uint64_t expire_time;     // Calculated time that timer will expire.
+} opl_timer_t;
+
+static opl3_chip nuked_opl3;
+
+static opl_timer_t timer1 = { 12500, 0, 0, 0 };
+static opl_timer_t timer2 = { 3125, 0, 0, 0 };
+
+// Pre-generation buffer — render PREBUF_SIZE stereo samples at a time, split at
+// the timestamps of queued register writes.
+#define PREBUF_SIZE 128
+static int32_t s_prebuf[2 * PREBUF_SIZE];    // interleaved stereo
+static uint32_t s_prebuf_head = PREBUF_SIZE; // starts empty → triggers fill on first call
+
+// The chip always runs at its own 49716 Hz. With OPL_NATIVE_RATE the other
+// backends synthesise at 44.1 kHz directly, so the reference is resampled to
+// that by Nuked's own interpolator (OPL3_Reset took the rate).
+static void render_prebuf(uint32_t pos, uint32_t count) {
+    for (uint32_t i = pos; i < pos + count; i++) {
+        int16_t buf[2];
+#if OPL_NATIVE_RATE
+        OPL3_GenerateResampled(&nuked_opl3, buf);
+#else
+        OPL3_Generate(&nuked_opl3, buf);
+#endif
+        s_prebuf[2*i+0] = buf[0];
+        s_prebuf[2*i+1] = buf[1];
+    }
+}
+
+static void refill_prebuf(void) {
+    const uint32_t clock = opl_render_clock;
+    for (uint32_t j = 0; j < PREBUF_SIZE; ) {
+        const uint32_t run = opl_cmd_drain(clock, j, PREBUF_SIZE - j, OPL_RENDER_RATE);
+        render_prebuf(j, run);
+        j += run;
+    }
+    s_prebuf_head = 0;
+}
+
+int OPL_Pico_Init(unsigned int port_base)
+{
+    OPL3_Reset(&nuked_opl3, OPL_RENDER_RATE);
+    s_prebuf_head = PREBUF_SIZE;
+    return 1;
+}
+
+unsigned int OPL_Pico_PortRead(opl_port_t port)
+{
+    // OPL3 has 0x00 in its status register, OPL2 0x06
+    unsigned int result = 0x00;
+
+    __dsb();
+    uint64_t pico_time = time_us_64();
+    if (timer1.enabled && pico_time > timer1.expire_time)
+    {
+        result |= 0x80 | 0x40;
+    }
+    if (timer2.enabled && pico_time > timer2.expire_time)
+    {
+        result |= 0x80 | 0x20;
+    }
+
+    return result;
+}
+
+static void OPLTimer_CalculateEndTime(opl_timer_t *timer)
+{
+    if (timer->enabled)
+    {
+        int tics = 0x100 - timer->value;
+        timer->expire_time = time_us_64()
+                           + ((uint64_t) tics * OPL_SECOND) / timer->rate;
+    }
+}
+
+void OPL_Pico_WriteRegister(unsigned int reg_num, unsigned int value)
+{
+    switch (reg_num)
+    {
+        case OPL_REG_TIMER1:
+            timer1.value = value;
+            OPLTimer_CalculateEndTime(&timer1);
+            break;
+
+        case OPL_REG_TIMER2:
+            timer2.value = value;
+            OPLTimer_CalculateEndTime(&timer2);
+            break;
+
+        case OPL_REG_TIMER_CTRL:
+            if (value & 0x80)
+            {
+                timer1.enabled = 0;
+                timer2.enabled = 0;
+            }
+            else
+            {
+                if ((value & 0x40) == 0)
+                {
+                    timer1.enabled = (value & 0x01) != 0;
+                    OPLTimer_CalculateEndTime(&timer1);
+                }
+                if ((value & 0x20) == 0)
+                {
+                    timer2.enabled = (value & 0x02) != 0;
+                    OPLTimer_CalculateEndTime(&timer2);
+                }
+            }
+            break;
+
+        default:
+            OPL3_WriteReg(&nuked_opl3, reg_num, value);
+            break;
+    }
+}
+
+// Mono interface — average of L+R so mono output is at the same level as stereo.
+void OPL_Pico_simple(int32_t *buffer, uint32_t nsamples)
+{
+    for (uint32_t i = 0; i < nsamples; i++)
+    {
+        if (s_prebuf_head >= PREBUF_SIZE)
+            refill_prebuf();
+        buffer[i] = (s_prebuf[2*s_prebuf_head+0] + s_prebuf[2*s_prebuf_head+1]) >> 1;
+        s_prebuf_head++;
+    }
+}
+
+void OPL_Pico_stereo(int32_t *left, int32_t *right, uint32_t nsamples)
+{
+    for (uint32_t i = 0; i < nsamples; i++)
+    {
+        if (s_prebuf_head >= PREBUF_SIZE)
+            refill_prebuf();
+        left[i]  = s_prebuf[2*s_prebuf_head+0];
+        right[i] = s_prebuf[2*s_prebuf_head+1];
+        s_prebuf_head++;
+    }
+}
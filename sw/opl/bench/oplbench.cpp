@@ -0,0 +1,634 @@
+/*
+ * oplbench.cpp — host replay benchmark for the PicoGUS OPL backends
+ *
+ * Replays a VGM/VGZ (YM3812, YM3526, Y8950 and YMF262 commands) or DOSBox
+ * DRO (v0.1 and v2.0) capture through the OPL_Pico_* API of one backend, the
+ * same way the firmware drives it: writes are stamped in 44.1 kHz output
+ * frames, queued in opl_cmd_buffer and drained by the backend's prebuffer
+ * refill (OPL_CMD_BUFFER), which renders 128 native frames per refill.
+ *
+ * One executable is built per backend (see CMakeLists.txt), as every backend
+ * defines the same OPL_Pico_* symbols. oplbench.py runs all of them and
+ * prints the comparison table.
+ *
+ *   oplbench-<backend> <file> [-o out.wav] [-r ref.wav] [-s stall_ms]
+ *
+ * -s stops the consumer for stall_ms once a second, as a USB read on core 1
+ * does, while the writes keep arriving; it then renders the missed blocks
+ * back to back. Writes that find the queue full are lost, as the card only
+ * holds the bus for OPL_CMD_STALL_US, far less than a block.
+ *
+ * -x (ymfm backends only) instead checks the block renderer: the capture is
+ * played into two chips, one rendered with generate() a sample at a time and
+ * one with generate_block(), in runs split at every write and at random
+ * lengths up to a block. Any sample that differs fails the run (exit 1).
+ * Prints block_check_samples and block_check_mismatches.
+ *
+ * Prints one line of key=value results:
+ *   audio_s        length of the rendered audio
+ *   cpu_ms_per_s   host render time per second of audio
+ *   peak_block_us  longest single 128-frame refill
+ *   p99_block_us   99th percentile refill time
+ *   peak_queue     most writes queued at once
+ *   lost_writes    writes that found the queue full
+ * and, with -r, against the reference WAV (same length and alignment, as all
+ * backends go through the same queue latency):
+ *   level_db       output level relative to the reference
+ *   td_err_db      time-domain error after least-squares gain matching
+ *   spec_err_db    distance between the level-normalised Welch magnitude
+ *                  spectra; insensitive to noise and LFO phase differences
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "opl.h"
+#include "opl_cmd_queue.h"
+#include "em_inflate.h"
+#if OPL_BENCH_YMFM
+#include "ymfm_opl.h"
+#endif
+
+#ifndef OPL_BENCH_BACKEND
+#error OPL_BENCH_BACKEND must name the backend
+#endif
+
+opl_buffer_t opl_cmd_buffer;
+volatile uint32_t opl_sample_clock;
+uint32_t opl_render_clock;
+
+static constexpr uint32_t OUTPUT_RATE = OPL_OUTPUT_RATE;
+static constexpr uint32_t BLOCK = 128;   // native frames per OPL_Pico_* call, one prebuffer refill
+
+struct opl_write
+{
+    uint64_t frame;  // 44.1 kHz output frame the write arrives at
+    uint16_t reg;    // bit 8 selects the OPL3 second bank
+    uint8_t val;
+};
+
+// ---------------------------------------------------------------------------
+// File loading
+// ---------------------------------------------------------------------------
+
+static bool load_file(const char *path, std::vector<uint8_t> &buf)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return false;
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    buf.resize(size);
+    bool ok = fread(buf.data(), 1, size, f) == (size_t)size;
+    fclose(f);
+    if (!ok)
+        return false;
+
+    // gzip (.vgz)
+    if (buf.size() >= 18 && buf[0] == 0x1f && buf[1] == 0x8b && buf[2] == 0x08)
+    {
+        std::vector<uint8_t> compressed = buf;
+        const uint8_t *end = &compressed[compressed.size()];
+        uint32_t uncompressed = end[-4] | (end[-3] << 8) | (end[-2] << 16) | ((uint32_t)end[-1] << 24);
+        if (uncompressed > 64 * 1024 * 1024)
+            return false;
+        buf.resize(uncompressed);
+        if (em_inflate(compressed.data(), compressed.size(), buf.data(), buf.size()) == (size_t)-1)
+            return false;
+    }
+    return true;
+}
+
+static uint32_t le16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+static uint32_t le32(const uint8_t *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+// VGM: waits are in 44.1 kHz samples, which are output frames already
+static bool parse_vgm(const std::vector<uint8_t> &buf, std::vector<opl_write> &writes, uint64_t &length)
+{
+    if (buf.size() < 0x40)
+        return false;
+    const uint32_t version = le32(&buf[0x08]);
+    length = le32(&buf[0x18]);
+    uint32_t pos = 0x40;
+    if (version >= 0x150 && le32(&buf[0x34]) != 0)
+        pos = 0x34 + le32(&buf[0x34]);
+
+    uint64_t t = 0;
+    while (pos < buf.size())
+    {
+        const uint8_t cmd = buf[pos];
+        if (cmd == 0x66)
+            break;
+        switch (cmd)
+        {
+            case 0x5A: // YM3812
+            case 0x5B: // YM3526
+            case 0x5C: // Y8950
+            case 0x5E: // YMF262 port 0
+                if (pos + 2 < buf.size())
+                    writes.push_back({t, buf[pos+1], buf[pos+2]});
+                pos += 3;
+                break;
+            case 0x5F: // YMF262 port 1
+                if (pos + 2 < buf.size())
+                    writes.push_back({t, (uint16_t)(0x100 | buf[pos+1]), buf[pos+2]});
+                pos += 3;
+                break;
+            case 0x61:
+                t += le16(&buf[pos+1]);
+                pos += 3;
+                break;
+            case 0x62:
+                t += 735;
+                pos += 1;
+                break;
+            case 0x63:
+                t += 882;
+                pos += 1;
+                break;
+            case 0x67: // data block
+                pos += 7 + le32(&buf[pos+3]);
+                break;
+            case 0x68: // PCM RAM write
+                pos += 12;
+                break;
+            default:
+                if (cmd >= 0x70 && cmd <= 0x7F)
+                {
+                    t += (cmd & 0x0F) + 1;
+                    pos += 1;
+                }
+                else if (cmd >= 0x80 && cmd <= 0x8F)
+                {
+                    t += cmd & 0x0F;
+                    pos += 1;
+                }
+                else if (cmd >= 0x30 && cmd <= 0x3F)
+                    pos += 2;
+                else if ((cmd >= 0x40 && cmd <= 0x4E) || (cmd >= 0x51 && cmd <= 0x5F) || (cmd >= 0xA0 && cmd <= 0xBF))
+                    pos += 3;
+                else if (cmd == 0x4F || cmd == 0x50)
+                    pos += 2;
+                else if (cmd >= 0xC0 && cmd <= 0xDF)
+                    pos += 4;
+                else if (cmd >= 0xE0)
+                    pos += 5;
+                else
+                    pos += 1;
+                break;
+        }
+    }
+    length = std::max<uint64_t>(length, t);
+    return true;
+}
+
+// DOSBox raw OPL capture; delays are in milliseconds
+static bool parse_dro(const std::vector<uint8_t> &buf, std::vector<opl_write> &writes, uint64_t &length)
+{
+    if (buf.size() < 0x1A)
+        return false;
+    const uint32_t major = le16(&buf[0x08]);
+    uint64_t ms = 0;
+    auto at = [&]() { return ms * OUTPUT_RATE / 1000; };
+
+    if (major == 2)
+    {
+        const uint32_t pairs = le32(&buf[0x0C]);
+        const uint8_t short_delay = buf[0x17];
+        const uint8_t long_delay = buf[0x18];
+        const uint8_t codemap_len = buf[0x19];
+        const uint8_t *codemap = &buf[0x1A];
+        uint32_t pos = 0x1A + codemap_len;
+        for (uint32_t i = 0; i < pairs && pos + 1 < buf.size(); i++, pos += 2)
+        {
+            const uint8_t code = buf[pos], val = buf[pos+1];
+            if (code == short_delay)
+                ms += val + 1;
+            else if (code == long_delay)
+                ms += (val + 1) << 8;
+            else if ((code & 0x7F) < codemap_len)
+                writes.push_back({at(), (uint16_t)(codemap[code & 0x7F] | ((code & 0x80) << 1)), val});
+        }
+    }
+    else
+    {
+        // v0.1: the hardware type was written as 1 or 4 bytes depending on
+        // the DOSBox version
+        const uint32_t data_len = le32(&buf[0x10]);
+        uint32_t pos = 0x15;
+        if (buf.size() >= 0x18 && buf[0x15] == 0 && buf[0x16] == 0 && buf[0x17] == 0)
+            pos = 0x18;
+        const uint32_t end = std::min<uint32_t>(buf.size(), pos + data_len);
+        uint16_t bank = 0;
+        while (pos < end)
+        {
+            uint8_t code = buf[pos++];
+            switch (code)
+            {
+                case 0x00:
+                    ms += buf[pos++] + 1;
+                    break;
+                case 0x01:
+                    ms += le16(&buf[pos]) + 1;
+                    pos += 2;
+                    break;
+                case 0x02:
+                case 0x03:
+                    bank = (code & 1) << 8;
+                    break;
+                case 0x04:
+                    code = buf[pos++];
+                    // fall through
+                default:
+                    if (pos < end)
+                        writes.push_back({at(), (uint16_t)(bank | code), buf[pos]});
+                    pos++;
+                    break;
+            }
+        }
+    }
+    length = at();
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// WAV I/O: 16-bit stereo
+// ---------------------------------------------------------------------------
+
+static void write_wav(const char *path, const std::vector<int16_t> &pcm, uint32_t rate)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f)
+    {
+        fprintf(stderr, "cannot write %s\n", path);
+        return;
+    }
+    const uint32_t data_bytes = pcm.size() * 2;
+    uint8_t hdr[44];
+    auto put16 = [&](int o, uint32_t v) { hdr[o] = v; hdr[o+1] = v >> 8; };
+    auto put32 = [&](int o, uint32_t v) { put16(o, v); put16(o + 2, v >> 16); };
+    memcpy(hdr, "RIFF", 4); put32(4, 36 + data_bytes); memcpy(hdr + 8, "WAVEfmt ", 8);
+    put32(16, 16); put16(20, 1); put16(22, 2); put32(24, rate); put32(28, rate * 4);
+    put16(32, 4); put16(34, 16); memcpy(hdr + 36, "data", 4); put32(40, data_bytes);
+    fwrite(hdr, 1, sizeof(hdr), f);
+    fwrite(pcm.data(), 2, pcm.size(), f);
+    fclose(f);
+}
+
+static bool read_wav(const char *path, std::vector<int16_t> &pcm)
+{
+    std::vector<uint8_t> buf;
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return false;
+    fseek(f, 0, SEEK_END);
+    buf.resize(ftell(f));
+    fseek(f, 0, SEEK_SET);
+    bool ok = fread(buf.data(), 1, buf.size(), f) == buf.size();
+    fclose(f);
+    if (!ok || buf.size() < 44 || memcmp(buf.data(), "RIFF", 4) != 0 || le16(&buf[22]) != 2 || le16(&buf[34]) != 16)
+        return false;
+    pcm.resize((buf.size() - 44) / 2);
+    memcpy(pcm.data(), &buf[44], pcm.size() * 2);
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Diff metrics
+// ---------------------------------------------------------------------------
+
+static void fft(std::vector<std::complex<double>> &a)
+{
+    const size_t n = a.size();
+    for (size_t i = 1, j = 0; i < n; i++)
+    {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+        if (i < j)
+            std::swap(a[i], a[j]);
+    }
+    for (size_t len = 2; len <= n; len <<= 1)
+    {
+        const std::complex<double> wl = std::polar(1.0, -2 * M_PI / len);
+        for (size_t i = 0; i < n; i += len)
+        {
+            std::complex<double> w(1);
+            for (size_t k = 0; k < len / 2; k++, w *= wl)
+            {
+                const std::complex<double> u = a[i+k], v = a[i+k+len/2] * w;
+                a[i+k] = u + v;
+                a[i+k+len/2] = u - v;
+            }
+        }
+    }
+}
+
+// Welch power spectrum of the L+R mix
+static std::vector<double> welch(const std::vector<int16_t> &pcm, size_t frames)
+{
+    constexpr size_t N = 4096;
+    std::vector<double> psd(N / 2 + 1, 0.0), window(N);
+    for (size_t i = 0; i < N; i++)
+        window[i] = 0.5 - 0.5 * cos(2 * M_PI * i / N);
+    std::vector<std::complex<double>> a(N);
+    for (size_t start = 0; start + N <= frames; start += N / 2)
+    {
+        for (size_t i = 0; i < N; i++)
+            a[i] = window[i] * (pcm[2*(start+i)] + pcm[2*(start+i)+1]);
+        fft(a);
+        for (size_t k = 0; k <= N / 2; k++)
+            psd[k] += std::norm(a[k]);
+    }
+    return psd;
+}
+
+static double to_db(double ratio)
+{
+    return ratio > 0 ? 10 * log10(ratio) : -999.0;
+}
+
+static void compare(const std::vector<int16_t> &pcm, const std::vector<int16_t> &ref)
+{
+    const size_t n = std::min(pcm.size(), ref.size()) & ~(size_t)1;
+    double xx = 0, rr = 0, xr = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        xx += (double)pcm[i] * pcm[i];
+        rr += (double)ref[i] * ref[i];
+        xr += (double)pcm[i] * ref[i];
+    }
+    const double gain = xx > 0 ? xr / xx : 0;
+    double err = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        const double d = gain * pcm[i] - ref[i];
+        err += d * d;
+    }
+
+    const std::vector<double> px = welch(pcm, n / 2), pr = welch(ref, n / 2);
+    double sx = 0, sr = 0, dist = 0;
+    for (size_t k = 0; k < px.size(); k++)
+    {
+        sx += px[k];
+        sr += pr[k];
+    }
+    for (size_t k = 0; k < px.size() && sx > 0 && sr > 0; k++)
+    {
+        const double d = sqrt(px[k] / sx) - sqrt(pr[k] / sr);
+        dist += d * d;
+    }
+
+    printf(" level_db=%.2f td_err_db=%.1f spec_err_db=%.1f", to_db(xx / rr), to_db(err / rr), to_db(dist));
+}
+
+// ---------------------------------------------------------------------------
+// ymfm block renderer check
+// ---------------------------------------------------------------------------
+
+#if OPL_BENCH_YMFM
+#if USE_YMF3812
+using check_chip_t = ymfm::ym3812;
+#else
+using check_chip_t = ymfm::ymf262;
+#endif
+
+static void check_write(check_chip_t &chip, uint16_t reg, uint8_t val)
+{
+#if USE_YMF3812
+    chip.write_address(reg & 0xFF);
+#else
+    if (reg & 0x100)
+        chip.write_address_hi(reg & 0xFF);
+    else
+        chip.write_address(reg);
+#endif
+    chip.write_data(val);
+}
+
+// Renders the writes through generate() and generate_block() and compares
+// the two sample by sample. Returns false on the first difference.
+static bool block_check(const std::vector<opl_write> &writes, uint64_t end_native)
+{
+    ymfm::ymfm_interface intf_sample, intf_block;
+    check_chip_t by_sample(intf_sample), by_block(intf_block);
+    by_sample.reset();
+    by_block.reset();
+
+    check_chip_t::output_data out[BLOCK];
+    int32_t left[BLOCK], right[BLOCK];
+    uint32_t lcg = 1;
+    uint64_t samples = 0;
+    size_t next = 0;
+    for (uint64_t native = 0; native < end_native; )
+    {
+        while (next < writes.size() && writes[next].frame * OPL_RENDER_RATE / OUTPUT_RATE <= native)
+        {
+            check_write(by_sample, writes[next].reg, writes[next].val);
+            check_write(by_block, writes[next].reg, writes[next].val);
+            next++;
+        }
+        lcg = lcg * 1664525 + 1013904223;
+        uint64_t run = 1 + (lcg >> 8) % BLOCK;
+        if (next < writes.size())
+            run = std::min<uint64_t>(run, writes[next].frame * OPL_RENDER_RATE / OUTPUT_RATE - native);
+        run = std::max<uint64_t>(1, std::min<uint64_t>(run, end_native - native));
+
+        by_sample.generate(out, run);
+#if USE_YMF3812
+        by_block.generate_block(left, run);
+        memcpy(right, left, run * sizeof(int32_t));
+#else
+        by_block.generate_block(left, right, run);
+#endif
+        for (uint32_t i = 0; i < run; i++)
+        {
+#if USE_YMF3812
+            const int32_t want_l = out[i].data[0], want_r = out[i].data[0];
+#else
+            const int32_t want_l = out[i].data[0], want_r = out[i].data[1];
+#endif
+            if (left[i] != want_l || right[i] != want_r)
+            {
+                printf("block_check_samples=%llu block_check_mismatches=1\n", (unsigned long long)samples + i);
+                fprintf(stderr, "generate_block differs at native frame %llu: %d/%d, generate() %d/%d\n",
+                        (unsigned long long)(native + i), left[i], right[i], want_l, want_r);
+                return false;
+            }
+        }
+        samples += run;
+        native += run;
+    }
+    printf("block_check_samples=%llu block_check_mismatches=0\n", (unsigned long long)samples);
+    return true;
+}
+#endif
+
+// ---------------------------------------------------------------------------
+// Replay
+// ---------------------------------------------------------------------------
+
+static void usage()
+{
+    fprintf(stderr, "usage: oplbench-%s <file.vgm|vgz|dro> [-o out.wav] [-r ref.wav] [-s stall_ms] [-x]\n", OPL_BENCH_BACKEND);
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    const char *in = nullptr, *out = nullptr, *ref = nullptr;
+    uint32_t stall_frames = 0;
+    bool check = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "-o") && i + 1 < argc)
+            out = argv[++i];
+        else if (!strcmp(argv[i], "-r") && i + 1 < argc)
+            ref = argv[++i];
+        else if (!strcmp(argv[i], "-s") && i + 1 < argc)
+            stall_frames = atoi(argv[++i]) * OUTPUT_RATE / 1000;
+        else if (!strcmp(argv[i], "-x"))
+            check = true;
+        else if (argv[i][0] != '-' && !in)
+            in = argv[i];
+        else
+            usage();
+    }
+    if (!in)
+        usage();
+
+    std::vector<uint8_t> buf;
+    std::vector<opl_write> writes;
+    uint64_t length = 0;
+    if (!load_file(in, buf))
+    {
+        fprintf(stderr, "cannot read %s\n", in);
+        return 1;
+    }
+    bool parsed = false;
+    if (buf.size() >= 4 && !memcmp(buf.data(), "Vgm ", 4))
+        parsed = parse_vgm(buf, writes, length);
+    else if (buf.size() >= 8 && !memcmp(buf.data(), "DBRAWOPL", 8))
+        parsed = parse_dro(buf, writes, length);
+    if (!parsed)
+    {
+        fprintf(stderr, "%s is not a VGM or DRO file\n", in);
+        return 1;
+    }
+
+    uint32_t dropped = 0;
+#if OPL_BENCH_OPL2
+    // OPL2 backends have no second register bank
+    dropped = std::count_if(writes.begin(), writes.end(), [](const opl_write &w) { return w.reg >= 0x100; });
+    writes.erase(std::remove_if(writes.begin(), writes.end(), [](const opl_write &w) { return w.reg >= 0x100; }), writes.end());
+#endif
+
+    // run past the last write by the queue latency plus half a second of tail
+    if (!writes.empty())
+        length = std::max(length, writes.back().frame);
+    const uint64_t end_frame = length + OPL_CMD_LATENCY + OUTPUT_RATE / 2;
+    const uint64_t end_native = end_frame * OPL_RENDER_RATE / OUTPUT_RATE;
+
+    if (check)
+    {
+#if OPL_BENCH_YMFM
+        return block_check(writes, end_native) ? 0 : 1;
+#else
+        fprintf(stderr, "-x checks ymfm's block renderer; oplbench-%s has none\n", OPL_BENCH_BACKEND);
+        return 2;
+#endif
+    }
+
+    OPL_Pico_Init(0x388);
+
+    std::vector<int16_t> pcm;
+    pcm.reserve(2 * (end_native + BLOCK));
+    std::vector<double> block_us;
+    block_us.reserve(end_native / BLOCK + 1);
+    double total_us = 0;
+    int32_t left[BLOCK], right[BLOCK];
+    size_t next = 0;
+    uint32_t peak_queue = 0, lost = 0;
+
+    for (uint64_t native = 0; native < end_native; native += BLOCK)
+    {
+        // the output frame this block starts at, as the player computes it
+        const uint32_t frame = native * OUTPUT_RATE / OPL_RENDER_RATE;
+        opl_render_clock = frame;
+        opl_sample_clock = frame;
+
+        // a block due while the consumer is stalled is rendered when the
+        // stall ends, so the writes up to then are on the bus already
+        uint64_t now = frame;
+        if (stall_frames && frame % OUTPUT_RATE < stall_frames)
+            now = frame - frame % OUTPUT_RATE + stall_frames;
+
+        // writes that have arrived on the bus by now
+        while (next < writes.size() && writes[next].frame <= now)
+        {
+            const uint16_t level = opl_cmd_buffer.head - opl_cmd_buffer.tail;
+            if (level >= OPL_CMD_BUFFER_SIZE)
+                lost++;
+            else
+            {
+                opl_cmd_buffer.cmds[opl_cmd_buffer.head & OPL_CMD_BUFFER_MASK] =
+                    opl_cmd_pack(writes[next].frame, writes[next].reg, writes[next].val);
+                opl_cmd_buffer.head++;
+                peak_queue = std::max<uint32_t>(peak_queue, level + 1);
+            }
+            next++;
+        }
+
+        const auto t0 = std::chrono::steady_clock::now();
+#if OPL_BENCH_STEREO
+        OPL_Pico_stereo(left, right, BLOCK);
+#else
+        OPL_Pico_simple(left, BLOCK);
+        memcpy(right, left, sizeof(right));
+#endif
+        const double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+        total_us += us;
+        block_us.push_back(us);
+
+        for (uint32_t i = 0; i < BLOCK; i++)
+        {
+            pcm.push_back(std::clamp<int32_t>(left[i], -32768, 32767));
+            pcm.push_back(std::clamp<int32_t>(right[i], -32768, 32767));
+        }
+    }
+
+    if (out)
+        write_wav(out, pcm, OPL_RENDER_RATE);
+
+    const double audio_s = (double)(pcm.size() / 2) / OPL_RENDER_RATE;
+    std::vector<double> sorted = block_us;
+    std::sort(sorted.begin(), sorted.end());
+    printf("backend=%s writes=%zu audio_s=%.2f cpu_ms_per_s=%.2f peak_block_us=%.1f p99_block_us=%.1f",
+           OPL_BENCH_BACKEND, writes.size(), audio_s, total_us / 1000 / audio_s,
+           sorted.empty() ? 0 : sorted.back(), sorted.empty() ? 0 : sorted[sorted.size() * 99 / 100]);
+    printf(" peak_queue=%u lost_writes=%u", peak_queue, lost);
+    if (dropped)
+        printf(" dropped_opl3_writes=%u", dropped);
+
+    if (ref)
+    {
+        std::vector<int16_t> ref_pcm;
+        if (!read_wav(ref, ref_pcm))
+        {
+            fprintf(stderr, "\ncannot read reference %s\n", ref);
+            return 1;
+        }
+        compare(pcm, ref_pcm);
+    }
+    printf("\n");
+    return 0;
+}
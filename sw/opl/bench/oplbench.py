@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+
+"""Runs every oplbench-<backend> from a host build (see CMakeLists.txt) over a
+set of VGM/VGZ/DRO captures and prints one comparison table per capture plus
+a summary. Nuked OPL3 renders the reference each backend is compared to.
+The WAVs are kept in --out for listening.
+
+With --block-check it instead checks that ymfm's generate_block() renders
+every capture bit-exactly as generate() does (oplbench -x), and fails on the
+first difference.
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+
+REFERENCE = "nuked"
+# backends built on ymfm's block renderer
+BLOCK_RENDER = ["ym3812", "ymf262"]
+# backend -> firmware PROJECT_TYPE that uses it
+BACKENDS = {
+    "emu8950": "SB_EMU8950",
+    "emu8950_opl3": "SB_EMU8950_OPL3",
+    "dbopl": "SB_DBOPL3",
+    "ym3812": "SB_YM3812",
+    "ymf262": "SB_YMF262",
+    REFERENCE: "(reference)",
+}
+COLUMNS = [
+    ("cpu_ms_per_s", "CPU ms/s"),
+    ("peak_block_us", "peak us"),
+    ("p99_block_us", "p99 us"),
+    ("peak_queue", "peak queue"),
+    ("lost_writes", "lost writes"),
+    ("level_db", "level dB"),
+    ("td_err_db", "td err dB"),
+    ("spec_err_db", "spec err dB"),
+]
+
+
+def run(exe: str, args: list[str]) -> dict[str, str]:
+    res = subprocess.run([exe] + args, check=True, capture_output=True, text=True)
+    return dict(kv.split("=", 1) for kv in res.stdout.split())
+
+
+def print_table(title: str, rows: list[tuple[str, dict[str, str]]]) -> None:
+    print(title)
+    header = f"  {'backend':<14}{'PROJECT_TYPE':<18}" + "".join(f"{h:>13}" for _, h in COLUMNS)
+    print(header)
+    print("  " + "-" * (len(header) - 2))
+    for backend, result in rows:
+        cells = "".join(f"{result.get(key, '-'):>13}" for key, _ in COLUMNS)
+        note = " (OPL3 writes dropped)" if "dropped_opl3_writes" in result else ""
+        print(f"  {backend:<14}{BACKENDS[backend]:<18}{cells}{note}")
+    print()
+
+
+def block_check(build: str, files: list[str]) -> int:
+    failed = 0
+    for path in files:
+        for backend in BLOCK_RENDER:
+            exe = os.path.join(build, f"oplbench-{backend}")
+            res = subprocess.run([exe, path, "-x"], capture_output=True, text=True)
+            result = dict(kv.split("=", 1) for kv in res.stdout.split())
+            status = "ok" if res.returncode == 0 else "FAILED " + res.stderr.strip()
+            print(f"{path} {backend}: {result.get('block_check_samples', '0')} samples {status}")
+            failed |= res.returncode != 0
+    return 1 if failed else 0
+
+
+def main(argv: list[str]) -> int:
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--build", default="build-oplbench", help="host build directory")
+    parser.add_argument("--out", default="oplbench-out", help="directory for rendered WAVs")
+    parser.add_argument("--stall", type=int, default=0,
+                        help="stop the queue consumer this many ms once a second, as a USB read on core 1 does")
+    parser.add_argument("--block-check", action="store_true",
+                        help="check ymfm's generate_block() against generate() instead of benchmarking")
+    parser.add_argument("files", nargs="+", help="VGM/VGZ/DRO captures")
+    args = parser.parse_args(argv[1:])
+    if args.block_check:
+        return block_check(args.build, args.files)
+
+    backends = [b for b in BACKENDS if os.path.exists(os.path.join(args.build, f"oplbench-{b}"))]
+    if REFERENCE not in backends:
+        print(f"oplbench-{REFERENCE} not found in {args.build}", file=sys.stderr)
+        return 2
+    os.makedirs(args.out, exist_ok=True)
+
+    totals: dict[str, dict[str, float]] = {b: {} for b in backends}
+    for path in args.files:
+        stem = os.path.splitext(os.path.basename(path))[0]
+        ref_wav = os.path.join(args.out, f"{stem}.{REFERENCE}.wav")
+        rows = []
+        for backend in [REFERENCE] + [b for b in backends if b != REFERENCE]:
+            exe = os.path.join(args.build, f"oplbench-{backend}")
+            wav = os.path.join(args.out, f"{stem}.{backend}.wav")
+            extra = ["-s", str(args.stall)] if args.stall else []
+            if backend != REFERENCE:
+                extra += ["-r", ref_wav]
+            result = run(exe, [path, "-o", wav] + extra)
+            rows.append((backend, result))
+            t = totals[backend]
+            t["cpu"] = t.get("cpu", 0.0) + float(result["cpu_ms_per_s"]) * float(result["audio_s"])
+            t["audio"] = t.get("audio", 0.0) + float(result["audio_s"])
+            t["peak"] = max(t.get("peak", 0.0), float(result["peak_block_us"]))
+        print_table(f"{path} ({rows[0][1]['audio_s']} s, {rows[0][1]['writes']} writes)", rows)
+
+    print("summary")
+    print(f"  {'backend':<14}{'PROJECT_TYPE':<18}{'CPU ms/s':>13}{'peak us':>13}")
+    for backend in backends:
+        t = totals[backend]
+        print(f"  {backend:<14}{BACKENDS[backend]:<18}{t['cpu'] / t['audio']:>13.2f}{t['peak']:>13.1f}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
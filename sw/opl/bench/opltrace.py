@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+
+"""Writes synthetic OPL-heavy VGM captures for the queue stress runs of
+oplbench (see oplbench.cpp -s).
+
+  dense.vgm     18 OPL3 channels, every one slid in volume and pitch on each
+                70 Hz tick and retriggered eight times a second
+  patches.vgm   a full OPL3 patch set (all 36 operators) reloaded in one
+                burst at bus speed every 100 ms, on top of dense's music
+"""
+
+import argparse
+import os
+import random
+import struct
+import sys
+
+# Operator register offsets of channels 0-8 in a bank
+OP_OFFSETS = [0, 1, 2, 8, 9, 10, 16, 17, 18]
+RATE = 44100
+TICK = RATE // 70
+
+
+class Vgm:
+    def __init__(self) -> None:
+        self.data = bytearray()
+        self.frames = 0
+
+    def write(self, reg: int, val: int) -> None:
+        self.data += bytes([0x5F if reg & 0x100 else 0x5E, reg & 0xFF, val & 0xFF])
+
+    def wait(self, frames: int) -> None:
+        self.frames += frames
+        while frames:
+            n = min(frames, 0xFFFF)
+            self.data += struct.pack("<BH", 0x61, n)
+            frames -= n
+
+    def save(self, path: str) -> None:
+        header = bytearray(0x100)
+        body = self.data + b"\x66"
+        header[0:4] = b"Vgm "
+        struct.pack_into("<I", header, 0x04, len(header) + len(body) - 4)
+        struct.pack_into("<I", header, 0x08, 0x151)
+        struct.pack_into("<I", header, 0x18, self.frames)
+        struct.pack_into("<I", header, 0x34, len(header) - 0x34)
+        struct.pack_into("<I", header, 0x5C, 14318180)  # YMF262 clock
+        with open(path, "wb") as f:
+            f.write(header + body)
+
+
+def patch(v: Vgm, ch: int, rng: random.Random) -> None:
+    bank, c = (ch // 9) << 8, ch % 9
+    for op in (OP_OFFSETS[c], OP_OFFSETS[c] + 3):
+        for base in (0x20, 0x40, 0x60, 0x80, 0xE0):
+            v.write(bank | (base + op), rng.randrange(256) & (0x07 if base == 0xE0 else 0xFF))
+    v.write(bank | (0xC0 + c), 0x30 | rng.randrange(16))
+
+
+def note(v: Vgm, ch: int, key: int, on: bool) -> None:
+    bank, c = (ch // 9) << 8, ch % 9
+    fnum, block = 0x157 + (key % 12) * 24, 2 + key // 12
+    v.write(bank | (0xA0 + c), fnum)
+    v.write(bank | (0xB0 + c), (0x20 if on else 0) | block << 2 | fnum >> 8)
+
+
+def music(seconds: int, patch_every: int) -> Vgm:
+    rng = random.Random(1)
+    v = Vgm()
+    v.write(0x105, 1)
+    v.write(0x01, 0x20)
+    keys = [0] * 18
+    for tick in range(70 * seconds):
+        if tick % patch_every == 0:
+            for ch in range(18):
+                patch(v, ch, rng)
+        for ch in range(18):
+            if (tick + ch) % 9 == 0:
+                note(v, ch, keys[ch], False)
+                keys[ch] = rng.randrange(48)
+                note(v, ch, keys[ch], True)
+            v.write((ch // 9) << 8 | (0x43 + OP_OFFSETS[ch % 9]), tick + ch)
+            v.write((ch // 9) << 8 | (0xA0 + ch % 9), 0x157 + (keys[ch] % 12) * 24 + tick % 4)
+        v.wait(TICK)
+    return v
+
+
+def main(argv: list[str]) -> int:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--out", default=".", help="directory to write the captures to")
+    parser.add_argument("--seconds", type=int, default=30, help="length of each capture")
+    args = parser.parse_args(argv[1:])
+
+    os.makedirs(args.out, exist_ok=True)
+    music(args.seconds, 70 * args.seconds).save(os.path.join(args.out, "dense.vgm"))
+    music(args.seconds, 7).save(os.path.join(args.out, "patches.vgm"))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
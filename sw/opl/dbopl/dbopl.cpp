@@ -546,6 +546,29 @@ INLINE bool Operator::Silent() const {
 	return true;
 }
 
+//PicoGUS: Silent at the prepared level, and the envelope is off, holding or releasing
+INLINE bool Operator::Fading() const {
+	if ( !ENV_SILENT( currentLevel + volume ) )
+		return false;
+	return state == OFF || state == RELEASE || state == SUSTAIN;
+}
+
+//PicoGUS: Same envelope and phase as running GetSample samples times on a fading operator
+INLINE void Operator::ForwardFading( uint32_t samples ) {
+	waveIndex += waveCurrent * samples;
+	if ( state == RELEASE || ( state == SUSTAIN && !( reg20 & MASK_SUSTAIN ) ) ) {
+		uint64_t index = rateIndex + (uint64_t)releaseAdd * samples;
+		int32_t vol = volume + (int32_t)( index >> RATE_SH );
+		if ( vol >= ENV_MAX ) {
+			volume = ENV_MAX;
+			SetState( OFF );
+		} else {
+			volume = vol;
+			rateIndex = (uint32_t)index & RATE_MASK;
+		}
+	}
+}
+
 INLINE void Operator::Prepare( const Chip* chip )  {
 	currentLevel = (uint32_t)(totalLevel + (int32_t)(chip->tremoloValue & tremoloMask));
 	waveCurrent = waveAdd;
@@ -919,10 +942,27 @@ Channel* Channel::BlockTemplate( Chip* chip, uint32_t samples, int32_t* output )
 		Op( 4 )->Prepare( chip );
 		Op( 5 )->Prepare( chip );
 	}
+	//PicoGUS: Released channels keep running until their envelopes are off.
+	//Once every operator is below the silence limit the output stays zero, so skip to the end
+	if ( mode < sm6Start ) {
+		const Bitu ops = ( mode > sm4Start ) ? 4 : 2;
+		Bitu fading = 0;
+		while ( fading < ops && Op( fading )->Fading() )
+			fading++;
+		if ( fading == ops ) {
+			for ( Bitu o = 0; o < ops; o++ )
+				Op( o )->ForwardFading( samples );
+			//The feedback history fills up with silent samples
+			old[0] = ( samples > 1 ) ? 0 : old[1];
+			old[1] = 0;
+			return ( mode > sm4Start ) ? ( this + 2 ) : ( this + 1 );
+		}
+	}
 	for ( Bitu i = 0; i < samples; i++ ) {
 		//Early out for percussion handlers
 		if ( mode == sm2Percussion ) {
-			GeneratePercussion<false>( chip, output + i );
+			//PicoGUS: Output is always stereo, as in the sm2AM/sm2FM cases below
+			GeneratePercussion<true>( chip, output + i * 2 );
 			continue;	//Prevent some uninitialized value bitching
 		} else if ( mode == sm3Percussion ) {
 			GeneratePercussion<true>( chip, output + i * 2 );
@@ -994,6 +1034,19 @@ Channel* Channel::BlockTemplate( Chip* chip, uint32_t samples, int32_t* output )
 	return nullptr;
 }
 
+//PicoGUS
+Channel* Channel::Next() {
+	if ( synthHandler == &Channel::BlockTemplate< sm2Percussion > ||
+		 synthHandler == &Channel::BlockTemplate< sm3Percussion > )
+		return this + 3;
+	if ( synthHandler == &Channel::BlockTemplate< sm3FMFM > ||
+		 synthHandler == &Channel::BlockTemplate< sm3AMFM > ||
+		 synthHandler == &Channel::BlockTemplate< sm3FMAM > ||
+		 synthHandler == &Channel::BlockTemplate< sm3AMAM > )
+		return this + 2;
+	return this + 1;
+}
+
 /*
 	Chip
 */
@@ -1237,12 +1290,98 @@ void Chip::GenerateBlock3( Bitu total, int32_t* output  ) {
 	}
 }
 
+//PicoGUS
+Channel* Chip::RegChannel( uint32_t reg ) const {
+	Bitu index;
+	Bitu offset = 0;
+	switch ( (reg & 0xf0) >> 4 ) {
+	case 0x20 >> 4:
+	case 0x30 >> 4:
+	case 0x40 >> 4:
+	case 0x50 >> 4:
+	case 0x60 >> 4:
+	case 0x70 >> 4:
+	case 0x80 >> 4:
+	case 0x90 >> 4:
+	case 0xe0 >> 4:
+	case 0xf0 >> 4:
+		index = ( ( reg >> 3) & 0x20 ) | ( reg & 0x1f );
+		offset = OpOffsetTable[ index ];
+		break;
+	case 0xb0 >> 4:
+		if ( reg == 0xbd )
+			break;
+		/* FALLTHROUGH */
+	case 0xa0 >> 4:
+	case 0xc0 >> 4:
+		index = ( ( reg >> 4) & 0x10 ) | ( reg & 0xf );
+		offset = ChanOffsetTable[ index ];
+		break;
+	}
+	if ( !offset )
+		return nullptr;
+	//The operators lie inside their channel
+	return const_cast< Channel* >( chan ) + ( offset - 1 ) / sizeof( Channel );
+}
+
+//PicoGUS
+void Chip::GenerateBlock3( Bitu total, int32_t* output, const BlockWrite* writes, Bitu count, WriteHandler handler ) {
+	memset( output, 0, sizeof(int32_t) * total * 2 );
+	Bitu start = 0;
+	Bitu w = 0;
+	while ( start < total ) {
+		//Everything due at the start of this span, chip-wide writes included
+		for ( ; w < count && writes[ w ].pos <= start; w++ ) {
+			handler( writes[ w ].reg, writes[ w ].val );
+		}
+		//The span runs up to the next chip-wide write, channel writes before it are
+		//applied while generating their channel
+		Bitu end = total;
+		Bitu last = w;
+		for ( ; last < count; last++ ) {
+			if ( !RegChannel( writes[ last ].reg ) ) {
+				end = writes[ last ].pos;
+				break;
+			}
+		}
+		//Channel writes sharing the chip-wide write's sample wait for the next span
+		while ( last > w && writes[ last - 1 ].pos >= end )
+			last--;
+		for ( Bitu pos = start; pos < end; ) {
+			uint32_t samples = ForwardLFO( (uint32_t)( end - pos ) );
+			for ( Channel* ch = chan; ch < chan + 18; ) {
+				Channel* next = ch->Next();
+				Bitu done = pos;
+				for ( Bitu i = w; i < last && writes[ i ].pos < pos + samples; i++ ) {
+					Channel* target = RegChannel( writes[ i ].reg );
+					if ( writes[ i ].pos < pos || target < ch || target >= next )
+						continue;
+					if ( writes[ i ].pos > done ) {
+						(ch->*(ch->synthHandler))( this, (uint32_t)( writes[ i ].pos - done ), output + done * 2 );
+						done = writes[ i ].pos;
+					}
+					handler( writes[ i ].reg, writes[ i ].val );
+				}
+				if ( done < pos + samples ) {
+					(ch->*(ch->synthHandler))( this, (uint32_t)( pos + samples - done ), output + done * 2 );
+				}
+				ch = next;
+			}
+			pos += samples;
+		}
+		w = last;
+		start = end;
+	}
+}
+
 void InitTables(void);
 
 void Chip::Setup( uint32_t rate ) {
 	InitTables();
 
-#if 0
+#if OPL_NATIVE_RATE
+	// Render at the rate asked for (the 44.1 kHz output), scaling the phase,
+	// envelope, LFO and noise steps as upstream DOSBox does
 	double original = OPLRATE;
 //	double original = rate;
 	double scale = original / (double)rate;
@@ -144,6 +144,10 @@ public:
 
 	bool Silent() const;
 	void Prepare( const Chip* chip );
+	//PicoGUS: Inaudible with an envelope that can only fall further
+	bool Fading() const;
+	//PicoGUS: Advance a fading operator by samples without generating them
+	void ForwardFading( uint32_t samples );
 
 	void KeyOn( uint8_t mask);
 	void KeyOff( uint8_t mask);
@@ -194,6 +198,8 @@ struct Channel {
 	//Generate blocks of data in specific modes
 	template<SynthMode mode>
 	Channel* BlockTemplate( Chip* chip, uint32_t samples, int32_t* output );
+	//PicoGUS: First channel after the ones synthHandler generates
+	Channel* Next();
 	Channel();
 };
 
@@ -246,6 +252,19 @@ struct Chip {
 	void GenerateBlock2( Bitu total, int32_t* output );
 	void GenerateBlock3( Bitu total, int32_t* output );
 
+	//PicoGUS: A register write applied at sample pos of a block
+	struct BlockWrite {
+		uint16_t pos;
+		uint16_t reg;
+		uint8_t val;
+	};
+	typedef void ( *WriteHandler )( uint32_t reg, uint8_t val );
+	//PicoGUS: Channel a register belongs to, nullptr for registers of the whole chip
+	Channel* RegChannel( uint32_t reg ) const;
+	//PicoGUS: GenerateBlock3 with writes (sorted by pos) passed to handler at their sample.
+	//Only the channels a write belongs to are split at it, chip-wide writes split the block
+	void GenerateBlock3( Bitu total, int32_t* output, const BlockWrite* writes, Bitu count, WriteHandler handler );
+
 	//Update the synth handlers in all channels
 	void UpdateSynths();
 	void Generate( uint32_t samples );
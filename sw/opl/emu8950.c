@@ -181,6 +181,19 @@ static uint8_t eg_step_tables_fast[4][8] = {
 static uint32_t ml_table[16] = {1, 1 * 2, 2 * 2, 3 * 2, 4 * 2, 5 * 2, 6 * 2, 7 * 2,
                                 8 * 2, 9 * 2, 10 * 2, 10 * 2, 12 * 2, 12 * 2, 15 * 2, 15 * 2};
 
+#if OPL_NATIVE_RATE
+#if EMU8950_LINEAR
+#error OPL_NATIVE_RATE is only implemented for the per-sample (non EMU8950_LINEAR) path
+#endif
+/* Generating at opl->rate below the native clk/72: phase steps use ml_table
+ * scaled by (clk/72)/rate in Q16, and pg_phase carries NATIVE_PHASE_BITS extra
+ * fraction bits so the scaled step is not truncated. The product is shifted
+ * down before the block shift so it stays within 32 bits. */
+#define NATIVE_ML_SHIFT 16
+#define NATIVE_PHASE_BITS 8
+static uint32_t native_ml_table[16];
+#endif
+
 #endif
 
 #if !EMU8950_NO_TLL
@@ -200,10 +213,14 @@ static int16_t kl_tablex16[16] = {dB2x16(0.000), dB2x16(9.000), dB2x16(12.000),
 #endif
 
 #if !EMU8950_NO_TLL
-#ifdef EMU8950_TLL_FLASH
-extern const uint32_t tll_table[8 * 16][1 << TL_BITS][4];
+#ifdef EMU8950_TLL_KSL
+// makeTllTable() without the TL term, which is added at lookup (512 bytes
+// instead of 128 KB), see tll_ksl_table.c
+extern const uint8_t tll_ksl_table[8 * 16][4];
+#define TLL(blk_fnum, TL, KL) ((uint32_t)tll_ksl_table[(blk_fnum) >> 6][KL] + TL2EG(TL))
 #else
 static uint32_t tll_table[8 * 16][1 << TL_BITS][4];
+#define TLL(blk_fnum, TL, KL) tll_table[(blk_fnum) >> 6][TL][KL]
 #endif
 #endif
 static int32_t rks_table[2][32][2];
@@ -372,7 +389,7 @@ static void makeSinTable(void) {
 }
 
 static void makeTllTable(void) {
-#if !EMU8950_NO_TLL && !defined(EMU8950_TLL_FLASH)
+#if !EMU8950_NO_TLL && !defined(EMU8950_TLL_KSL)
     int32_t tmp;
     int32_t fnum, block, TL, KL, kx;
 
@@ -523,9 +540,9 @@ static void commit_slot_update(OPL_SLOT *slot, uint8_t notesel) {
     if (slot->update_requests & UPDATE_TLL) {
 #if !EMU8950_NO_TLL
         if ((slot->type & 1) == 0) {
-          slot->tll = tll_table[slot->blk_fnum >> 6][slot->patch->TL][slot->patch->KL];
+          slot->tll = TLL(slot->blk_fnum, slot->patch->TL, slot->patch->KL);
         } else {
-          slot->tll = tll_table[slot->blk_fnum >> 6][slot->patch->TL][slot->patch->KL];
+          slot->tll = TLL(slot->blk_fnum, slot->patch->TL, slot->patch->KL);
         }
 #else
         static const uint8_t kslrom4[16] = {
@@ -829,9 +846,15 @@ static INLINE void calc_phase(OPL_SLOT *slot, int32_t pm_phase, uint8_t pm_mode,
     if (reset) {
         slot->pg_phase = 0;
     }
+#if OPL_NATIVE_RATE
+    slot->pg_phase += ((((slot->fnum & 0x3ff) + pm) * native_ml_table[slot->patch->ML]) >> (1 + NATIVE_ML_SHIFT - NATIVE_PHASE_BITS)) << slot->blk;
+    slot->pg_phase &= (DP_WIDTH << NATIVE_PHASE_BITS) - 1;
+    slot->pg_out = slot->pg_phase >> (DP_BASE_BITS + NATIVE_PHASE_BITS);
+#else
     slot->pg_phase += (((slot->fnum & 0x3ff) + pm) * ml_table[slot->patch->ML]) << slot->blk >> 1;
     slot->pg_phase &= (DP_WIDTH - 1);
     slot->pg_out = slot->pg_phase >> DP_BASE_BITS;
+#endif
 }
 
 static INLINE uint8_t lookup_attack_step(OPL_SLOT *slot, uint32_t counter) {
@@ -923,6 +946,25 @@ static void update_slots(OPL *opl) {
     }
 }
 
+#if OPL_NATIVE_RATE
+/* Run the LFO, noise and envelopes for the chip ticks owed when generating
+ * below the native rate, so their timing matches clk/72. */
+static void update_native_ticks(OPL *opl) {
+    int i;
+    opl->native_frac += opl->native_step;
+    if (opl->native_frac < opl->rate) {
+        return;
+    }
+    opl->native_frac -= opl->rate;
+    update_ampm(opl);
+    update_noise(opl, 14);
+    opl->eg_counter++;
+    for (i = 0; i < 18; i++) {
+        calc_envelope(&opl->slot[i], opl->eg_counter, opl_test_flag(opl) & 1);
+    }
+}
+#endif
+
 #endif
 /* input: 0..8191 output: -4095..4095 */
 static int16_t lookup_exp_table(int16_t i) {
@@ -1137,6 +1179,9 @@ static void update_output(OPL *opl) {
     update_short_noise(opl);
 #endif
     update_slots(opl);
+#if OPL_NATIVE_RATE
+    update_native_ticks(opl);
+#endif
 
     out = opl->ch_out;
 
@@ -1303,8 +1348,13 @@ void OPL_reset(OPL *opl) {
         return;
 
 #if EMU8950_NO_RATECONV
-    // no useful fields to preserve
-    memset(opl, 0, sizeof(*opl));
+    // only the clock and rate are preserved
+    {
+        const uint32_t clk = opl->clk, rate = opl->rate;
+        memset(opl, 0, sizeof(*opl));
+        opl->clk = clk;
+        opl->rate = rate;
+    }
 #else
     // some fields are not reset
     opl->adr = 0;
@@ -1332,6 +1382,13 @@ void OPL_reset(OPL *opl) {
 #endif
 
     reset_rate_conversion_params(opl);
+#if OPL_NATIVE_RATE
+    opl->native_step = opl->clk / 72 - opl->rate;
+    opl->native_frac = 0;
+    for (i = 0; i < 16; i++) {
+        native_ml_table[i] = (uint32_t)((((uint64_t)ml_table[i] * (opl->clk / 72) << NATIVE_ML_SHIFT) + opl->rate / 2) / opl->rate);
+    }
+#endif
 
     for (i = 0; i < 18; i++) {
         reset_slot(&opl->slot[i], i);
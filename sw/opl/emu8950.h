@@ -98,6 +98,10 @@ typedef struct __OPL {
 #endif
 
   uint32_t eg_counter;
+#if OPL_NATIVE_RATE
+  uint32_t native_step; /* chip ticks owed per output sample beyond one, in 1/rate */
+  uint32_t native_frac;
+#endif
 
   uint32_t pm_phase;
   uint32_t pm_dphase;
@@ -0,0 +1,631 @@
+/**
+ * YMF262 (OPL3) engine on top of the emu8950 slot renderer
+ * Copyright (C) 2001-2020 Mitsutaka Okazaki
+ * Copyright (C) 2021-2022 Graham Sanderson
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#if USE_EMU8950_OPL3
+#include "emu8950_opl3.h"
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#ifndef INLINE
+#if defined(_MSC_VER)
+#define INLINE __inline
+#elif defined(__GNUC__)
+#define INLINE __inline__
+#else
+#define INLINE inline
+#endif
+#endif
+
+#if !EMU8950_SLOT_RENDER || !EMU8950_LINEAR || !EMU8950_NO_WAVE_TABLE_MAP
+#error the OPL3 engine requires EMU8950_SLOT_RENDER, EMU8950_LINEAR and EMU8950_NO_WAVE_TABLE_MAP
+#endif
+#if OPL_NATIVE_RATE
+#error OPL_NATIVE_RATE is not implemented for the OPL3 engine
+#endif
+
+#if PICO_ON_DEVICE
+#include "pico.h"
+#else
+#define __not_in_flash_func(x) x
+#endif
+
+#define TL2EG(tl) ((tl) << 2)
+
+/* amplitude lfo table, as emu8950 */
+static uint8_t am_table[210] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,  //
+                                2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,  //
+                                4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5,  //
+                                6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7,  //
+                                8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9,  //
+                                10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, //
+                                12, 12, 12, 12, 12, 12, 12, 12,                                 //
+                                13, 13, 13,                                                     //
+                                12, 12, 12, 12, 12, 12, 12, 12,                                 //
+                                11, 11, 11, 11, 11, 11, 11, 11, 10, 10, 10, 10, 10, 10, 10, 10, //
+                                9, 9, 9, 9, 9, 9, 9, 9, 8, 8, 8, 8, 8, 8, 8, 8,  //
+                                7, 7, 7, 7, 7, 7, 7, 7, 6, 6, 6, 6, 6, 6, 6, 6,  //
+                                5, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4,  //
+                                3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2,  //
+                                1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0};
+
+// shared with emu8950, see tll_ksl_table.c
+extern const uint8_t tll_ksl_table[8 * 16][4];
+static int32_t rks_table[2][32][2];
+static uint8_t table_initialized = 0;
+
+#define min(i, j) (((i) < (j)) ? (i) : (j))
+
+// slot renderer entry points (slot_render.cpp); these return the number of samples rendered,
+// which is less than nsamples if the slot went silent
+uint32_t slot_mod_linear(OPL3 *opl, OPL3_SLOT *slot, uint32_t nsamples, uint32_t eg_counter, uint32_t pm_phase);
+uint32_t slot_car_linear_alg0(OPL3 *opl, OPL3_SLOT *slot, uint32_t nsamples, uint32_t eg_counter, uint32_t pm_phase);
+uint32_t slot_car_linear_alg1(OPL3 *opl, OPL3_SLOT *slot, uint32_t nsamples, uint32_t eg_counter, uint32_t pm_phase);
+uint32_t slot_chain_linear(OPL3 *opl, OPL3_SLOT *slot, uint32_t nsamples, uint32_t eg_counter, uint32_t pm_phase);
+uint32_t slot_index_linear(OPL3 *opl, OPL3_SLOT *slot, uint32_t nsamples, uint32_t eg_counter, uint32_t pm_phase);
+void slot_rhythm_phases(OPL3_SLOT *hh, OPL3_SLOT *cym, uint32_t *noise, int16_t *hh_index, int16_t *sd_index,
+                        int16_t *cym_index, uint32_t nsamples, uint32_t pm_phase);
+
+static void makeRksTable(void) {
+    int fnum8, fnum9, blk;
+    int blk_fnum98;
+    for (fnum8 = 0; fnum8 < 2; fnum8++)
+        for (fnum9 = 0; fnum9 < 2; fnum9++)
+            for (blk = 0; blk < 8; blk++) {
+                blk_fnum98 = (blk << 2) | (fnum9 << 1) | fnum8;
+                rks_table[0][blk_fnum98][1] = (blk << 1) + fnum9;
+                rks_table[0][blk_fnum98][0] = blk >> 1;
+                rks_table[1][blk_fnum98][1] = (blk << 1) + (fnum9 & fnum8);
+                rks_table[1][blk_fnum98][0] = blk >> 1;
+            }
+}
+
+/*********************************************************
+
+                      Slots
+
+*********************************************************/
+#define SLOT_BD1 12
+#define SLOT_HH 14
+#define SLOT_SD 15
+#define SLOT_TOM 16
+#define SLOT_CYM 17
+
+#define MOD(o, x) (&(o)->slot[(x) << 1])
+#define CAR(o, x) (&(o)->slot[((x) << 1) | 1])
+#define BIT(s, b) (((s) >> (b)) & 1)
+
+enum SLOT_UPDATE_FLAG
+{
+    UPDATE_TLL = 2,
+    UPDATE_RKS = 4,
+    UPDATE_EG = 8,
+    UPDATE_ALL = 255,
+};
+
+// first channel of each 4-op pair, by 0x104 bit
+static const uint8_t four_op_channel[6] = {0, 1, 2, 9, 10, 11};
+
+static INLINE void request_update(OPL3_SLOT *slot, int flag) {
+    slot->update_requests |= flag;
+}
+
+static INLINE int get_parameter_rate(OPL3_SLOT *slot) {
+    switch (slot->eg_state) {
+        case ATTACK:
+            return slot->patch->AR;
+        case DECAY:
+            return slot->patch->DR;
+        case SUSTAIN:
+            return slot->patch->EG ? 0 : slot->patch->RR;
+        case RELEASE:
+            return slot->patch->RR;
+        default:
+            return 0;
+    }
+}
+
+static void commit_slot_update(OPL3_SLOT *slot, uint8_t notesel) {
+    if (slot->update_requests & UPDATE_TLL) {
+        slot->tll = tll_ksl_table[slot->blk_fnum >> 6][slot->patch->KL] + TL2EG(slot->patch->TL);
+    }
+
+    if (slot->update_requests & UPDATE_RKS) {
+        slot->rks = rks_table[notesel][slot->blk_fnum >> 8][slot->patch->KR];
+    }
+
+    if (slot->update_requests & (UPDATE_RKS | UPDATE_EG)) {
+        int p_rate = get_parameter_rate(slot);
+
+        if (p_rate == 0) {
+            slot->eg_shift = 0;
+            slot->eg_rate_h = 0;
+            slot->eg_rate_l = 0;
+        } else {
+            slot->eg_rate_h = min(15, p_rate + (slot->rks >> 2));
+            slot->eg_rate_l = slot->rks & 3;
+            if (slot->eg_state == ATTACK) {
+                slot->eg_shift = (0 < slot->eg_rate_h && slot->eg_rate_h < 12) ? (12 - slot->eg_rate_h) : 0;
+            } else {
+                slot->eg_shift = (slot->eg_rate_h < 12) ? (12 - slot->eg_rate_h) : 0;
+            }
+        }
+    }
+
+    slot->update_requests = 0;
+}
+
+static void reset_slot(OPL3_SLOT *slot) {
+    slot->patch = &(slot->__patch);
+    memset(slot->patch, 0, sizeof(OPL_PATCH));
+    slot->eg_state = RELEASE;
+    slot->eg_out = EG_MUTE;
+}
+
+static INLINE void slotOn(OPL3 *opl, int i) {
+    OPL3_SLOT *slot = &opl->slot[i];
+    slot->rks = rks_table[opl->notesel][slot->blk_fnum >> 8][slot->patch->KR];
+    if (min(15, slot->patch->AR + (slot->rks >> 2)) == 15) {
+        slot->eg_state = DECAY;
+        slot->eg_out = 0;
+    } else {
+        slot->eg_state = ATTACK;
+    }
+    if (!slot->pg_keep) {
+        slot->pg_phase = 0;
+    }
+    request_update(slot, UPDATE_EG);
+}
+
+static INLINE void slotOff(OPL3 *opl, int i) {
+    OPL3_SLOT *slot = &opl->slot[i];
+    slot->eg_state = RELEASE;
+    request_update(slot, UPDATE_EG);
+}
+
+static INLINE uint8_t *ch_reg(OPL3 *opl, int ch, int reg) {
+    return &opl->reg[(ch >= 9 ? 0x100 : 0) + reg + (ch % 9)];
+}
+
+static void update_key_status(OPL3 *opl) {
+    uint64_t new_slot_key_status = 0;
+    uint64_t updated_status;
+    int ch;
+
+    for (ch = 0; ch < 18; ch++) {
+        // the second channel of a 4-op pair is keyed by the first
+        int key_ch = opl->ch_type[ch] == OPL3_CH_4OP2 ? ch - 3 : ch;
+        if (*ch_reg(opl, key_ch, 0xb0) & 0x20)
+            new_slot_key_status |= 3ull << (ch * 2);
+    }
+
+    if (opl->rhythm) {
+        const uint8_t r14 = opl->reg[0xbd];
+        if (r14 & 0x10)
+            new_slot_key_status |= 3ull << SLOT_BD1;
+
+        if (r14 & 0x01)
+            new_slot_key_status |= 1ull << SLOT_HH;
+
+        if (r14 & 0x08)
+            new_slot_key_status |= 1ull << SLOT_SD;
+
+        if (r14 & 0x04)
+            new_slot_key_status |= 1ull << SLOT_TOM;
+
+        if (r14 & 0x02)
+            new_slot_key_status |= 1ull << SLOT_CYM;
+    }
+
+    updated_status = opl->slot_key_status ^ new_slot_key_status;
+
+    if (updated_status) {
+        int i;
+        for (i = 0; i < 36; i++)
+            if (BIT(updated_status, i)) {
+                if (BIT(new_slot_key_status, i)) {
+                    slotOn(opl, i);
+                } else {
+                    slotOff(opl, i);
+                }
+            }
+    }
+
+    opl->slot_key_status = new_slot_key_status;
+}
+
+// fnum and block of a channel; the second channel of a 4-op pair follows the first
+static void update_frequency(OPL3 *opl, int ch) {
+    int src = opl->ch_type[ch] == OPL3_CH_4OP2 ? ch - 3 : ch;
+    int fnum = *ch_reg(opl, src, 0xa0) | ((*ch_reg(opl, src, 0xb0) & 3) << 8);
+    int blk = (*ch_reg(opl, src, 0xb0) >> 2) & 7;
+    for (int i = 0; i < 2; i++) {
+        OPL3_SLOT *slot = &opl->slot[ch * 2 + i];
+        slot->fnum = fnum;
+        slot->blk = blk;
+        slot->blk_fnum = (blk << 10) | fnum;
+        request_update(slot, UPDATE_EG | UPDATE_RKS | UPDATE_TLL);
+    }
+}
+
+// channel types, 4-op feedback and output routing all depend on NEW, 0x104, 0xBD and C0
+static void update_channels(OPL3 *opl) {
+    int ch;
+    for (ch = 0; ch < 18; ch++) {
+        opl->ch_type[ch] = OPL3_CH_2OP;
+    }
+    if (opl->newm) {
+        for (int i = 0; i < 6; i++) {
+            if (opl->connsel & (1 << i)) {
+                opl->ch_type[four_op_channel[i]] = OPL3_CH_4OP;
+                opl->ch_type[four_op_channel[i] + 3] = OPL3_CH_4OP2;
+            }
+        }
+    }
+    if (opl->rhythm) {
+        opl->ch_type[6] = opl->ch_type[7] = opl->ch_type[8] = OPL3_CH_RHYTHM;
+    }
+    opl->slot[SLOT_HH].pg_keep = opl->slot[SLOT_CYM].pg_keep = opl->rhythm;
+
+    for (ch = 0; ch < 18; ch++) {
+        uint8_t c0 = *ch_reg(opl, ch, 0xc0);
+        // operator 3 of a 4-op channel is modulated by operator 2, not by itself
+        MOD(opl, ch)->patch->FB = opl->ch_type[ch] == OPL3_CH_4OP2 ? 0 : (c0 >> 1) & 7;
+        opl->ch_alg[ch] = c0 & 1;
+        if (opl->newm) {
+            opl->ch_out[ch] = ((c0 >> 4) & 1 ? OPL3_OUT_LEFT : 0) | ((c0 >> 5) & 1 ? OPL3_OUT_RIGHT : 0);
+        } else {
+            opl->ch_out[ch] = OPL3_OUT_CENTER;
+        }
+        update_frequency(opl, ch);
+    }
+    update_key_status(opl);
+}
+
+/***********************************************************
+
+                   External Interfaces
+
+***********************************************************/
+
+OPL3 *OPL3_new(uint32_t clk, uint32_t rate) {
+    OPL3 *opl;
+
+    if (!table_initialized) {
+        makeRksTable();
+        table_initialized = 1;
+    }
+
+    opl = (OPL3 *) calloc(sizeof(OPL3), 1);
+    if (opl == NULL)
+        return NULL;
+
+    opl->clk = clk;
+    opl->rate = rate;
+    OPL3_reset(opl);
+
+    return opl;
+}
+
+void OPL3_delete(OPL3 *opl) {
+    free(opl);
+}
+
+void OPL3_reset(OPL3 *opl) {
+    if (!opl)
+        return;
+
+    // only the clock and rate are preserved
+    {
+        const uint32_t clk = opl->clk, rate = opl->rate;
+        memset(opl, 0, sizeof(*opl));
+        opl->clk = clk;
+        opl->rate = rate;
+    }
+    opl->noise = 1;
+    for (int i = 0; i < 36; i++) {
+        reset_slot(&opl->slot[i]);
+    }
+    update_channels(opl);
+}
+
+void OPL3_writeReg(OPL3 *opl, uint32_t reg, uint8_t data) {
+    static const int8_t stbl[32] = {0, 2, 4, 1, 3, 5, -1, -1, 6, 8, 10, 7, 9, 11, -1, -1,
+                                    12, 14, 16, 13, 15, 17, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1};
+    const int bank = (reg >> 8) & 1;
+    const uint8_t r = reg & 0xff;
+    int s, c;
+
+    reg &= 0x1ff;
+    opl->reg[reg] = data;
+
+    if (reg == 0x105) {
+        opl->newm = data & 1;
+        update_channels(opl);
+    } else if (reg == 0x104) {
+        opl->connsel = data & 0x3f;
+        update_channels(opl);
+    } else if (reg == 0x08) {
+        opl->notesel = (data >> 6) & 1;
+    } else if (0x20 <= r && r < 0x40) {
+        s = stbl[r - 0x20];
+        if (s >= 0) {
+            OPL3_SLOT *slot = &opl->slot[s + bank * 18];
+            slot->patch->AM = (data >> 7) & 1;
+            slot->patch->PM = (data >> 6) & 1;
+            slot->patch->EG = (data >> 5) & 1;
+            slot->patch->KR = (data >> 4) & 1;
+            slot->patch->ML = (data) & 15;
+            request_update(slot, UPDATE_ALL);
+        }
+    } else if (0x40 <= r && r < 0x60) {
+        s = stbl[r - 0x40];
+        if (s >= 0) {
+            OPL3_SLOT *slot = &opl->slot[s + bank * 18];
+            slot->patch->TL = (data) & 63;
+            slot->patch->KL = (data >> 6) & 3;
+            request_update(slot, UPDATE_ALL);
+        }
+    } else if (0x60 <= r && r < 0x80) {
+        s = stbl[r - 0x60];
+        if (s >= 0) {
+            OPL3_SLOT *slot = &opl->slot[s + bank * 18];
+            slot->patch->AR = (data >> 4) & 15;
+            slot->patch->DR = (data) & 15;
+            request_update(slot, UPDATE_EG);
+        }
+    } else if (0x80 <= r && r < 0xa0) {
+        s = stbl[r - 0x80];
+        if (s >= 0) {
+            OPL3_SLOT *slot = &opl->slot[s + bank * 18];
+            slot->patch->SL = (data >> 4) & 15;
+            slot->patch->RR = (data) & 15;
+            request_update(slot, UPDATE_EG);
+        }
+    } else if (0xa0 <= r && r < 0xa9) {
+        c = r - 0xa0 + bank * 9;
+        update_frequency(opl, c);
+        if (opl->ch_type[c] == OPL3_CH_4OP) {
+            update_frequency(opl, c + 3);
+        }
+    } else if (0xb0 <= r && r < 0xb9) {
+        c = r - 0xb0 + bank * 9;
+        update_frequency(opl, c);
+        if (opl->ch_type[c] == OPL3_CH_4OP) {
+            update_frequency(opl, c + 3);
+        }
+        update_key_status(opl);
+    } else if (reg == 0xbd) {
+        opl->am_mode = (data >> 7) & 1;
+        opl->pm_mode = (data >> 6) & 1;
+        if (opl->rhythm != ((data >> 5) & 1)) {
+            opl->rhythm = (data >> 5) & 1;
+            update_channels(opl);
+        } else {
+            update_key_status(opl);
+        }
+    } else if (0xc0 <= r && r < 0xc9) {
+        c = r - 0xc0 + bank * 9;
+        MOD(opl, c)->patch->FB = opl->ch_type[c] == OPL3_CH_4OP2 ? 0 : (data >> 1) & 7;
+        opl->ch_alg[c] = data & 1;
+        if (opl->newm) {
+            opl->ch_out[c] = ((data >> 4) & 1 ? OPL3_OUT_LEFT : 0) | ((data >> 5) & 1 ? OPL3_OUT_RIGHT : 0);
+        }
+    } else if (0xe0 <= r && r < 0xf6) {
+        // unlike the OPL2 there is no waveform select enable bit
+        s = stbl[r - 0xe0];
+        if (s >= 0) {
+            opl->slot[s + bank * 18].patch->WS = data & (opl->newm ? 7 : 3);
+        }
+    }
+}
+
+/***********************************************************
+
+                   Rendering
+
+***********************************************************/
+
+static uint8_t lfo_am_buffer_lsl3[OPL3_BUF_SIZE];
+static int16_t mod_buffer[OPL3_BUF_SIZE];
+static int16_t zero_mod_buffer[OPL3_BUF_SIZE];
+// accumulators by OPL3_CH_OUT, plus a scratch buffer for the rhythm section
+static int32_t out_buffer[4][OPL3_BUF_SIZE];
+static int32_t rhythm_buffer[OPL3_BUF_SIZE];
+static int16_t rhythm_index[3][OPL3_BUF_SIZE];
+
+static INLINE int slot_silent(OPL3_SLOT *slot) {
+    return slot->eg_out >= EG_MUTE && slot->eg_state != ATTACK;
+}
+
+static INLINE void prepare_slot(OPL3 *opl, OPL3_SLOT *slot, int16_t *mod, int32_t *buffer) {
+    if (slot->update_requests) {
+        commit_slot_update(slot, opl->notesel);
+    }
+    slot->lfo_am_buffer_lsl3 = lfo_am_buffer_lsl3;
+    slot->pm_mode = opl->pm_mode;
+    slot->mod_buffer = mod;
+    slot->buffer = buffer;
+}
+
+// operator writing mod_buffer: feedback modulator (chain = false) or a 4-op middle operator (chain = true)
+static void render_mod(OPL3 *opl, OPL3_SLOT *slot, uint32_t n, int chain) {
+    uint32_t s = 0;
+    prepare_slot(opl, slot, mod_buffer, NULL);
+    if (!slot_silent(slot)) {
+        s = chain ? slot_chain_linear(opl, slot, n, opl->eg_counter, opl->pm_phase) :
+                    slot_mod_linear(opl, slot, n, opl->eg_counter, opl->pm_phase);
+    }
+    if (s != n) {
+        memset(mod_buffer + s, 0, (n - s) * 2);
+    }
+}
+
+// operator adding to buffer: modulated by mod_buffer (alg0), or unmodulated with mod_buffer added to the output (alg1)
+static void render_car(OPL3 *opl, OPL3_SLOT *slot, int16_t *mod, int32_t *buffer, uint32_t n, int alg1) {
+    uint32_t s = 0;
+    prepare_slot(opl, slot, mod, buffer);
+    if (!slot_silent(slot)) {
+        s = alg1 ? slot_car_linear_alg1(opl, slot, n, opl->eg_counter, opl->pm_phase) :
+                   slot_car_linear_alg0(opl, slot, n, opl->eg_counter, opl->pm_phase);
+    }
+    if (alg1) {
+        for (; s < n; s++) {
+            buffer[s] += mod[s];
+        }
+    }
+}
+
+static void render_2op(OPL3 *opl, int ch, int32_t *buffer, uint32_t n) {
+    OPL3_SLOT *mod = MOD(opl, ch), *car = CAR(opl, ch);
+    if (opl->ch_alg[ch]) {
+        if (slot_silent(mod) && slot_silent(car)) return;
+    } else {
+        if (slot_silent(car)) return;
+    }
+    render_mod(opl, mod, n, 0);
+    render_car(opl, car, mod_buffer, buffer, n, opl->ch_alg[ch]);
+}
+
+static void render_4op(OPL3 *opl, int ch, int32_t *buffer, uint32_t n) {
+    OPL3_SLOT *op1 = MOD(opl, ch), *op2 = CAR(opl, ch);
+    OPL3_SLOT *op3 = MOD(opl, ch + 3), *op4 = CAR(opl, ch + 3);
+    switch ((opl->ch_alg[ch] << 1) | opl->ch_alg[ch + 3]) {
+        case 0: // 1 -> 2 -> 3 -> 4
+            if (slot_silent(op4)) return;
+            render_mod(opl, op1, n, 0);
+            render_mod(opl, op2, n, 1);
+            render_mod(opl, op3, n, 1);
+            render_car(opl, op4, mod_buffer, buffer, n, 0);
+            break;
+        case 1: // (1 -> 2) + (3 -> 4)
+            if (!slot_silent(op2)) {
+                render_mod(opl, op1, n, 0);
+                render_car(opl, op2, mod_buffer, buffer, n, 0);
+            }
+            if (!slot_silent(op4)) {
+                render_mod(opl, op3, n, 0);
+                render_car(opl, op4, mod_buffer, buffer, n, 0);
+            }
+            break;
+        case 2: // 1 + (2 -> 3 -> 4)
+            if (!slot_silent(op1)) {
+                render_mod(opl, op1, n, 0);
+                for (uint32_t s = 0; s < n; s++) {
+                    buffer[s] += mod_buffer[s];
+                }
+            }
+            if (!slot_silent(op4)) {
+                render_mod(opl, op2, n, 0);
+                render_mod(opl, op3, n, 1);
+                render_car(opl, op4, mod_buffer, buffer, n, 0);
+            }
+            break;
+        default: // 1 + (2 -> 3) + 4
+            if (!slot_silent(op1) || !slot_silent(op4)) {
+                render_mod(opl, op1, n, 0);
+                render_car(opl, op4, mod_buffer, buffer, n, 1);
+            }
+            if (!slot_silent(op3)) {
+                render_mod(opl, op2, n, 0);
+                render_car(opl, op3, mod_buffer, buffer, n, 0);
+            }
+            break;
+    }
+}
+
+static void render_index(OPL3 *opl, OPL3_SLOT *slot, int16_t *index, int32_t *buffer, uint32_t n) {
+    prepare_slot(opl, slot, index, buffer);
+    if (!slot_silent(slot)) {
+        slot_index_linear(opl, slot, n, opl->eg_counter, opl->pm_phase);
+    }
+}
+
+// emu8950 outputs the melodic channels inverted and the rhythm section as is; keep that
+// by subtracting the rhythm from the (inverted on output) channel accumulators
+static void sub_rhythm(int32_t *buffer, uint32_t n) {
+    for (uint32_t s = 0; s < n; s++) {
+        buffer[s] -= rhythm_buffer[s];
+        rhythm_buffer[s] = 0;
+    }
+}
+
+static void render_rhythm(OPL3 *opl, uint32_t n) {
+    OPL3_SLOT *hh = &opl->slot[SLOT_HH], *sd = &opl->slot[SLOT_SD];
+    OPL3_SLOT *tom = &opl->slot[SLOT_TOM], *cym = &opl->slot[SLOT_CYM];
+
+    // BD is a normal 2-op channel
+    if (opl->ch_out[6]) {
+        render_2op(opl, 6, rhythm_buffer, n);
+        sub_rhythm(out_buffer[opl->ch_out[6]], n);
+    }
+    if (!slot_silent(hh) || !slot_silent(sd) || !slot_silent(cym)) {
+        prepare_slot(opl, hh, NULL, NULL);
+        prepare_slot(opl, cym, NULL, NULL);
+        slot_rhythm_phases(hh, cym, &opl->noise, rhythm_index[0], rhythm_index[1], rhythm_index[2], n, opl->pm_phase);
+    }
+    if (opl->ch_out[7]) {
+        render_index(opl, hh, rhythm_index[0], rhythm_buffer, n);
+        render_index(opl, sd, rhythm_index[1], rhythm_buffer, n);
+        sub_rhythm(out_buffer[opl->ch_out[7]], n);
+    }
+    if (opl->ch_out[8]) {
+        render_car(opl, tom, zero_mod_buffer, rhythm_buffer, n, 1);
+        render_index(opl, cym, rhythm_index[2], rhythm_buffer, n);
+        sub_rhythm(out_buffer[opl->ch_out[8]], n);
+    }
+}
+
+static void __not_in_flash_func(calc_buffer)(OPL3 *opl, int32_t *buffer, uint32_t n) {
+    // we require that incrementing eg_counter is never zero during the rendering loop (see OPL_calc_buffer_linear)
+    opl->eg_counter = (opl->eg_counter & 0x3fffffffu) | 0x80000000u;
+
+    for (uint32_t s = 0; s < n; s++) {
+        opl->am_phase_index++;
+        if (opl->am_phase_index == sizeof(am_table)) opl->am_phase_index = 0;
+        lfo_am_buffer_lsl3[s] = (am_table[opl->am_phase_index] >> (opl->am_mode ? 0 : 2)) << 3;
+    }
+    memset(out_buffer[OPL3_OUT_LEFT], 0, n * sizeof(int32_t));
+    memset(out_buffer[OPL3_OUT_RIGHT], 0, n * sizeof(int32_t));
+    memset(out_buffer[OPL3_OUT_CENTER], 0, n * sizeof(int32_t));
+
+    for (int ch = 0; ch < 18; ch++) {
+        switch (opl->ch_type[ch]) {
+            case OPL3_CH_2OP:
+                if (opl->ch_out[ch]) render_2op(opl, ch, out_buffer[opl->ch_out[ch]], n);
+                break;
+            case OPL3_CH_4OP:
+                // a 4-op channel is output through the second channel's C0 pan bits
+                if (opl->ch_out[ch + 3]) render_4op(opl, ch, out_buffer[opl->ch_out[ch + 3]], n);
+                break;
+            case OPL3_CH_RHYTHM:
+                if (ch == 6) render_rhythm(opl, n);
+                break;
+            default:
+                break;
+        }
+    }
+
+    for (uint32_t s = 0; s < n; s++) {
+        int32_t c = out_buffer[OPL3_OUT_CENTER][s];
+        buffer[2 * s] = -(c + out_buffer[OPL3_OUT_LEFT][s]);
+        buffer[2 * s + 1] = -(c + out_buffer[OPL3_OUT_RIGHT][s]);
+    }
+
+    opl->pm_phase = (opl->pm_phase + PM_DPHASE * n) & (PM_DP_WIDTH - 1);
+    opl->eg_counter += n;
+}
+
+void OPL3_calc_buffer_stereo(OPL3 *opl, int32_t *buffer, uint32_t nsamples) {
+    while (nsamples) {
+        uint32_t n = min(nsamples, OPL3_BUF_SIZE);
+        calc_buffer(opl, buffer, n);
+        buffer += 2 * n;
+        nsamples -= n;
+    }
+}
+#endif
@@ -0,0 +1,85 @@
+#ifndef _EMU8950_OPL3_H_
+#define _EMU8950_OPL3_H_
+
+/*
+ * YMF262 (OPL3) engine on top of the emu8950 slot renderer (slot_render.cpp).
+ *
+ * Each operator is rendered a whole buffer at a time like OPL_calc_buffer_linear
+ * does for the OPL2: 18 channels over two register banks, 4-op channel pairs,
+ * per channel left/right output, waveforms 4-7 and the OPL2 rhythm section.
+ * OPL2 register writes (NEW clear) render as emu8950 does, in stereo.
+ */
+
+#include <stdint.h>
+#include "slot_render.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// maximum samples rendered per internal pass; longer requests are split
+#define OPL3_BUF_SIZE 128
+
+enum OPL3_CH_TYPE {
+    OPL3_CH_2OP,      // normal 2-op channel
+    OPL3_CH_4OP,      // first channel of a 4-op pair, renders all four operators
+    OPL3_CH_4OP2,     // second channel of a 4-op pair, rendered by the first
+    OPL3_CH_RHYTHM,   // bank 1 channels 6-8 while rhythm mode is on
+};
+
+enum OPL3_CH_OUT {
+    OPL3_OUT_NONE,
+    OPL3_OUT_LEFT,
+    OPL3_OUT_RIGHT,
+    OPL3_OUT_CENTER,
+};
+
+typedef struct __OPL3_SLOT {
+    struct SLOT_RENDER;
+    OPL_PATCH __patch;
+    uint16_t blk_fnum;        /* (block << 10) | f-number */
+    uint8_t pg_keep;          /* if 1, pg_phase is preserved when key-on */
+    uint8_t update_requests;  /* flags to debounce update */
+} OPL3_SLOT;
+
+typedef struct __OPL3 {
+    uint32_t clk;
+    uint32_t rate;
+
+    uint8_t notesel;
+    uint8_t am_mode;
+    uint8_t pm_mode;
+    uint8_t rhythm;
+    uint8_t newm;             /* 0x105 bit 0: OPL3 mode */
+    uint8_t connsel;          /* 0x104: 4-op pair enables */
+    uint8_t am_phase_index;
+
+    uint32_t eg_counter;
+    uint32_t pm_phase;
+    uint32_t noise;
+    uint64_t slot_key_status;
+
+    uint8_t reg[0x200];
+    uint8_t ch_alg[18];       /* C0 bit 0 */
+    uint8_t ch_type[18];      /* OPL3_CH_TYPE */
+    uint8_t ch_out[18];       /* OPL3_CH_OUT */
+
+    /* slot 2 * ch is the modulator and 2 * ch + 1 the carrier; bank 2 is channels 9-17 */
+    OPL3_SLOT slot[36];
+} OPL3;
+
+OPL3 *OPL3_new(uint32_t clk, uint32_t rate);
+void OPL3_delete(OPL3 *opl);
+void OPL3_reset(OPL3 *opl);
+
+// reg is 9 bits, bit 8 selects the second register bank
+void OPL3_writeReg(OPL3 *opl, uint32_t reg, uint8_t val);
+
+// interleaved left/right int32 samples
+void OPL3_calc_buffer_stereo(OPL3 *opl, int32_t *buffer, uint32_t nsamples);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -37,6 +37,15 @@ typedef enum
 
 #define OPL_SECOND ((uint64_t) 1000 * 1000)
 
+// Rate the OPL backends generate at. The chip's native rate is 14.318 MHz / 288;
+// with OPL_NATIVE_RATE the cores instead run directly at the 44.1 kHz output
+// rate (phase steps and envelope timing rescaled) and no resampler is used.
+#if OPL_NATIVE_RATE
+#define OPL_RENDER_RATE 44100
+#else
+#define OPL_RENDER_RATE 49716
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -48,6 +57,14 @@ void OPL_Pico_WriteRegister(unsigned int, unsigned int);
 void OPL_Pico_simple(int32_t*, uint32_t);
 void OPL_Pico_stereo(int32_t*, int32_t*, uint32_t);
 
+#if OPL_CMD_BUFFER
+// Output-frame clocks for timestamped register writes (see opl_cmd_queue.h).
+// opl_sample_clock counts frames played by the audio ISR; opl_render_clock is
+// the frame the player is currently rendering. Both are owned by the player.
+extern volatile uint32_t opl_sample_clock;
+extern uint32_t opl_render_clock;
+#endif
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
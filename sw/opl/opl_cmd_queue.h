@@ -0,0 +1,157 @@
+#pragma once
+/*
+ * opl_cmd_queue.h — timestamped OPL command queue consumer shared by the
+ * OPL backends (emu8950, ymfm, dbopl).
+ *
+ * Core 0 stamps every queued register write with opl_sample_clock, the number
+ * of output frames the audio ISR has played so far. The player on core 1 keeps
+ * opl_render_clock at the output frame currently being rendered. A write
+ * stamped t is applied when rendering reaches output frame t + OPL_CMD_LATENCY,
+ * so bursts of writes keep the spacing they had on the bus.
+ *
+ * Backends render in blocks: opl_cmd_drain() applies every write due at the
+ * current position of the block and returns how many native frames can be
+ * rendered before the next one is due. opl_cmd_collect() instead hands the
+ * writes of a whole block to the backend with their frame positions.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "opl.h"
+#include "include/cmd_buffers.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern opl_buffer_t opl_cmd_buffer;
+
+// Output frames between a write arriving on the bus and it being rendered.
+// Must cover the full OPL output FIFO (256 frames), one resampler block (32)
+// and one backend prebuffer, otherwise writes would already be in the past
+// when the renderer sees them.
+#define OPL_CMD_LATENCY   416
+#define OPL_OUTPUT_RATE   44100
+
+// Writes that start or end a note (a change of the key-on bit of B0-B8 or of
+// a rhythm key in BD) are key writes: the next write gets at least one
+// rendered frame after them so an off/on pair in the same frame still
+// retriggers the envelope. Rewrites of B0-B8 that keep the key bit are not.
+
+// Bits of opl_cmd_buffer.keys a write sets: the key-on bit of B0-B8 (bank 1
+// in bits 0-8, bank 2 in 9-17) or rhythm enable and keys of BD (18-23)
+static inline uint32_t opl_cmd_key_mask(uint16_t addr) {
+    const uint8_t reg = addr & 0xFF;
+    if (reg >= 0xB0 && reg <= 0xB8) {
+        return 1u << ((addr & 0x100 ? 9 : 0) + (reg - 0xB0));
+    }
+    return addr == 0xBD ? 0x3Fu << 18 : 0;
+}
+
+static inline uint32_t opl_cmd_key_bits(uint16_t addr, uint8_t data) {
+    return addr == 0xBD ? (uint32_t)(data & 0x3F) << 18 : ((data & 0x20) ? opl_cmd_key_mask(addr) : 0);
+}
+
+static inline bool opl_cmd_is_key(uint32_t cmd) {
+    const uint16_t addr = (cmd >> 8) & 0x1FF;
+    const uint32_t mask = opl_cmd_key_mask(addr);
+    return mask && (opl_cmd_buffer.keys & mask) != opl_cmd_key_bits(addr, cmd & 0xFF);
+}
+
+// Take the write at the tail out of the queue
+static inline void opl_cmd_take(uint16_t tail, uint32_t cmd) {
+    const uint16_t addr = (cmd >> 8) & 0x1FF;
+    const uint32_t mask = opl_cmd_key_mask(addr);
+    opl_cmd_buffer.keys = (opl_cmd_buffer.keys & ~mask) | opl_cmd_key_bits(addr, cmd & 0xFF);
+    opl_cmd_buffer.tail = tail + 1;
+}
+
+// Native frame of a block whose frame 0 is output frame `clock` at which the
+// queued write `cmd` is due; 0 when it is already due. While the queue is above
+// OPL_CMD_HIGH_WATER writes are due immediately to make room.
+static inline uint32_t opl_cmd_due(uint32_t cmd, uint16_t queued, uint32_t clock, uint32_t rate) {
+    if (queued >= OPL_CMD_HIGH_WATER) {
+        return 0;
+    }
+    // Timestamps only carry 15 bits; sign-extend the difference. The render
+    // clock never trails the frame a write was stamped on, so a write can be
+    // at most OPL_CMD_LATENCY frames ahead. Anything further ahead has waited
+    // more than 16384 frames (0.37 s, a core 1 stall) and wrapped: it is late.
+    // A write that waited a whole wrap period (0.74 s) or more can still land
+    // inside the window and is then rendered up to OPL_CMD_LATENCY frames late.
+    const int32_t out_frames = ((int32_t)(((cmd >> 17) + OPL_CMD_LATENCY - clock) << 17)) >> 17;
+    if (out_frames <= 0 || out_frames > OPL_CMD_LATENCY) {
+        return 0;
+    }
+    return ((uint32_t)out_frames * rate) / OPL_OUTPUT_RATE;
+}
+
+// Apply queued writes due at native frame `pos` of a block whose frame 0 is
+// output frame `clock`. `rate` is the backend's native sample rate. Returns the
+// number of frames (1..max) to render before calling again.
+static inline uint32_t opl_cmd_drain(uint32_t clock, uint32_t pos, uint32_t max, uint32_t rate) {
+    while (opl_cmd_buffer.tail != opl_cmd_buffer.head) {
+        const uint16_t tail = opl_cmd_buffer.tail;
+        const uint32_t cmd = opl_cmd_buffer.cmds[tail & OPL_CMD_BUFFER_MASK];
+        const uint32_t due = opl_cmd_due(cmd, opl_cmd_buffer.head - tail, clock, rate);
+        if (due > pos) {
+            return (due - pos) < max ? (due - pos) : max;
+        }
+        const bool key = opl_cmd_is_key(cmd);
+        opl_cmd_take(tail, cmd);
+        OPL_Pico_WriteRegister((cmd >> 8) & 0x1FF, cmd & 0xFF);
+        if (key && opl_cmd_buffer.tail != opl_cmd_buffer.head) {
+            return 1;
+        }
+    }
+    return max;
+}
+
+// A queued write taken out of the queue by opl_cmd_collect()
+typedef struct opl_cmd_event_t {
+    uint16_t pos;   // native frame of the block it is due at
+    uint16_t addr;
+    uint8_t data;
+} opl_cmd_event_t;
+
+// For backends that apply writes inside a block themselves instead of
+// rendering up to each one: take every write due in frames pos..pos+max-1 out
+// of the queue, in order and with the same timing and key spacing as
+// opl_cmd_drain(), into `events` (at most `capacity`). Returns
+// the number of events and sets *run to the frames they cover, which is max
+// unless `events` filled up first.
+static inline uint32_t opl_cmd_collect(uint32_t clock, uint32_t pos, uint32_t max, uint32_t rate,
+                                       opl_cmd_event_t *events, uint32_t capacity, uint32_t *run) {
+    uint32_t count = 0;
+    uint32_t next = pos;    // earliest frame the next write can land on
+    *run = max;
+    while (opl_cmd_buffer.tail != opl_cmd_buffer.head) {
+        const uint16_t tail = opl_cmd_buffer.tail;
+        const uint32_t cmd = opl_cmd_buffer.cmds[tail & OPL_CMD_BUFFER_MASK];
+        uint32_t due = opl_cmd_due(cmd, opl_cmd_buffer.head - tail, clock, rate);
+        if (due < next) {
+            due = next;
+        }
+        if (due >= pos + max) {
+            break;
+        }
+        if (count == capacity) {
+            // Leave the rest for the next call, which starts at this write's
+            // frame, or one later when it shares the last event's frame
+            *run = due - pos + (due == events[count - 1].pos);
+            break;
+        }
+        const bool key = opl_cmd_is_key(cmd);
+        opl_cmd_take(tail, cmd);
+        events[count].pos = due;
+        events[count].addr = (cmd >> 8) & 0x1FF;
+        events[count].data = cmd & 0xFF;
+        count++;
+        next = key ? due + 1 : due;
+    }
+    return count;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
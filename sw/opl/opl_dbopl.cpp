@@ -6,10 +6,10 @@
 #include "hardware/timer.h"
 
 #include "dbopl/dbopl.h"
+#include "opl_idle.h"
 
 #if OPL_CMD_BUFFER
-#include "include/cmd_buffers.h"
-extern cms_buffer_t opl_cmd_buffer;
+#include "opl_cmd_queue.h"
 #endif
 
 // ---------------------------------------------------------------------------
@@ -46,6 +46,19 @@ static void OPLTimer_CalculateEndTime(opl_timer_t *timer)
 }
 
 static DBOPL::Chip dbopl3(true);
+static constexpr uint32_t OPL_RATE = OPL_RENDER_RATE;
+static opl_idle_t s_idle;
+
+// True when every operator's envelope has released to OFF
+static bool chip_envelopes_off()
+{
+    for (const DBOPL::Channel &chan : dbopl3.chan)
+    {
+        if (chan.op[0].state != DBOPL::Operator::OFF || chan.op[1].state != DBOPL::Operator::OFF)
+            return false;
+    }
+    return true;
+}
 
 // ---------------------------------------------------------------------------
 // Pre-generation buffer — batch PREBUF_SIZE samples per generate() call so
@@ -56,25 +69,66 @@ static constexpr uint32_t PREBUF_SIZE   = 128;
 static int32_t s_prebuf[2*PREBUF_SIZE];         // interleaved stereo
 static uint32_t s_prebuf_head = PREBUF_SIZE;    // starts empty → triggers fill on first call
 
-static void refill_prebuf()
+#if OPL_CMD_BUFFER
+// Queued writes due in the block being rendered. dbopl applies them at their
+// own sample and only splits the channels they belong to, so a burst of
+// writes doesn't cut the whole chip into single-sample blocks. More than this
+// many in one block (a high-water flush) splits the block.
+static constexpr uint32_t BLOCK_WRITES = 64;
+static opl_cmd_event_t s_events[BLOCK_WRITES];
+static DBOPL::Chip::BlockWrite s_writes[BLOCK_WRITES];
+
+static void write_register(uint32_t reg, uint8_t value)
 {
-    int samples_to_render = PREBUF_SIZE;
-    int32_t *pb = s_prebuf;
-    while (opl_cmd_buffer.tail != opl_cmd_buffer.head) {
-        auto cmd = opl_cmd_buffer.cmds[opl_cmd_buffer.tail];
-        OPL_Pico_WriteRegister(cmd.addr, cmd.data);
-        ++opl_cmd_buffer.tail;
-        if (((cmd.addr & 0xFF) < 0x20) || ((cmd.addr & 0xF0) == 0xB0)) {
-            // step 1 OPL clock, then continue draining OPL register queue
-            dbopl3.GenerateBlock3(1, pb);
-            pb += 2 * 1;
-            samples_to_render--;
-            if (samples_to_render == 0) break;
-        }; 
+    OPL_Pico_WriteRegister(reg, value);
+}
+#endif
+
+static void render_prebuf(uint32_t pos, uint32_t count, uint32_t writes)
+{
+    uint32_t skip = 0;
+    if (opl_idle_active(&s_idle))
+    {
+        // All envelopes are off: the chip outputs silence up to the first write
+#if OPL_CMD_BUFFER
+        skip = writes ? s_events[0].pos - pos : count;
+#else
+        skip = count;
+#endif
+        for (uint32_t i = 0; i < 2 * skip; i++)
+            s_prebuf[2 * pos + i] = 0;
+        if (skip == count)
+            return;
+    }
+#if OPL_CMD_BUFFER
+    for (uint32_t i = 0; i < writes; i++)
+    {
+        s_writes[i].pos = s_events[i].pos - pos - skip;
+        s_writes[i].reg = s_events[i].addr;
+        s_writes[i].val = s_events[i].data;
     }
+    dbopl3.GenerateBlock3(count - skip, s_prebuf + 2 * (pos + skip), s_writes, writes, write_register);
+#else
+    dbopl3.GenerateBlock3(count, s_prebuf + 2 * pos);
+#endif
+    opl_idle_check(&s_idle, chip_envelopes_off);
+}
 
-    // render the rest
-    if (samples_to_render > 0) dbopl3.GenerateBlock3(samples_to_render, pb);
+static void refill_prebuf()
+{
+#if OPL_CMD_BUFFER
+    const uint32_t clock = opl_render_clock;
+    for (uint32_t j = 0; j < PREBUF_SIZE; )
+    {
+        uint32_t run;
+        const uint32_t writes = opl_cmd_collect(clock, j, PREBUF_SIZE - j, OPL_RATE,
+                                                s_events, BLOCK_WRITES, &run);
+        render_prebuf(j, run, writes);
+        j += run;
+    }
+#else
+    render_prebuf(0, PREBUF_SIZE, 0);
+#endif
 
     // reset prebuf head
     s_prebuf_head = 0;
@@ -86,7 +140,7 @@ static void refill_prebuf()
 
 int OPL_Pico_Init(unsigned int port_base)
 {
-    dbopl3.Setup(49716);
+    dbopl3.Setup(OPL_RATE);
     s_prebuf_head = PREBUF_SIZE;
     return 1;
 }
@@ -146,6 +200,7 @@ void OPL_Pico_WriteRegister(unsigned int reg_num, unsigned int value)
 
         default:
             dbopl3.WriteReg(reg_num, value);
+            opl_idle_write(&s_idle, reg_num, value);
             break;
     }
 }
@@ -0,0 +1,184 @@
+// OPL3 glue for the emu8950 based OPL3 engine (emu8950_opl3.c)
+// mostly just copied from opl_pico.c and opl_dbopl.cpp
+
+#include <string.h>
+
+#include "hardware/sync.h"
+#include "hardware/timer.h"
+
+#include "emu8950_opl3.h"
+#include "opl.h"
+#include "opl_idle.h"
+#if OPL_CMD_BUFFER
+#include "opl_cmd_queue.h"
+#endif
+
+typedef struct
+{
+    unsigned int rate;        // Number of times the timer is advanced per sec.
+    unsigned int enabled;     // Non-zero if timer is enabled.
+    unsigned int value;       // Last value that was set.
+    uint64_t expire_time;     // Calculated time that timer will expire.
+} opl_timer_t;
+
+static OPL3 *emu8950_opl3;
+
+static opl_timer_t timer1 = { 12500, 0, 0, 0 };
+static opl_timer_t timer2 = { 3125, 0, 0, 0 };
+
+static opl_idle_t s_idle;
+
+// True when every slot's envelope has decayed to EG_MAX or beyond, where the
+// slot renderer outputs 0 for the slot
+static bool chip_envelopes_off(void) {
+    for (int i = 0; i < 36; i++) {
+        if (emu8950_opl3->slot[i].eg_out < EG_MAX) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Pre-generation buffer — render PREBUF_SIZE stereo samples at a time, split at
+// the timestamps of queued register writes.
+#define PREBUF_SIZE OPL3_BUF_SIZE
+static int32_t s_prebuf[2 * PREBUF_SIZE];    // interleaved stereo
+static uint32_t s_prebuf_head = PREBUF_SIZE; // starts empty → triggers fill on first call
+
+static void render_prebuf(uint32_t pos, uint32_t count) {
+    if (opl_idle_active(&s_idle)) {
+        // All envelopes are off: the chip would output silence
+        memset(s_prebuf + 2 * pos, 0, 2 * count * sizeof(int32_t));
+        return;
+    }
+    OPL3_calc_buffer_stereo(emu8950_opl3, s_prebuf + 2 * pos, count);
+    opl_idle_check(&s_idle, chip_envelopes_off);
+}
+
+static void refill_prebuf(void) {
+#if OPL_CMD_BUFFER
+    const uint32_t clock = opl_render_clock;
+    for (uint32_t j = 0; j < PREBUF_SIZE; ) {
+        const uint32_t run = opl_cmd_drain(clock, j, PREBUF_SIZE - j, OPL_RENDER_RATE);
+        render_prebuf(j, run);
+        j += run;
+    }
+#else
+    render_prebuf(0, PREBUF_SIZE);
+#endif
+    s_prebuf_head = 0;
+}
+
+int OPL_Pico_Init(unsigned int port_base)
+{
+    emu8950_opl3 = OPL3_new(3579552 * 4, OPL_RENDER_RATE);
+    s_prebuf_head = PREBUF_SIZE;
+    return 1;
+}
+
+unsigned int OPL_Pico_PortRead(opl_port_t port)
+{
+    // OPL3 has 0x00 in its status register, OPL2 0x06
+    unsigned int result = 0x00;
+
+    __dsb();
+    // Use time_us_64 as current_time gets updated coarsely as the mix callback is called
+    uint64_t pico_time = time_us_64();
+    if (timer1.enabled && pico_time > timer1.expire_time)
+    {
+        result |= 0x80;   // Either have expired
+        result |= 0x40;   // Timer 1 has expired
+    }
+
+    if (timer2.enabled && pico_time > timer2.expire_time)
+    {
+        result |= 0x80;   // Either have expired
+        result |= 0x20;   // Timer 2 has expired
+    }
+
+    return result;
+}
+
+static void OPLTimer_CalculateEndTime(opl_timer_t *timer)
+{
+    int tics;
+
+    // If the timer is enabled, calculate the time when the timer
+    // will expire.
+
+    if (timer->enabled)
+    {
+        tics = 0x100 - timer->value;
+
+        timer->expire_time = time_us_64()
+                           + ((uint64_t) tics * OPL_SECOND) / timer->rate;
+    }
+}
+
+void OPL_Pico_WriteRegister(unsigned int reg_num, unsigned int value)
+{
+    switch (reg_num)
+    {
+        case OPL_REG_TIMER1:
+            timer1.value = value;
+            OPLTimer_CalculateEndTime(&timer1);
+            break;
+
+        case OPL_REG_TIMER2:
+            timer2.value = value;
+            OPLTimer_CalculateEndTime(&timer2);
+            break;
+
+        case OPL_REG_TIMER_CTRL:
+            if (value & 0x80)
+            {
+                timer1.enabled = 0;
+                timer2.enabled = 0;
+            }
+            else
+            {
+                if ((value & 0x40) == 0)
+                {
+                    timer1.enabled = (value & 0x01) != 0;
+                    OPLTimer_CalculateEndTime(&timer1);
+                }
+
+                if ((value & 0x20) == 0)
+                {
+                    timer2.enabled = (value & 0x02) != 0;
+                    OPLTimer_CalculateEndTime(&timer2);
+                }
+            }
+
+            break;
+        default:
+            OPL3_writeReg(emu8950_opl3, reg_num, value);
+            opl_idle_write(&s_idle, reg_num, value);
+            break;
+    }
+}
+
+// Mono interface — average of L+R so mono output is at the same level as stereo.
+void OPL_Pico_simple(int32_t *buffer, uint32_t nsamples)
+{
+    for (uint32_t i = 0; i < nsamples; i++)
+    {
+        if (s_prebuf_head >= PREBUF_SIZE)
+            refill_prebuf();
+        buffer[i] = (s_prebuf[2*s_prebuf_head+0] + s_prebuf[2*s_prebuf_head+1]) >> 1;
+        s_prebuf_head++;
+    }
+}
+
+// Stereo interface — L and R reflect the per-channel panning programmed by the game.
+void OPL_Pico_stereo(int32_t *left, int32_t *right, uint32_t nsamples)
+{
+    for (uint32_t i = 0; i < nsamples; i++)
+    {
+        if (s_prebuf_head >= PREBUF_SIZE)
+            refill_prebuf();
+        left[i]  = s_prebuf[2*s_prebuf_head+0];
+        right[i] = s_prebuf[2*s_prebuf_head+1];
+        s_prebuf_head++;
+    }
+}
@@ -0,0 +1,68 @@
+#pragma once
+/*
+ * opl_idle.h — engine-independent OPL idle detection shared by the OPL
+ * backends (emu8950, ymfm, dbopl).
+ *
+ * The chip is idle when no channel (or rhythm instrument) is keyed on and the
+ * backend reports every envelope at maximum attenuation. With keys off the
+ * envelopes can only decay further, so the output stays exactly zero until the
+ * next register write. While idle the backends fill their blocks with silence
+ * instead of running the synthesis.
+ *
+ * Every synthesis register write bumps a counter, and idle is recorded as the
+ * counter value at which silence was detected. Any later write, from either
+ * core, ends idle without a lock; with OPL_CMD_BUFFER writes are applied at
+ * their own sample inside the block, so synthesis resumes on that sample.
+ *
+ * Skipped samples don't advance the chip's free-running counters: the
+ * tremolo/vibrato LFOs, the rhythm noise generator and the envelope counter
+ * resume where they stopped, so the first note after an idle stretch starts
+ * at a different LFO and noise phase than it would without the skip. Operator
+ * phases are reset by the key-on either way. The output after silence is
+ * therefore not sample-identical to an unskipped render, though no phase is
+ * more correct than another: on the chip it depends on how long ago it was
+ * reset.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct opl_idle_t {
+    volatile uint32_t keys;     // bits 0-8: bank 1 ch 0-8, 9-17: bank 2, 18-22: rhythm
+    volatile uint32_t writes;   // synthesis register writes so far
+    volatile uint32_t idle_at;  // value of writes when the chip was found silent
+} opl_idle_t;
+
+// Track key state for a register write the backend passed to the chip
+static inline void opl_idle_write(opl_idle_t *idle, uint16_t reg, uint8_t value) {
+    const uint8_t low = reg & 0xFF;
+    if (low >= 0xB0 && low <= 0xB8) {
+        const uint32_t bit = 1u << ((reg & 0x100 ? 9 : 0) + (low - 0xB0));
+        idle->keys = (value & 0x20) ? (idle->keys | bit) : (idle->keys & ~bit);
+    } else if (reg == 0xBD) {
+        // Rhythm instrument keys only count while rhythm mode is enabled
+        idle->keys = (idle->keys & ~(0x1Fu << 18)) | ((value & 0x20) ? (value & 0x1Fu) << 18 : 0);
+    }
+    idle->writes = idle->writes + 1;
+}
+
+static inline bool opl_idle_active(const opl_idle_t *idle) {
+    return idle->idle_at == idle->writes;
+}
+
+// Call after rendering a block. envelopes_off is the backend's probe, only
+// run when no key is on, so it costs nothing while music is playing.
+static inline void opl_idle_check(opl_idle_t *idle, bool (*envelopes_off)(void)) {
+    const uint32_t writes = idle->writes;
+    if (idle->keys == 0 && envelopes_off()) {
+        idle->idle_at = writes;
+    }
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -38,6 +38,10 @@
 #endif
 
 #include "opl.h"
+#include "opl_idle.h"
+#if OPL_CMD_BUFFER
+#include "opl_cmd_queue.h"
+#endif
 /* #include "opl_internal.h" */
 
 /* #include "opl_queue.h" */
@@ -55,13 +59,63 @@ static OPL *emu8950_opl;
 static opl_timer_t timer1 = { 12500, 0, 0, 0 };
 static opl_timer_t timer2 = { 3125, 0, 0, 0 };
 
-void OPL_Pico_simple(int32_t *buffer, uint32_t nsamples) {
+static opl_idle_t s_idle;
+
+// True when every slot's envelope has decayed to EG_MAX or beyond, where emu8950
+// outputs 0 for the slot
+static bool chip_envelopes_off(void) {
+    for (int i = 0; i < 18; i++) {
+        if (emu8950_opl->slot[i].eg_out < EG_MAX) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void render_buffer(int32_t *buffer, uint32_t nsamples) {
+    if (opl_idle_active(&s_idle)) {
+        // All envelopes are off: the chip would output silence
+        memset(buffer, 0, nsamples * sizeof(int32_t));
+        return;
+    }
     OPL_calc_buffer(emu8950_opl, buffer, nsamples);
+    opl_idle_check(&s_idle, chip_envelopes_off);
+}
+
+#if OPL_CMD_BUFFER
+// Pre-generation buffer — render PREBUF_SIZE samples at a time, split at the
+// timestamps of queued register writes.
+#define PREBUF_SIZE 128
+static int32_t s_prebuf[PREBUF_SIZE];
+static uint32_t s_prebuf_head = PREBUF_SIZE; // starts empty → triggers fill on first call
+
+static void refill_prebuf(void) {
+    const uint32_t clock = opl_render_clock;
+    for (uint32_t j = 0; j < PREBUF_SIZE; ) {
+        const uint32_t run = opl_cmd_drain(clock, j, PREBUF_SIZE - j, OPL_RENDER_RATE);
+        render_buffer(s_prebuf + j, run);
+        j += run;
+    }
+    s_prebuf_head = 0;
+}
+
+void OPL_Pico_simple(int32_t *buffer, uint32_t nsamples) {
+    for (uint32_t i = 0; i < nsamples; i++) {
+        if (s_prebuf_head >= PREBUF_SIZE) {
+            refill_prebuf();
+        }
+        buffer[i] = s_prebuf[s_prebuf_head++];
+    }
 }
+#else
+void OPL_Pico_simple(int32_t *buffer, uint32_t nsamples) {
+    render_buffer(buffer, nsamples);
+}
+#endif
 
 int OPL_Pico_Init(unsigned int port_base)
 {
-    emu8950_opl = OPL_new(3579552, PICO_SOUND_SAMPLE_FREQ); // todo check rate
+    emu8950_opl = OPL_new(3579552, OPL_RENDER_RATE);
     return 1;
 }
 
@@ -150,6 +204,7 @@ void OPL_Pico_WriteRegister(unsigned int reg_num, unsigned int value)
             break;
         default:
             OPL_writeReg(emu8950_opl, reg_num, value);
+            opl_idle_write(&s_idle, reg_num, value);
             break;
     }
 }
@@ -25,9 +25,9 @@
 
 #include "ymfm/src/ymfm_opl.h"
 
+#include "opl_idle.h"
 #if OPL_CMD_BUFFER
-#include "include/cmd_buffers.h"
-extern cms_buffer_t opl_cmd_buffer;
+#include "opl_cmd_queue.h"
 #endif
 
 // ---------------------------------------------------------------------------
@@ -46,8 +46,36 @@ static constexpr unsigned int OPL_STATUS_BASE = 0x00; // OPL3 detection
 // ---------------------------------------------------------------------------
 class pico_ymfm_interface : public ymfm::ymfm_interface {};
 
+// Chip wrapper exposing the envelope state of the (protected) FM engine
+class pico_opl_chip : public opl_chip_t
+{
+public:
+    using opl_chip_t::opl_chip_t;
+
+    // True when every operator has released below ymfm's quiet threshold
+    // (0x380), where compute_volume() returns 0
+    bool envelopes_off() const
+    {
+        for (uint32_t i = 0; i < opl_chip_t::fm_engine::OPERATORS; i++)
+        {
+            const auto *op = m_fm.debug_operator(i);
+            if (op->debug_eg_state() != ymfm::EG_RELEASE || op->debug_eg_attenuation() <= 0x380)
+                return false;
+        }
+        return true;
+    }
+};
+
 static pico_ymfm_interface s_intf;
-static opl_chip_t s_chip(s_intf);
+static pico_opl_chip s_chip(s_intf);
+static opl_idle_t s_idle;
+
+static bool chip_envelopes_off()
+{
+    return s_chip.envelopes_off();
+}
+
+static constexpr uint32_t OPL_RATE = OPL_RENDER_RATE;
 
 // ---------------------------------------------------------------------------
 // Timer state — Core 0 only
@@ -74,47 +102,51 @@ static void OPLTimer_CalculateEndTime(opl_timer_t *timer)
 }
 
 // ---------------------------------------------------------------------------
-// Pre-generation buffer — batch PREBUF_SIZE samples per generate() call so
-// ymfm's inner operator loop runs with code and ROM tables hot in cache.
+// Pre-generation buffer — render PREBUF_SIZE samples at a time with ymfm's
+// block renderer (YMFM_BLOCK_RENDER), which runs each channel and operator
+// over the whole run instead of the whole chip per sample. Only outputs 0/1
+// (L1/R1) are rendered; the rarely-used L2/R2 outputs are compiled out.
 // Stereo L/R buffers used by both OPL_Pico_simple and OPL_Pico_stereo.
 // ---------------------------------------------------------------------------
-static constexpr uint32_t PREBUF_SIZE       = 128; // must be evenly divisible by PREBUF_SIZE_INNER!
-static constexpr uint32_t PREBUF_SIZE_INNER = 8;
-static opl_chip_t::output_data s_gen_buf[PREBUF_SIZE_INNER];
+static constexpr uint32_t PREBUF_SIZE = 128;
 static int32_t s_prebuf_l[PREBUF_SIZE];
 static int32_t s_prebuf_r[PREBUF_SIZE];
 static uint32_t s_prebuf_head = PREBUF_SIZE; // starts empty → triggers fill on first call
 
-static void refill_prebuf()
+static void render_prebuf(uint32_t pos, uint32_t count)
 {
-    for (uint32_t j = 0; j < PREBUF_SIZE; j += PREBUF_SIZE_INNER)
+    if (opl_idle_active(&s_idle))
     {
-#if OPL_CMD_BUFFER
-        // Process any pending OPL commands
-        while (opl_cmd_buffer.tail != opl_cmd_buffer.head) {
-            auto cmd = opl_cmd_buffer.cmds[opl_cmd_buffer.tail];
-            OPL_Pico_WriteRegister(cmd.addr, cmd.data);
-            ++opl_cmd_buffer.tail;
-            if ((cmd.addr < 0x20) || ((cmd.addr & 0xF0) == 0xB0)) break; // break on key on/off retrigs and misc registers
-            break;
-        }
-#endif
-
-        // generate a new bunch of samples
-        s_chip.generate(s_gen_buf, PREBUF_SIZE_INNER);
-
-        for (int i = 0; i < PREBUF_SIZE_INNER; i++) {
+        // All envelopes are off: the chip would output silence
+        for (uint32_t i = 0; i < count; i++)
+            s_prebuf_l[pos+i] = s_prebuf_r[pos+i] = 0;
+        return;
+    }
 #ifdef USE_YMF3812
-            // ym3812 is mono — duplicate to both channels
-            s_prebuf_l[j+i] = s_prebuf_r[j+i] = s_gen_buf[i].data[0];
+    // ym3812 is mono — duplicate to both channels
+    s_chip.generate_block(s_prebuf_l + pos, count);
+    for (uint32_t i = 0; i < count; i++)
+        s_prebuf_r[pos+i] = s_prebuf_l[pos+i];
 #else
-            // ymf262: use L1 (data[0]) and R1 (data[1]) — the standard stereo pair.
-            // data[2]/data[3] are the rarely-used L2/R2 extended outputs, ignored.
-            s_prebuf_l[j+i] = s_gen_buf[i].data[0];
-            s_prebuf_r[j+i] = s_gen_buf[i].data[1];
+    s_chip.generate_block(s_prebuf_l + pos, s_prebuf_r + pos, count);
 #endif
-        }
+    opl_idle_check(&s_idle, chip_envelopes_off);
+}
+
+static void refill_prebuf()
+{
+#if OPL_CMD_BUFFER
+    // Split the block at the timestamps of queued writes
+    const uint32_t clock = opl_render_clock;
+    for (uint32_t j = 0; j < PREBUF_SIZE; )
+    {
+        const uint32_t run = opl_cmd_drain(clock, j, PREBUF_SIZE - j, OPL_RATE);
+        render_prebuf(j, run);
+        j += run;
     }
+#else
+    render_prebuf(0, PREBUF_SIZE);
+#endif
     s_prebuf_head = 0;
 }
 
@@ -192,6 +224,11 @@ void OPL_Pico_WriteRegister(unsigned int reg_num, unsigned int value)
             s_chip.write_address(reg_num & 0xFF);
 #endif
             s_chip.write_data(value & 0xFF);
+#ifndef USE_YMF3812
+            opl_idle_write(&s_idle, reg_num, value);
+#else
+            opl_idle_write(&s_idle, reg_num & 0xFF, value);
+#endif
             break;
     }
 }
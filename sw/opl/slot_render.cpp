@@ -176,7 +176,27 @@ static uint16_t wav_or_table_lookup[4][4] = {
 };
 #endif
 
-static INLINE int16_t calc_sample(const SLOT_RENDER *slot, uint32_t index, int16_t am) {
+#if EMU8950_OPL3
+// OPL3 waveforms 4-7. These are looked up in software; the interpolator set-up
+// and the assembly only know the four OPL2 shapes.
+static INLINE uint16_t ext_wave(const SLOT_RENDER *slot, uint32_t index) {
+    switch (slot->patch->WS) {
+        case 4: // sine at double frequency, silent second half
+            if (index & (PG_WIDTH / 2)) return 0xfff;
+            return ((index & (PG_WIDTH / 4)) ? 0x8000 : 0) | logsin_table[(index << 1) & (PG_WIDTH / 2 - 1)];
+        case 5: // abs(sine) at double frequency, silent second half
+            if (index & (PG_WIDTH / 2)) return 0xfff;
+            return logsin_table[(index << 1) & (PG_WIDTH / 2 - 1)];
+        case 6: // square
+            return (index & (PG_WIDTH / 2)) ? 0x8000 : 0;
+        default: // 7: derived square (logarithmic sawtooth)
+            if (index & (PG_WIDTH / 2)) return 0x8000 | (((~index) & (PG_WIDTH / 2 - 1)) << 3);
+            return (index & (PG_WIDTH / 2 - 1)) << 3;
+    }
+}
+#endif
+
+template <bool EXT = false> static INLINE int16_t calc_sample(const SLOT_RENDER *slot, uint32_t index, int16_t am) {
 
 #if !EMU8950_NO_WAVE_TABLE_MAP
     uint16_t h = slot->wave_table[index & (PG_WIDTH - 1)];
@@ -187,6 +207,9 @@ static INLINE int16_t calc_sample(const SLOT_RENDER *slot, uint32_t index, int16
 #else
     uint16_t h =  slot->wav_or_table[(index >> (PG_BITS - 2)) & 3] | slot->logsin_table[(index & (PG_WIDTH / 2 - 1))];
 #endif
+#endif
+#if EMU8950_OPL3
+    if (EXT) h = ext_wave(slot, index);
 #endif
     uint16_t att = h + slot->eg_out_tll_lsl3 + am;
     int16_t t = exp_table[att&0xff];
@@ -333,42 +356,42 @@ template<bool PM> uint32_t advance_phase(SLOT_RENDER *slot, uint32_t &pm_phase)
 #endif
 }
 
-template<bool PM> void mod_am1_fb1_fn(SLOT_RENDER *slot, uint32_t& pm_phase, uint32_t s) {
+template <bool PM, bool EXT = false> void mod_am1_fb1_fn(SLOT_RENDER *slot, uint32_t& pm_phase, uint32_t s) {
     int16_t fm = (slot->output[1] + slot->output[0]) >> slot->nine_minus_FB;
     slot->output[1] = slot->output[0];
     uint32_t pg_out = advance_phase<PM>(slot, pm_phase);
-    slot->mod_buffer[s] = slot->output[0] = calc_sample(slot, pg_out + fm, slot->lfo_am_buffer_lsl3[s]);
+    slot->mod_buffer[s] = slot->output[0] = calc_sample<EXT>(slot, pg_out + fm, slot->lfo_am_buffer_lsl3[s]);
 }
 
-template<bool PM> void mod_am1_fb0_fn(SLOT_RENDER *slot, uint32_t& pm_phase, uint32_t s) {
+template <bool PM, bool EXT = false> void mod_am1_fb0_fn(SLOT_RENDER *slot, uint32_t& pm_phase, uint32_t s) {
     uint32_t pg_out = advance_phase<PM>(slot, pm_phase);
-    slot->mod_buffer[s] = calc_sample(slot, pg_out, slot->lfo_am_buffer_lsl3[s]);
+    slot->mod_buffer[s] = calc_sample<EXT>(slot, pg_out, slot->lfo_am_buffer_lsl3[s]);
 }
 
-template <bool PM> void mod_am0_fb1_fn(SLOT_RENDER *slot, uint32_t& pm_phase, uint32_t s) {
+template <bool PM, bool EXT = false> void mod_am0_fb1_fn(SLOT_RENDER *slot, uint32_t& pm_phase, uint32_t s) {
     int16_t fm = (slot->output[1] + slot->output[0]) >> slot->nine_minus_FB;
     slot->output[1] = slot->output[0];
     uint32_t pg_out = advance_phase<PM>(slot, pm_phase);
 
-    slot->mod_buffer[s] = slot->output[0] = calc_sample(slot, pg_out + fm, 0);
+    slot->mod_buffer[s] = slot->output[0] = calc_sample<EXT>(slot, pg_out + fm, 0);
 }
 
-template <bool PM> void mod_am0_fb0_fn(SLOT_RENDER *slot, uint32_t& pm_phase, uint32_t s) {
+template <bool PM, bool EXT = false> void mod_am0_fb0_fn(SLOT_RENDER *slot, uint32_t& pm_phase, uint32_t s) {
     uint32_t pg_out = advance_phase<PM>(slot, pm_phase);
-    slot->mod_buffer[s] = calc_sample(slot, pg_out, 0);
+    slot->mod_buffer[s] = calc_sample<EXT>(slot, pg_out, 0);
 
 }
 
-template <bool PM> void alg0_am1_fn(SLOT_RENDER *slot, uint32_t& pm_phase, uint32_t s) {
+template <bool PM, bool EXT = false> void alg0_am1_fn(SLOT_RENDER *slot, uint32_t& pm_phase, uint32_t s) {
     // todo is this masking realy necessary; i doubt it. .. seems to be always even anyway
 //        int32_t fm = 2 * (opl->mod_buffer[s] >> 1);
     int32_t fm = slot->mod_buffer[s];
     uint32_t pg_out = advance_phase<PM>(slot, pm_phase);
-    int32_t val = calc_sample(slot, pg_out + fm, slot->lfo_am_buffer_lsl3[s]);
+    int32_t val = calc_sample<EXT>(slot, pg_out + fm, slot->lfo_am_buffer_lsl3[s]);
     slot->buffer[s] += val;
 }
 
-template <bool PM> void alg0_am0_fn(SLOT_RENDER *slot, uint32_t& pm_phase, uint32_t s) {
+template <bool PM, bool EXT = false> void alg0_am0_fn(SLOT_RENDER *slot, uint32_t& pm_phase, uint32_t s) {
     // todo could reset these when we start a new note
 //    slot->output[1] = slot->output[0];
 
@@ -377,23 +400,46 @@ template <bool PM> void alg0_am0_fn(SLOT_RENDER *slot, uint32_t& pm_phase, uint3
     int32_t fm = slot->mod_buffer[s];
 
     uint32_t pg_out = advance_phase<PM>(slot, pm_phase);
-    int32_t val = calc_sample(slot, pg_out + fm, 0);
+    int32_t val = calc_sample<EXT>(slot, pg_out + fm, 0);
     slot->buffer[s] += val;
 }
 
 
-template <bool PM> void alg1_am1_fn(SLOT_RENDER *slot, uint32_t& pm_phase, uint32_t s) {
+template <bool PM, bool EXT = false> void alg1_am1_fn(SLOT_RENDER *slot, uint32_t& pm_phase, uint32_t s) {
     uint32_t pg_out = advance_phase<PM>(slot, pm_phase);
-    int16_t val = calc_sample(slot, pg_out, slot->lfo_am_buffer_lsl3[s]);
+    int16_t val = calc_sample<EXT>(slot, pg_out, slot->lfo_am_buffer_lsl3[s]);
     slot->buffer[s] += val + slot->mod_buffer[s];
 }
 
-template <bool PM> void alg1_am0_fn(SLOT_RENDER *slot, uint32_t& pm_phase, uint32_t s) {
+template <bool PM, bool EXT = false> void alg1_am0_fn(SLOT_RENDER *slot, uint32_t& pm_phase, uint32_t s) {
     uint32_t pg_out = advance_phase<PM>(slot, pm_phase);
-    int16_t val = calc_sample(slot, pg_out, 0);
+    int16_t val = calc_sample<EXT>(slot, pg_out, 0);
     slot->buffer[s] += val + slot->mod_buffer[s];
 }
 
+#if EMU8950_OPL3
+// OPL3 4-op middle operators: modulated by mod_buffer, and their output replaces it as the input of the next operator
+template <bool PM, bool EXT> void chain_am1_fn(SLOT_RENDER *slot, uint32_t& pm_phase, uint32_t s) {
+    int32_t fm = slot->mod_buffer[s];
+    uint32_t pg_out = advance_phase<PM>(slot, pm_phase);
+    slot->mod_buffer[s] = calc_sample<EXT>(slot, pg_out + fm, slot->lfo_am_buffer_lsl3[s]);
+}
+
+template <bool PM, bool EXT> void chain_am0_fn(SLOT_RENDER *slot, uint32_t& pm_phase, uint32_t s) {
+    int32_t fm = slot->mod_buffer[s];
+    uint32_t pg_out = advance_phase<PM>(slot, pm_phase);
+    slot->mod_buffer[s] = calc_sample<EXT>(slot, pg_out + fm, 0);
+}
+
+// rhythm HH/SD/CYM: the wave index comes precomputed in mod_buffer (see slot_rhythm_phases), the phase is not advanced here
+template <bool AM, bool EXT> void index_fn(SLOT_RENDER *slot, uint32_t&, uint32_t s) {
+    int32_t val = calc_sample<EXT>(slot, (uint16_t)slot->mod_buffer[s], AM ? slot->lfo_am_buffer_lsl3[s] : 0);
+    slot->buffer[s] += val;
+}
+
+#define SLOT_FN_EXT 32
+#endif
+
 #if PICO_ON_DEVICE
 extern "C" uint32_t test_slot_asm(SLOT_RENDER *slot, uint32_t nsamples, uint32_t eg_counter, uint fn);
 #endif
@@ -460,11 +506,14 @@ template <int F_NUM, typename F> uint32_t slot_envelope_loop(F&& fn, SLOT_RENDER
     slot->eg_out_tll_lsl3 = std::min(EG_MAX/*EG_MUTE*/, slot->eg_out + slot->tll) << 3; // note EG_MAX not EG_MUTE to avoid overflow check later
 
 #if PICO_ON_DEVICE && EMU8950_ASM
-    // we lookup in mod_buffer at buffer_mod_buffer_offset + sample_ptr_in_buffer / 2
-    slot->buffer_mod_buffer_offset = (uintptr_t)slot->mod_buffer - ((uintptr_t)slot->buffer) / 2;
-    s = test_slot_asm(slot, nsamples, eg_counter, F_NUM);
-    slot->pg_phase = interp1->accum[0];
-    return s;
+    // the assembly only implements the OPL2 functions (F_NUM 0-15)
+    if (F_NUM < 16) {
+        // we lookup in mod_buffer at buffer_mod_buffer_offset + sample_ptr_in_buffer / 2
+        slot->buffer_mod_buffer_offset = (uintptr_t)slot->mod_buffer - ((uintptr_t)slot->buffer) / 2;
+        s = test_slot_asm(slot, nsamples, eg_counter, F_NUM);
+        slot->pg_phase = interp1->accum[0];
+        return s;
+    }
 #endif
     // todo eg_rate_h == 0 ...
     // todo prate == 0 ?
@@ -596,60 +645,178 @@ template <int F_NUM, typename F> uint32_t slot_envelope_loop(F&& fn, SLOT_RENDER
 
 typedef void OPL;
 
-template<bool PM> uint32_t slot_mod_linear(OPL *opl, SLOT_RENDER *slot, uint32_t nsamples, uint32_t eg_counter, uint32_t pm_phase) {
+#if EMU8950_OPL3
+#define SLOT_FN(f) ((f) + (EXT ? SLOT_FN_EXT : 0))
+#else
+#define SLOT_FN(f) (f)
+#endif
+
+template<bool PM, bool EXT> uint32_t slot_mod_linear(SLOT_RENDER *slot, uint32_t nsamples, uint32_t eg_counter, uint32_t pm_phase) {
     if (slot->patch->AM) {
         if (slot->patch->FB) {
             slot->nine_minus_FB = 9 - slot->patch->FB;
-            return slot_envelope_loop<6+PM>(mod_am1_fb1_fn<PM>, slot, nsamples, eg_counter, pm_phase);
+            return slot_envelope_loop<SLOT_FN(6+PM)>(mod_am1_fb1_fn<PM, EXT>, slot, nsamples, eg_counter, pm_phase);
         } else {
-            return slot_envelope_loop<2+PM>(mod_am1_fb0_fn<PM>, slot, nsamples, eg_counter, pm_phase);
+            return slot_envelope_loop<SLOT_FN(2+PM)>(mod_am1_fb0_fn<PM, EXT>, slot, nsamples, eg_counter, pm_phase);
         }
     } else {
         if (slot->patch->FB) {
             slot->nine_minus_FB = 9 - slot->patch->FB;
-            return slot_envelope_loop<4+PM>(mod_am0_fb1_fn<PM>, slot, nsamples, eg_counter, pm_phase);
+            return slot_envelope_loop<SLOT_FN(4+PM)>(mod_am0_fb1_fn<PM, EXT>, slot, nsamples, eg_counter, pm_phase);
         } else {
-            return slot_envelope_loop<0+PM>(mod_am0_fb0_fn<PM>, slot, nsamples, eg_counter, pm_phase);
+            return slot_envelope_loop<SLOT_FN(0+PM)>(mod_am0_fb0_fn<PM, EXT>, slot, nsamples, eg_counter, pm_phase);
         }
     }
 }
 
-extern "C" uint32_t slot_mod_linear(OPL *opl, SLOT_RENDER *slot, uint32_t nsamples, uint32_t eg_counter, uint32_t pm_phase) {
+extern "C" uint32_t slot_mod_linear(OPL *, SLOT_RENDER *slot, uint32_t nsamples, uint32_t eg_counter, uint32_t pm_phase) {
+#if EMU8950_OPL3
+    if (slot->patch->WS >= 4) {
+        if (slot->patch->PM)
+            return slot_mod_linear<true, true>(slot, nsamples, eg_counter, pm_phase);
+        else
+            return slot_mod_linear<false, true>(slot, nsamples, eg_counter, pm_phase);
+    }
+#endif
     if (slot->patch->PM)
-        return slot_mod_linear<true>(opl, slot, nsamples, eg_counter, pm_phase);
+        return slot_mod_linear<true, false>(slot, nsamples, eg_counter, pm_phase);
     else
-        return slot_mod_linear<false>(opl, slot, nsamples, eg_counter, pm_phase);
+        return slot_mod_linear<false, false>(slot, nsamples, eg_counter, pm_phase);
 }
 
-template<bool PM> uint32_t slot_car_linear_alg0(OPL *opl, SLOT_RENDER *slot, uint32_t nsamples, uint32_t eg_counter, uint32_t pm_phase) {
+template<bool PM, bool EXT> uint32_t slot_car_linear_alg0(SLOT_RENDER *slot, uint32_t nsamples, uint32_t eg_counter, uint32_t pm_phase) {
     if (slot->patch->AM) {
-        return slot_envelope_loop<10+PM>(alg0_am1_fn<PM>, slot, nsamples, eg_counter, pm_phase);
+        return slot_envelope_loop<SLOT_FN(10+PM)>(alg0_am1_fn<PM, EXT>, slot, nsamples, eg_counter, pm_phase);
     } else {
-        return slot_envelope_loop<8+PM>(alg0_am0_fn<PM>, slot, nsamples, eg_counter, pm_phase);
+        return slot_envelope_loop<SLOT_FN(8+PM)>(alg0_am0_fn<PM, EXT>, slot, nsamples, eg_counter, pm_phase);
     }
 }
 
-extern "C" uint32_t slot_car_linear_alg0(OPL *opl, SLOT_RENDER *slot, uint32_t nsamples, uint32_t eg_counter, uint32_t pm_phase) {
+extern "C" uint32_t slot_car_linear_alg0(OPL *, SLOT_RENDER *slot, uint32_t nsamples, uint32_t eg_counter, uint32_t pm_phase) {
+#if EMU8950_OPL3
+    if (slot->patch->WS >= 4) {
+        if (slot->patch->PM)
+            return slot_car_linear_alg0<true, true>(slot, nsamples, eg_counter, pm_phase);
+        else
+            return slot_car_linear_alg0<false, true>(slot, nsamples, eg_counter, pm_phase);
+    }
+#endif
     if (slot->patch->PM)
-        return slot_car_linear_alg0<true>(opl, slot, nsamples, eg_counter, pm_phase);
+        return slot_car_linear_alg0<true, false>(slot, nsamples, eg_counter, pm_phase);
     else
-        return slot_car_linear_alg0<false>(opl, slot, nsamples, eg_counter, pm_phase);
+        return slot_car_linear_alg0<false, false>(slot, nsamples, eg_counter, pm_phase);
 }
 
-template<bool PM> uint32_t slot_car_linear_alg1(OPL *opl, SLOT_RENDER *slot, uint32_t nsamples, uint32_t eg_counter, uint32_t pm_phase) {
+template<bool PM, bool EXT> uint32_t slot_car_linear_alg1(SLOT_RENDER *slot, uint32_t nsamples, uint32_t eg_counter, uint32_t pm_phase) {
 
     if (slot->patch->AM) {
-        return slot_envelope_loop<14+PM>(alg1_am1_fn<PM>, slot, nsamples, eg_counter, pm_phase);
+        return slot_envelope_loop<SLOT_FN(14+PM)>(alg1_am1_fn<PM, EXT>, slot, nsamples, eg_counter, pm_phase);
     } else {
-        return slot_envelope_loop<12+PM>(alg1_am0_fn<PM>, slot, nsamples, eg_counter, pm_phase);
+        return slot_envelope_loop<SLOT_FN(12+PM)>(alg1_am0_fn<PM, EXT>, slot, nsamples, eg_counter, pm_phase);
     }
 }
 
 
-extern "C" uint32_t slot_car_linear_alg1(OPL *opl, SLOT_RENDER *slot, uint32_t nsamples, uint32_t eg_counter, uint32_t pm_phase) {
+extern "C" uint32_t slot_car_linear_alg1(OPL *, SLOT_RENDER *slot, uint32_t nsamples, uint32_t eg_counter, uint32_t pm_phase) {
+#if EMU8950_OPL3
+    if (slot->patch->WS >= 4) {
+        if (slot->patch->PM)
+            return slot_car_linear_alg1<true, true>(slot, nsamples, eg_counter, pm_phase);
+        else
+            return slot_car_linear_alg1<false, true>(slot, nsamples, eg_counter, pm_phase);
+    }
+#endif
     if (slot->patch->PM)
-        return slot_car_linear_alg1<true>(opl, slot, nsamples, eg_counter, pm_phase);
+        return slot_car_linear_alg1<true, false>(slot, nsamples, eg_counter, pm_phase);
     else
-        return slot_car_linear_alg1<false>(opl, slot, nsamples, eg_counter, pm_phase);
+        return slot_car_linear_alg1<false, false>(slot, nsamples, eg_counter, pm_phase);
 }
-#endif
\ No newline at end of file
+
+#if EMU8950_OPL3
+template<bool PM, bool EXT> uint32_t slot_chain_linear(SLOT_RENDER *slot, uint32_t nsamples, uint32_t eg_counter, uint32_t pm_phase) {
+    if (slot->patch->AM) {
+        return slot_envelope_loop<SLOT_FN(18+PM)>(chain_am1_fn<PM, EXT>, slot, nsamples, eg_counter, pm_phase);
+    } else {
+        return slot_envelope_loop<SLOT_FN(16+PM)>(chain_am0_fn<PM, EXT>, slot, nsamples, eg_counter, pm_phase);
+    }
+}
+
+// 4-op middle operator: mod_buffer in, mod_buffer out
+extern "C" uint32_t slot_chain_linear(OPL *, SLOT_RENDER *slot, uint32_t nsamples, uint32_t eg_counter, uint32_t pm_phase) {
+    if (slot->patch->WS >= 4) {
+        if (slot->patch->PM)
+            return slot_chain_linear<true, true>(slot, nsamples, eg_counter, pm_phase);
+        else
+            return slot_chain_linear<false, true>(slot, nsamples, eg_counter, pm_phase);
+    }
+    if (slot->patch->PM)
+        return slot_chain_linear<true, false>(slot, nsamples, eg_counter, pm_phase);
+    else
+        return slot_chain_linear<false, false>(slot, nsamples, eg_counter, pm_phase);
+}
+
+template<bool EXT> uint32_t slot_index_linear(SLOT_RENDER *slot, uint32_t nsamples, uint32_t eg_counter, uint32_t pm_phase) {
+    if (slot->patch->AM) {
+        return slot_envelope_loop<SLOT_FN(21)>(index_fn<true, EXT>, slot, nsamples, eg_counter, pm_phase);
+    } else {
+        return slot_envelope_loop<SLOT_FN(20)>(index_fn<false, EXT>, slot, nsamples, eg_counter, pm_phase);
+    }
+}
+
+// rhythm HH/SD/CYM: wave indices from mod_buffer, output added to buffer
+extern "C" uint32_t slot_index_linear(OPL *, SLOT_RENDER *slot, uint32_t nsamples, uint32_t eg_counter, uint32_t pm_phase) {
+    if (slot->patch->WS >= 4)
+        return slot_index_linear<true>(slot, nsamples, eg_counter, pm_phase);
+    else
+        return slot_index_linear<false>(slot, nsamples, eg_counter, pm_phase);
+}
+
+static INLINE uint32_t rhythm_phase(SLOT_RENDER *slot, uint32_t pm_phase) {
+    int8_t pm = 0;
+    if (slot->patch->PM) {
+        pm = (slot->pm_mode ? pm_table : pm_table_half)[(slot->fnum >> 7) & 7][pm_phase >> (PM_DP_BITS - PM_PG_BITS)];
+    }
+    slot->pg_phase += ((slot->fnum & 0x3ff) + pm) * (ml_table[slot->patch->ML] << slot->blk);
+    slot->pg_phase &= (DP_WIDTH * 2 - 1);
+    return slot->pg_phase >> (DP_BASE_BITS + 1);
+}
+
+// Advance the HH and CYM phase generators and the noise LFSR for nsamples, producing the wave indices
+// of HH, SD and CYM in the same order as the per sample emu8950 update_output()
+extern "C" void slot_rhythm_phases(SLOT_RENDER *hh, SLOT_RENDER *cym, uint32_t *noise, int16_t *hh_index, int16_t *sd_index,
+                                   int16_t *cym_index, uint32_t nsamples, uint32_t pm_phase) {
+    uint32_t n = *noise;
+    uint32_t pg_hh = hh->pg_phase >> (DP_BASE_BITS + 1);
+    uint32_t pg_cym = cym->pg_phase >> (DP_BASE_BITS + 1);
+    for (uint32_t s = 0; s < nsamples; s++) {
+        uint32_t short_noise = (((pg_hh >> (PG_BITS - 8)) ^ (pg_hh >> (PG_BITS - 3))) |
+                                ((pg_hh >> (PG_BITS - 7)) ^ (pg_cym >> (PG_BITS - 5))) |
+                                ((pg_cym >> (PG_BITS - 7)) ^ (pg_cym >> (PG_BITS - 5)))) & 1;
+        pm_phase = (pm_phase + PM_DPHASE) & (PM_DP_WIDTH - 1);
+        pg_hh = rhythm_phase(hh, pm_phase);
+        pg_cym = rhythm_phase(cym, pm_phase);
+        for (int i = 0; i < 14; i++) {
+            if (n & 1) n ^= 0x800200;
+            n >>= 1;
+        }
+        uint32_t nb = n & 1;
+        if (short_noise) {
+            hh_index[s] = nb ? 0x2d0 : 0x234;
+        } else {
+            hh_index[s] = nb ? 0x34 : 0xd0;
+        }
+        if (pg_hh & (1 << (PG_BITS - 2))) {
+            sd_index[s] = nb ? 0x300 : 0x200;
+        } else {
+            sd_index[s] = nb ? 0x0 : 0x100;
+        }
+        cym_index[s] = short_noise ? 0x300 : 0x100;
+        for (int i = 0; i < 4; i++) {
+            if (n & 1) n ^= 0x800200;
+            n >>= 1;
+        }
+    }
+    *noise = n;
+}
+#endif
+#endif
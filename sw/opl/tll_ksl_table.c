@@ -0,0 +1,135 @@
+/* Auto-generated by gen_tll_table.py — do not edit manually. */
+/* Key scale level part of the EMU8950 TLL (Total Level Lookup) table: */
+/* tll = tll_ksl_table[blk_fnum >> 6][KL] + TL2EG(TL) (see makeTllTable()). */
+#include <stdint.h>
+
+const uint8_t tll_ksl_table[128][4] = {
+    {  0,   0,   0,   0}, /* blk_fnum=0 */
+    {  0,   0,   0,   0}, /* blk_fnum=1 */
+    {  0,   0,   0,   0}, /* blk_fnum=2 */
+    {  0,   0,   0,   0}, /* blk_fnum=3 */
+    {  0,   0,   0,   0}, /* blk_fnum=4 */
+    {  0,   0,   0,   0}, /* blk_fnum=5 */
+    {  0,   0,   0,   0}, /* blk_fnum=6 */
+    {  0,   0,   0,   0}, /* blk_fnum=7 */
+    {  0,   0,   0,   0}, /* blk_fnum=8 */
+    {  0,   0,   0,   0}, /* blk_fnum=9 */
+    {  0,   0,   0,   0}, /* blk_fnum=10 */
+    {  0,   0,   0,   0}, /* blk_fnum=11 */
+    {  0,   0,   0,   0}, /* blk_fnum=12 */
+    {  0,   0,   0,   0}, /* blk_fnum=13 */
+    {  0,   0,   0,   0}, /* blk_fnum=14 */
+    {  0,   0,   0,   0}, /* blk_fnum=15 */
+    {  0,   0,   0,   0}, /* blk_fnum=16 */
+    {  0,   0,   0,   0}, /* blk_fnum=17 */
+    {  0,   0,   0,   0}, /* blk_fnum=18 */
+    {  0,   0,   0,   0}, /* blk_fnum=19 */
+    {  0,   0,   0,   0}, /* blk_fnum=20 */
+    {  0,   0,   0,   0}, /* blk_fnum=21 */
+    {  0,   0,   0,   0}, /* blk_fnum=22 */
+    {  0,   0,   0,   0}, /* blk_fnum=23 */
+    {  0,   0,   0,   0}, /* blk_fnum=24 */
+    {  0,   4,   2,   8}, /* blk_fnum=25 */
+    {  0,   6,   3,  12}, /* blk_fnum=26 */
+    {  0,   8,   4,  16}, /* blk_fnum=27 */
+    {  0,  10,   5,  20}, /* blk_fnum=28 */
+    {  0,  12,   6,  24}, /* blk_fnum=29 */
+    {  0,  14,   7,  28}, /* blk_fnum=30 */
+    {  0,  16,   8,  32}, /* blk_fnum=31 */
+    {  0,   0,   0,   0}, /* blk_fnum=32 */
+    {  0,   0,   0,   0}, /* blk_fnum=33 */
+    {  0,   0,   0,   0}, /* blk_fnum=34 */
+    {  0,   0,   0,   0}, /* blk_fnum=35 */
+    {  0,   0,   0,   0}, /* blk_fnum=36 */
+    {  0,   6,   3,  12}, /* blk_fnum=37 */
+    {  0,  10,   5,  20}, /* blk_fnum=38 */
+    {  0,  14,   7,  28}, /* blk_fnum=39 */
+    {  0,  16,   8,  32}, /* blk_fnum=40 */
+    {  0,  20,  10,  40}, /* blk_fnum=41 */
+    {  0,  22,  11,  44}, /* blk_fnum=42 */
+    {  0,  24,  12,  48}, /* blk_fnum=43 */
+    {  0,  26,  13,  52}, /* blk_fnum=44 */
+    {  0,  28,  14,  56}, /* blk_fnum=45 */
+    {  0,  30,  15,  60}, /* blk_fnum=46 */
+    {  0,  32,  16,  64}, /* blk_fnum=47 */
+    {  0,   0,   0,   0}, /* blk_fnum=48 */
+    {  0,   0,   0,   0}, /* blk_fnum=49 */
+    {  0,   0,   0,   0}, /* blk_fnum=50 */
+    {  0,  10,   5,  20}, /* blk_fnum=51 */
+    {  0,  16,   8,  32}, /* blk_fnum=52 */
+    {  0,  22,  11,  44}, /* blk_fnum=53 */
+    {  0,  26,  13,  52}, /* blk_fnum=54 */
+    {  0,  30,  15,  60}, /* blk_fnum=55 */
+    {  0,  32,  16,  64}, /* blk_fnum=56 */
+    {  0,  36,  18,  72}, /* blk_fnum=57 */
+    {  0,  38,  19,  76}, /* blk_fnum=58 */
+    {  0,  40,  20,  80}, /* blk_fnum=59 */
+    {  0,  42,  21,  84}, /* blk_fnum=60 */
+    {  0,  44,  22,  88}, /* blk_fnum=61 */
+    {  0,  46,  23,  92}, /* blk_fnum=62 */
+    {  0,  48,  24,  96}, /* blk_fnum=63 */
+    {  0,   0,   0,   0}, /* blk_fnum=64 */
+    {  0,   0,   0,   0}, /* blk_fnum=65 */
+    {  0,  16,   8,  32}, /* blk_fnum=66 */
+    {  0,  26,  13,  52}, /* blk_fnum=67 */
+    {  0,  32,  16,  64}, /* blk_fnum=68 */
+    {  0,  38,  19,  76}, /* blk_fnum=69 */
+    {  0,  42,  21,  84}, /* blk_fnum=70 */
+    {  0,  46,  23,  92}, /* blk_fnum=71 */
+    {  0,  48,  24,  96}, /* blk_fnum=72 */
+    {  0,  52,  26, 104}, /* blk_fnum=73 */
+    {  0,  54,  27, 108}, /* blk_fnum=74 */
+    {  0,  56,  28, 112}, /* blk_fnum=75 */
+    {  0,  58,  29, 116}, /* blk_fnum=76 */
+    {  0,  60,  30, 120}, /* blk_fnum=77 */
+    {  0,  62,  31, 124}, /* blk_fnum=78 */
+    {  0,  64,  32, 128}, /* blk_fnum=79 */
+    {  0,   0,   0,   0}, /* blk_fnum=80 */
+    {  0,  16,   8,  32}, /* blk_fnum=81 */
+    {  0,  32,  16,  64}, /* blk_fnum=82 */
+    {  0,  42,  21,  84}, /* blk_fnum=83 */
+    {  0,  48,  24,  96}, /* blk_fnum=84 */
+    {  0,  54,  27, 108}, /* blk_fnum=85 */
+    {  0,  58,  29, 116}, /* blk_fnum=86 */
+    {  0,  62,  31, 124}, /* blk_fnum=87 */
+    {  0,  64,  32, 128}, /* blk_fnum=88 */
+    {  0,  68,  34, 136}, /* blk_fnum=89 */
+    {  0,  70,  35, 140}, /* blk_fnum=90 */
+    {  0,  72,  36, 144}, /* blk_fnum=91 */
+    {  0,  74,  37, 148}, /* blk_fnum=92 */
+    {  0,  76,  38, 152}, /* blk_fnum=93 */
+    {  0,  78,  39, 156}, /* blk_fnum=94 */
+    {  0,  80,  40, 160}, /* blk_fnum=95 */
+    {  0,   0,   0,   0}, /* blk_fnum=96 */
+    {  0,  32,  16,  64}, /* blk_fnum=97 */
+    {  0,  48,  24,  96}, /* blk_fnum=98 */
+    {  0,  58,  29, 116}, /* blk_fnum=99 */
+    {  0,  64,  32, 128}, /* blk_fnum=100 */
+    {  0,  70,  35, 140}, /* blk_fnum=101 */
+    {  0,  74,  37, 148}, /* blk_fnum=102 */
+    {  0,  78,  39, 156}, /* blk_fnum=103 */
+    {  0,  80,  40, 160}, /* blk_fnum=104 */
+    {  0,  84,  42, 168}, /* blk_fnum=105 */
+    {  0,  86,  43, 172}, /* blk_fnum=106 */
+    {  0,  88,  44, 176}, /* blk_fnum=107 */
+    {  0,  90,  45, 180}, /* blk_fnum=108 */
+    {  0,  92,  46, 184}, /* blk_fnum=109 */
+    {  0,  94,  47, 188}, /* blk_fnum=110 */
+    {  0,  96,  48, 192}, /* blk_fnum=111 */
+    {  0,   0,   0,   0}, /* blk_fnum=112 */
+    {  0,  48,  24,  96}, /* blk_fnum=113 */
+    {  0,  64,  32, 128}, /* blk_fnum=114 */
+    {  0,  74,  37, 148}, /* blk_fnum=115 */
+    {  0,  80,  40, 160}, /* blk_fnum=116 */
+    {  0,  86,  43, 172}, /* blk_fnum=117 */
+    {  0,  90,  45, 180}, /* blk_fnum=118 */
+    {  0,  94,  47, 188}, /* blk_fnum=119 */
+    {  0,  96,  48, 192}, /* blk_fnum=120 */
+    {  0, 100,  50, 200}, /* blk_fnum=121 */
+    {  0, 102,  51, 204}, /* blk_fnum=122 */
+    {  0, 104,  52, 208}, /* blk_fnum=123 */
+    {  0, 106,  53, 212}, /* blk_fnum=124 */
+    {  0, 108,  54, 216}, /* blk_fnum=125 */
+    {  0, 110,  55, 220}, /* blk_fnum=126 */
+    {  0, 112,  56, 224}, /* blk_fnum=127 */
+};
@@ -1,8460 +0,0 @@
-/* Auto-generated by gen_tll_table.py  do not edit manually. */
-/* Pre-computed EMU8950 TLL (Total Level Lookup) table for RP2040 flash (XIP). */
-/* Replicates makeTllTable() integer path; stored as const in .flashdata section so
- * pico-sdk copy_to_ram linker scripts keep it in flash rather than copying to RAM. */
-#include <stdint.h>
-
-/* __attribute__((section(".flashdata.tll_table"))) keeps this in flash even in
- * copy_to_ram builds (both memmap_copy_to_ram.ld and fw_memmap_c2ram.ld capture
- * .flashdata* into the FLASH .rodata region, not the RAM .data region). */
-const uint32_t __attribute__((section(".flashdata.tll_table")))
-    tll_table[128][64][4] = {
-    { /* blk_fnum=0 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=1 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=2 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=3 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=4 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=5 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=6 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=7 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=8 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=9 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=10 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=11 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=12 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=13 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=14 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=15 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=16 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=17 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=18 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=19 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=20 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=21 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=22 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=23 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=24 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=25 */
-        {0, 4, 2, 8},
-        {4, 8, 6, 12},
-        {8, 12, 10, 16},
-        {12, 16, 14, 20},
-        {16, 20, 18, 24},
-        {20, 24, 22, 28},
-        {24, 28, 26, 32},
-        {28, 32, 30, 36},
-        {32, 36, 34, 40},
-        {36, 40, 38, 44},
-        {40, 44, 42, 48},
-        {44, 48, 46, 52},
-        {48, 52, 50, 56},
-        {52, 56, 54, 60},
-        {56, 60, 58, 64},
-        {60, 64, 62, 68},
-        {64, 68, 66, 72},
-        {68, 72, 70, 76},
-        {72, 76, 74, 80},
-        {76, 80, 78, 84},
-        {80, 84, 82, 88},
-        {84, 88, 86, 92},
-        {88, 92, 90, 96},
-        {92, 96, 94, 100},
-        {96, 100, 98, 104},
-        {100, 104, 102, 108},
-        {104, 108, 106, 112},
-        {108, 112, 110, 116},
-        {112, 116, 114, 120},
-        {116, 120, 118, 124},
-        {120, 124, 122, 128},
-        {124, 128, 126, 132},
-        {128, 132, 130, 136},
-        {132, 136, 134, 140},
-        {136, 140, 138, 144},
-        {140, 144, 142, 148},
-        {144, 148, 146, 152},
-        {148, 152, 150, 156},
-        {152, 156, 154, 160},
-        {156, 160, 158, 164},
-        {160, 164, 162, 168},
-        {164, 168, 166, 172},
-        {168, 172, 170, 176},
-        {172, 176, 174, 180},
-        {176, 180, 178, 184},
-        {180, 184, 182, 188},
-        {184, 188, 186, 192},
-        {188, 192, 190, 196},
-        {192, 196, 194, 200},
-        {196, 200, 198, 204},
-        {200, 204, 202, 208},
-        {204, 208, 206, 212},
-        {208, 212, 210, 216},
-        {212, 216, 214, 220},
-        {216, 220, 218, 224},
-        {220, 224, 222, 228},
-        {224, 228, 226, 232},
-        {228, 232, 230, 236},
-        {232, 236, 234, 240},
-        {236, 240, 238, 244},
-        {240, 244, 242, 248},
-        {244, 248, 246, 252},
-        {248, 252, 250, 256},
-        {252, 256, 254, 260},
-    },
-    { /* blk_fnum=26 */
-        {0, 6, 3, 12},
-        {4, 10, 7, 16},
-        {8, 14, 11, 20},
-        {12, 18, 15, 24},
-        {16, 22, 19, 28},
-        {20, 26, 23, 32},
-        {24, 30, 27, 36},
-        {28, 34, 31, 40},
-        {32, 38, 35, 44},
-        {36, 42, 39, 48},
-        {40, 46, 43, 52},
-        {44, 50, 47, 56},
-        {48, 54, 51, 60},
-        {52, 58, 55, 64},
-        {56, 62, 59, 68},
-        {60, 66, 63, 72},
-        {64, 70, 67, 76},
-        {68, 74, 71, 80},
-        {72, 78, 75, 84},
-        {76, 82, 79, 88},
-        {80, 86, 83, 92},
-        {84, 90, 87, 96},
-        {88, 94, 91, 100},
-        {92, 98, 95, 104},
-        {96, 102, 99, 108},
-        {100, 106, 103, 112},
-        {104, 110, 107, 116},
-        {108, 114, 111, 120},
-        {112, 118, 115, 124},
-        {116, 122, 119, 128},
-        {120, 126, 123, 132},
-        {124, 130, 127, 136},
-        {128, 134, 131, 140},
-        {132, 138, 135, 144},
-        {136, 142, 139, 148},
-        {140, 146, 143, 152},
-        {144, 150, 147, 156},
-        {148, 154, 151, 160},
-        {152, 158, 155, 164},
-        {156, 162, 159, 168},
-        {160, 166, 163, 172},
-        {164, 170, 167, 176},
-        {168, 174, 171, 180},
-        {172, 178, 175, 184},
-        {176, 182, 179, 188},
-        {180, 186, 183, 192},
-        {184, 190, 187, 196},
-        {188, 194, 191, 200},
-        {192, 198, 195, 204},
-        {196, 202, 199, 208},
-        {200, 206, 203, 212},
-        {204, 210, 207, 216},
-        {208, 214, 211, 220},
-        {212, 218, 215, 224},
-        {216, 222, 219, 228},
-        {220, 226, 223, 232},
-        {224, 230, 227, 236},
-        {228, 234, 231, 240},
-        {232, 238, 235, 244},
-        {236, 242, 239, 248},
-        {240, 246, 243, 252},
-        {244, 250, 247, 256},
-        {248, 254, 251, 260},
-        {252, 258, 255, 264},
-    },
-    { /* blk_fnum=27 */
-        {0, 8, 4, 16},
-        {4, 12, 8, 20},
-        {8, 16, 12, 24},
-        {12, 20, 16, 28},
-        {16, 24, 20, 32},
-        {20, 28, 24, 36},
-        {24, 32, 28, 40},
-        {28, 36, 32, 44},
-        {32, 40, 36, 48},
-        {36, 44, 40, 52},
-        {40, 48, 44, 56},
-        {44, 52, 48, 60},
-        {48, 56, 52, 64},
-        {52, 60, 56, 68},
-        {56, 64, 60, 72},
-        {60, 68, 64, 76},
-        {64, 72, 68, 80},
-        {68, 76, 72, 84},
-        {72, 80, 76, 88},
-        {76, 84, 80, 92},
-        {80, 88, 84, 96},
-        {84, 92, 88, 100},
-        {88, 96, 92, 104},
-        {92, 100, 96, 108},
-        {96, 104, 100, 112},
-        {100, 108, 104, 116},
-        {104, 112, 108, 120},
-        {108, 116, 112, 124},
-        {112, 120, 116, 128},
-        {116, 124, 120, 132},
-        {120, 128, 124, 136},
-        {124, 132, 128, 140},
-        {128, 136, 132, 144},
-        {132, 140, 136, 148},
-        {136, 144, 140, 152},
-        {140, 148, 144, 156},
-        {144, 152, 148, 160},
-        {148, 156, 152, 164},
-        {152, 160, 156, 168},
-        {156, 164, 160, 172},
-        {160, 168, 164, 176},
-        {164, 172, 168, 180},
-        {168, 176, 172, 184},
-        {172, 180, 176, 188},
-        {176, 184, 180, 192},
-        {180, 188, 184, 196},
-        {184, 192, 188, 200},
-        {188, 196, 192, 204},
-        {192, 200, 196, 208},
-        {196, 204, 200, 212},
-        {200, 208, 204, 216},
-        {204, 212, 208, 220},
-        {208, 216, 212, 224},
-        {212, 220, 216, 228},
-        {216, 224, 220, 232},
-        {220, 228, 224, 236},
-        {224, 232, 228, 240},
-        {228, 236, 232, 244},
-        {232, 240, 236, 248},
-        {236, 244, 240, 252},
-        {240, 248, 244, 256},
-        {244, 252, 248, 260},
-        {248, 256, 252, 264},
-        {252, 260, 256, 268},
-    },
-    { /* blk_fnum=28 */
-        {0, 10, 5, 20},
-        {4, 14, 9, 24},
-        {8, 18, 13, 28},
-        {12, 22, 17, 32},
-        {16, 26, 21, 36},
-        {20, 30, 25, 40},
-        {24, 34, 29, 44},
-        {28, 38, 33, 48},
-        {32, 42, 37, 52},
-        {36, 46, 41, 56},
-        {40, 50, 45, 60},
-        {44, 54, 49, 64},
-        {48, 58, 53, 68},
-        {52, 62, 57, 72},
-        {56, 66, 61, 76},
-        {60, 70, 65, 80},
-        {64, 74, 69, 84},
-        {68, 78, 73, 88},
-        {72, 82, 77, 92},
-        {76, 86, 81, 96},
-        {80, 90, 85, 100},
-        {84, 94, 89, 104},
-        {88, 98, 93, 108},
-        {92, 102, 97, 112},
-        {96, 106, 101, 116},
-        {100, 110, 105, 120},
-        {104, 114, 109, 124},
-        {108, 118, 113, 128},
-        {112, 122, 117, 132},
-        {116, 126, 121, 136},
-        {120, 130, 125, 140},
-        {124, 134, 129, 144},
-        {128, 138, 133, 148},
-        {132, 142, 137, 152},
-        {136, 146, 141, 156},
-        {140, 150, 145, 160},
-        {144, 154, 149, 164},
-        {148, 158, 153, 168},
-        {152, 162, 157, 172},
-        {156, 166, 161, 176},
-        {160, 170, 165, 180},
-        {164, 174, 169, 184},
-        {168, 178, 173, 188},
-        {172, 182, 177, 192},
-        {176, 186, 181, 196},
-        {180, 190, 185, 200},
-        {184, 194, 189, 204},
-        {188, 198, 193, 208},
-        {192, 202, 197, 212},
-        {196, 206, 201, 216},
-        {200, 210, 205, 220},
-        {204, 214, 209, 224},
-        {208, 218, 213, 228},
-        {212, 222, 217, 232},
-        {216, 226, 221, 236},
-        {220, 230, 225, 240},
-        {224, 234, 229, 244},
-        {228, 238, 233, 248},
-        {232, 242, 237, 252},
-        {236, 246, 241, 256},
-        {240, 250, 245, 260},
-        {244, 254, 249, 264},
-        {248, 258, 253, 268},
-        {252, 262, 257, 272},
-    },
-    { /* blk_fnum=29 */
-        {0, 12, 6, 24},
-        {4, 16, 10, 28},
-        {8, 20, 14, 32},
-        {12, 24, 18, 36},
-        {16, 28, 22, 40},
-        {20, 32, 26, 44},
-        {24, 36, 30, 48},
-        {28, 40, 34, 52},
-        {32, 44, 38, 56},
-        {36, 48, 42, 60},
-        {40, 52, 46, 64},
-        {44, 56, 50, 68},
-        {48, 60, 54, 72},
-        {52, 64, 58, 76},
-        {56, 68, 62, 80},
-        {60, 72, 66, 84},
-        {64, 76, 70, 88},
-        {68, 80, 74, 92},
-        {72, 84, 78, 96},
-        {76, 88, 82, 100},
-        {80, 92, 86, 104},
-        {84, 96, 90, 108},
-        {88, 100, 94, 112},
-        {92, 104, 98, 116},
-        {96, 108, 102, 120},
-        {100, 112, 106, 124},
-        {104, 116, 110, 128},
-        {108, 120, 114, 132},
-        {112, 124, 118, 136},
-        {116, 128, 122, 140},
-        {120, 132, 126, 144},
-        {124, 136, 130, 148},
-        {128, 140, 134, 152},
-        {132, 144, 138, 156},
-        {136, 148, 142, 160},
-        {140, 152, 146, 164},
-        {144, 156, 150, 168},
-        {148, 160, 154, 172},
-        {152, 164, 158, 176},
-        {156, 168, 162, 180},
-        {160, 172, 166, 184},
-        {164, 176, 170, 188},
-        {168, 180, 174, 192},
-        {172, 184, 178, 196},
-        {176, 188, 182, 200},
-        {180, 192, 186, 204},
-        {184, 196, 190, 208},
-        {188, 200, 194, 212},
-        {192, 204, 198, 216},
-        {196, 208, 202, 220},
-        {200, 212, 206, 224},
-        {204, 216, 210, 228},
-        {208, 220, 214, 232},
-        {212, 224, 218, 236},
-        {216, 228, 222, 240},
-        {220, 232, 226, 244},
-        {224, 236, 230, 248},
-        {228, 240, 234, 252},
-        {232, 244, 238, 256},
-        {236, 248, 242, 260},
-        {240, 252, 246, 264},
-        {244, 256, 250, 268},
-        {248, 260, 254, 272},
-        {252, 264, 258, 276},
-    },
-    { /* blk_fnum=30 */
-        {0, 14, 7, 28},
-        {4, 18, 11, 32},
-        {8, 22, 15, 36},
-        {12, 26, 19, 40},
-        {16, 30, 23, 44},
-        {20, 34, 27, 48},
-        {24, 38, 31, 52},
-        {28, 42, 35, 56},
-        {32, 46, 39, 60},
-        {36, 50, 43, 64},
-        {40, 54, 47, 68},
-        {44, 58, 51, 72},
-        {48, 62, 55, 76},
-        {52, 66, 59, 80},
-        {56, 70, 63, 84},
-        {60, 74, 67, 88},
-        {64, 78, 71, 92},
-        {68, 82, 75, 96},
-        {72, 86, 79, 100},
-        {76, 90, 83, 104},
-        {80, 94, 87, 108},
-        {84, 98, 91, 112},
-        {88, 102, 95, 116},
-        {92, 106, 99, 120},
-        {96, 110, 103, 124},
-        {100, 114, 107, 128},
-        {104, 118, 111, 132},
-        {108, 122, 115, 136},
-        {112, 126, 119, 140},
-        {116, 130, 123, 144},
-        {120, 134, 127, 148},
-        {124, 138, 131, 152},
-        {128, 142, 135, 156},
-        {132, 146, 139, 160},
-        {136, 150, 143, 164},
-        {140, 154, 147, 168},
-        {144, 158, 151, 172},
-        {148, 162, 155, 176},
-        {152, 166, 159, 180},
-        {156, 170, 163, 184},
-        {160, 174, 167, 188},
-        {164, 178, 171, 192},
-        {168, 182, 175, 196},
-        {172, 186, 179, 200},
-        {176, 190, 183, 204},
-        {180, 194, 187, 208},
-        {184, 198, 191, 212},
-        {188, 202, 195, 216},
-        {192, 206, 199, 220},
-        {196, 210, 203, 224},
-        {200, 214, 207, 228},
-        {204, 218, 211, 232},
-        {208, 222, 215, 236},
-        {212, 226, 219, 240},
-        {216, 230, 223, 244},
-        {220, 234, 227, 248},
-        {224, 238, 231, 252},
-        {228, 242, 235, 256},
-        {232, 246, 239, 260},
-        {236, 250, 243, 264},
-        {240, 254, 247, 268},
-        {244, 258, 251, 272},
-        {248, 262, 255, 276},
-        {252, 266, 259, 280},
-    },
-    { /* blk_fnum=31 */
-        {0, 16, 8, 32},
-        {4, 20, 12, 36},
-        {8, 24, 16, 40},
-        {12, 28, 20, 44},
-        {16, 32, 24, 48},
-        {20, 36, 28, 52},
-        {24, 40, 32, 56},
-        {28, 44, 36, 60},
-        {32, 48, 40, 64},
-        {36, 52, 44, 68},
-        {40, 56, 48, 72},
-        {44, 60, 52, 76},
-        {48, 64, 56, 80},
-        {52, 68, 60, 84},
-        {56, 72, 64, 88},
-        {60, 76, 68, 92},
-        {64, 80, 72, 96},
-        {68, 84, 76, 100},
-        {72, 88, 80, 104},
-        {76, 92, 84, 108},
-        {80, 96, 88, 112},
-        {84, 100, 92, 116},
-        {88, 104, 96, 120},
-        {92, 108, 100, 124},
-        {96, 112, 104, 128},
-        {100, 116, 108, 132},
-        {104, 120, 112, 136},
-        {108, 124, 116, 140},
-        {112, 128, 120, 144},
-        {116, 132, 124, 148},
-        {120, 136, 128, 152},
-        {124, 140, 132, 156},
-        {128, 144, 136, 160},
-        {132, 148, 140, 164},
-        {136, 152, 144, 168},
-        {140, 156, 148, 172},
-        {144, 160, 152, 176},
-        {148, 164, 156, 180},
-        {152, 168, 160, 184},
-        {156, 172, 164, 188},
-        {160, 176, 168, 192},
-        {164, 180, 172, 196},
-        {168, 184, 176, 200},
-        {172, 188, 180, 204},
-        {176, 192, 184, 208},
-        {180, 196, 188, 212},
-        {184, 200, 192, 216},
-        {188, 204, 196, 220},
-        {192, 208, 200, 224},
-        {196, 212, 204, 228},
-        {200, 216, 208, 232},
-        {204, 220, 212, 236},
-        {208, 224, 216, 240},
-        {212, 228, 220, 244},
-        {216, 232, 224, 248},
-        {220, 236, 228, 252},
-        {224, 240, 232, 256},
-        {228, 244, 236, 260},
-        {232, 248, 240, 264},
-        {236, 252, 244, 268},
-        {240, 256, 248, 272},
-        {244, 260, 252, 276},
-        {248, 264, 256, 280},
-        {252, 268, 260, 284},
-    },
-    { /* blk_fnum=32 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=33 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=34 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=35 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=36 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=37 */
-        {0, 6, 3, 12},
-        {4, 10, 7, 16},
-        {8, 14, 11, 20},
-        {12, 18, 15, 24},
-        {16, 22, 19, 28},
-        {20, 26, 23, 32},
-        {24, 30, 27, 36},
-        {28, 34, 31, 40},
-        {32, 38, 35, 44},
-        {36, 42, 39, 48},
-        {40, 46, 43, 52},
-        {44, 50, 47, 56},
-        {48, 54, 51, 60},
-        {52, 58, 55, 64},
-        {56, 62, 59, 68},
-        {60, 66, 63, 72},
-        {64, 70, 67, 76},
-        {68, 74, 71, 80},
-        {72, 78, 75, 84},
-        {76, 82, 79, 88},
-        {80, 86, 83, 92},
-        {84, 90, 87, 96},
-        {88, 94, 91, 100},
-        {92, 98, 95, 104},
-        {96, 102, 99, 108},
-        {100, 106, 103, 112},
-        {104, 110, 107, 116},
-        {108, 114, 111, 120},
-        {112, 118, 115, 124},
-        {116, 122, 119, 128},
-        {120, 126, 123, 132},
-        {124, 130, 127, 136},
-        {128, 134, 131, 140},
-        {132, 138, 135, 144},
-        {136, 142, 139, 148},
-        {140, 146, 143, 152},
-        {144, 150, 147, 156},
-        {148, 154, 151, 160},
-        {152, 158, 155, 164},
-        {156, 162, 159, 168},
-        {160, 166, 163, 172},
-        {164, 170, 167, 176},
-        {168, 174, 171, 180},
-        {172, 178, 175, 184},
-        {176, 182, 179, 188},
-        {180, 186, 183, 192},
-        {184, 190, 187, 196},
-        {188, 194, 191, 200},
-        {192, 198, 195, 204},
-        {196, 202, 199, 208},
-        {200, 206, 203, 212},
-        {204, 210, 207, 216},
-        {208, 214, 211, 220},
-        {212, 218, 215, 224},
-        {216, 222, 219, 228},
-        {220, 226, 223, 232},
-        {224, 230, 227, 236},
-        {228, 234, 231, 240},
-        {232, 238, 235, 244},
-        {236, 242, 239, 248},
-        {240, 246, 243, 252},
-        {244, 250, 247, 256},
-        {248, 254, 251, 260},
-        {252, 258, 255, 264},
-    },
-    { /* blk_fnum=38 */
-        {0, 10, 5, 20},
-        {4, 14, 9, 24},
-        {8, 18, 13, 28},
-        {12, 22, 17, 32},
-        {16, 26, 21, 36},
-        {20, 30, 25, 40},
-        {24, 34, 29, 44},
-        {28, 38, 33, 48},
-        {32, 42, 37, 52},
-        {36, 46, 41, 56},
-        {40, 50, 45, 60},
-        {44, 54, 49, 64},
-        {48, 58, 53, 68},
-        {52, 62, 57, 72},
-        {56, 66, 61, 76},
-        {60, 70, 65, 80},
-        {64, 74, 69, 84},
-        {68, 78, 73, 88},
-        {72, 82, 77, 92},
-        {76, 86, 81, 96},
-        {80, 90, 85, 100},
-        {84, 94, 89, 104},
-        {88, 98, 93, 108},
-        {92, 102, 97, 112},
-        {96, 106, 101, 116},
-        {100, 110, 105, 120},
-        {104, 114, 109, 124},
-        {108, 118, 113, 128},
-        {112, 122, 117, 132},
-        {116, 126, 121, 136},
-        {120, 130, 125, 140},
-        {124, 134, 129, 144},
-        {128, 138, 133, 148},
-        {132, 142, 137, 152},
-        {136, 146, 141, 156},
-        {140, 150, 145, 160},
-        {144, 154, 149, 164},
-        {148, 158, 153, 168},
-        {152, 162, 157, 172},
-        {156, 166, 161, 176},
-        {160, 170, 165, 180},
-        {164, 174, 169, 184},
-        {168, 178, 173, 188},
-        {172, 182, 177, 192},
-        {176, 186, 181, 196},
-        {180, 190, 185, 200},
-        {184, 194, 189, 204},
-        {188, 198, 193, 208},
-        {192, 202, 197, 212},
-        {196, 206, 201, 216},
-        {200, 210, 205, 220},
-        {204, 214, 209, 224},
-        {208, 218, 213, 228},
-        {212, 222, 217, 232},
-        {216, 226, 221, 236},
-        {220, 230, 225, 240},
-        {224, 234, 229, 244},
-        {228, 238, 233, 248},
-        {232, 242, 237, 252},
-        {236, 246, 241, 256},
-        {240, 250, 245, 260},
-        {244, 254, 249, 264},
-        {248, 258, 253, 268},
-        {252, 262, 257, 272},
-    },
-    { /* blk_fnum=39 */
-        {0, 14, 7, 28},
-        {4, 18, 11, 32},
-        {8, 22, 15, 36},
-        {12, 26, 19, 40},
-        {16, 30, 23, 44},
-        {20, 34, 27, 48},
-        {24, 38, 31, 52},
-        {28, 42, 35, 56},
-        {32, 46, 39, 60},
-        {36, 50, 43, 64},
-        {40, 54, 47, 68},
-        {44, 58, 51, 72},
-        {48, 62, 55, 76},
-        {52, 66, 59, 80},
-        {56, 70, 63, 84},
-        {60, 74, 67, 88},
-        {64, 78, 71, 92},
-        {68, 82, 75, 96},
-        {72, 86, 79, 100},
-        {76, 90, 83, 104},
-        {80, 94, 87, 108},
-        {84, 98, 91, 112},
-        {88, 102, 95, 116},
-        {92, 106, 99, 120},
-        {96, 110, 103, 124},
-        {100, 114, 107, 128},
-        {104, 118, 111, 132},
-        {108, 122, 115, 136},
-        {112, 126, 119, 140},
-        {116, 130, 123, 144},
-        {120, 134, 127, 148},
-        {124, 138, 131, 152},
-        {128, 142, 135, 156},
-        {132, 146, 139, 160},
-        {136, 150, 143, 164},
-        {140, 154, 147, 168},
-        {144, 158, 151, 172},
-        {148, 162, 155, 176},
-        {152, 166, 159, 180},
-        {156, 170, 163, 184},
-        {160, 174, 167, 188},
-        {164, 178, 171, 192},
-        {168, 182, 175, 196},
-        {172, 186, 179, 200},
-        {176, 190, 183, 204},
-        {180, 194, 187, 208},
-        {184, 198, 191, 212},
-        {188, 202, 195, 216},
-        {192, 206, 199, 220},
-        {196, 210, 203, 224},
-        {200, 214, 207, 228},
-        {204, 218, 211, 232},
-        {208, 222, 215, 236},
-        {212, 226, 219, 240},
-        {216, 230, 223, 244},
-        {220, 234, 227, 248},
-        {224, 238, 231, 252},
-        {228, 242, 235, 256},
-        {232, 246, 239, 260},
-        {236, 250, 243, 264},
-        {240, 254, 247, 268},
-        {244, 258, 251, 272},
-        {248, 262, 255, 276},
-        {252, 266, 259, 280},
-    },
-    { /* blk_fnum=40 */
-        {0, 16, 8, 32},
-        {4, 20, 12, 36},
-        {8, 24, 16, 40},
-        {12, 28, 20, 44},
-        {16, 32, 24, 48},
-        {20, 36, 28, 52},
-        {24, 40, 32, 56},
-        {28, 44, 36, 60},
-        {32, 48, 40, 64},
-        {36, 52, 44, 68},
-        {40, 56, 48, 72},
-        {44, 60, 52, 76},
-        {48, 64, 56, 80},
-        {52, 68, 60, 84},
-        {56, 72, 64, 88},
-        {60, 76, 68, 92},
-        {64, 80, 72, 96},
-        {68, 84, 76, 100},
-        {72, 88, 80, 104},
-        {76, 92, 84, 108},
-        {80, 96, 88, 112},
-        {84, 100, 92, 116},
-        {88, 104, 96, 120},
-        {92, 108, 100, 124},
-        {96, 112, 104, 128},
-        {100, 116, 108, 132},
-        {104, 120, 112, 136},
-        {108, 124, 116, 140},
-        {112, 128, 120, 144},
-        {116, 132, 124, 148},
-        {120, 136, 128, 152},
-        {124, 140, 132, 156},
-        {128, 144, 136, 160},
-        {132, 148, 140, 164},
-        {136, 152, 144, 168},
-        {140, 156, 148, 172},
-        {144, 160, 152, 176},
-        {148, 164, 156, 180},
-        {152, 168, 160, 184},
-        {156, 172, 164, 188},
-        {160, 176, 168, 192},
-        {164, 180, 172, 196},
-        {168, 184, 176, 200},
-        {172, 188, 180, 204},
-        {176, 192, 184, 208},
-        {180, 196, 188, 212},
-        {184, 200, 192, 216},
-        {188, 204, 196, 220},
-        {192, 208, 200, 224},
-        {196, 212, 204, 228},
-        {200, 216, 208, 232},
-        {204, 220, 212, 236},
-        {208, 224, 216, 240},
-        {212, 228, 220, 244},
-        {216, 232, 224, 248},
-        {220, 236, 228, 252},
-        {224, 240, 232, 256},
-        {228, 244, 236, 260},
-        {232, 248, 240, 264},
-        {236, 252, 244, 268},
-        {240, 256, 248, 272},
-        {244, 260, 252, 276},
-        {248, 264, 256, 280},
-        {252, 268, 260, 284},
-    },
-    { /* blk_fnum=41 */
-        {0, 20, 10, 40},
-        {4, 24, 14, 44},
-        {8, 28, 18, 48},
-        {12, 32, 22, 52},
-        {16, 36, 26, 56},
-        {20, 40, 30, 60},
-        {24, 44, 34, 64},
-        {28, 48, 38, 68},
-        {32, 52, 42, 72},
-        {36, 56, 46, 76},
-        {40, 60, 50, 80},
-        {44, 64, 54, 84},
-        {48, 68, 58, 88},
-        {52, 72, 62, 92},
-        {56, 76, 66, 96},
-        {60, 80, 70, 100},
-        {64, 84, 74, 104},
-        {68, 88, 78, 108},
-        {72, 92, 82, 112},
-        {76, 96, 86, 116},
-        {80, 100, 90, 120},
-        {84, 104, 94, 124},
-        {88, 108, 98, 128},
-        {92, 112, 102, 132},
-        {96, 116, 106, 136},
-        {100, 120, 110, 140},
-        {104, 124, 114, 144},
-        {108, 128, 118, 148},
-        {112, 132, 122, 152},
-        {116, 136, 126, 156},
-        {120, 140, 130, 160},
-        {124, 144, 134, 164},
-        {128, 148, 138, 168},
-        {132, 152, 142, 172},
-        {136, 156, 146, 176},
-        {140, 160, 150, 180},
-        {144, 164, 154, 184},
-        {148, 168, 158, 188},
-        {152, 172, 162, 192},
-        {156, 176, 166, 196},
-        {160, 180, 170, 200},
-        {164, 184, 174, 204},
-        {168, 188, 178, 208},
-        {172, 192, 182, 212},
-        {176, 196, 186, 216},
-        {180, 200, 190, 220},
-        {184, 204, 194, 224},
-        {188, 208, 198, 228},
-        {192, 212, 202, 232},
-        {196, 216, 206, 236},
-        {200, 220, 210, 240},
-        {204, 224, 214, 244},
-        {208, 228, 218, 248},
-        {212, 232, 222, 252},
-        {216, 236, 226, 256},
-        {220, 240, 230, 260},
-        {224, 244, 234, 264},
-        {228, 248, 238, 268},
-        {232, 252, 242, 272},
-        {236, 256, 246, 276},
-        {240, 260, 250, 280},
-        {244, 264, 254, 284},
-        {248, 268, 258, 288},
-        {252, 272, 262, 292},
-    },
-    { /* blk_fnum=42 */
-        {0, 22, 11, 44},
-        {4, 26, 15, 48},
-        {8, 30, 19, 52},
-        {12, 34, 23, 56},
-        {16, 38, 27, 60},
-        {20, 42, 31, 64},
-        {24, 46, 35, 68},
-        {28, 50, 39, 72},
-        {32, 54, 43, 76},
-        {36, 58, 47, 80},
-        {40, 62, 51, 84},
-        {44, 66, 55, 88},
-        {48, 70, 59, 92},
-        {52, 74, 63, 96},
-        {56, 78, 67, 100},
-        {60, 82, 71, 104},
-        {64, 86, 75, 108},
-        {68, 90, 79, 112},
-        {72, 94, 83, 116},
-        {76, 98, 87, 120},
-        {80, 102, 91, 124},
-        {84, 106, 95, 128},
-        {88, 110, 99, 132},
-        {92, 114, 103, 136},
-        {96, 118, 107, 140},
-        {100, 122, 111, 144},
-        {104, 126, 115, 148},
-        {108, 130, 119, 152},
-        {112, 134, 123, 156},
-        {116, 138, 127, 160},
-        {120, 142, 131, 164},
-        {124, 146, 135, 168},
-        {128, 150, 139, 172},
-        {132, 154, 143, 176},
-        {136, 158, 147, 180},
-        {140, 162, 151, 184},
-        {144, 166, 155, 188},
-        {148, 170, 159, 192},
-        {152, 174, 163, 196},
-        {156, 178, 167, 200},
-        {160, 182, 171, 204},
-        {164, 186, 175, 208},
-        {168, 190, 179, 212},
-        {172, 194, 183, 216},
-        {176, 198, 187, 220},
-        {180, 202, 191, 224},
-        {184, 206, 195, 228},
-        {188, 210, 199, 232},
-        {192, 214, 203, 236},
-        {196, 218, 207, 240},
-        {200, 222, 211, 244},
-        {204, 226, 215, 248},
-        {208, 230, 219, 252},
-        {212, 234, 223, 256},
-        {216, 238, 227, 260},
-        {220, 242, 231, 264},
-        {224, 246, 235, 268},
-        {228, 250, 239, 272},
-        {232, 254, 243, 276},
-        {236, 258, 247, 280},
-        {240, 262, 251, 284},
-        {244, 266, 255, 288},
-        {248, 270, 259, 292},
-        {252, 274, 263, 296},
-    },
-    { /* blk_fnum=43 */
-        {0, 24, 12, 48},
-        {4, 28, 16, 52},
-        {8, 32, 20, 56},
-        {12, 36, 24, 60},
-        {16, 40, 28, 64},
-        {20, 44, 32, 68},
-        {24, 48, 36, 72},
-        {28, 52, 40, 76},
-        {32, 56, 44, 80},
-        {36, 60, 48, 84},
-        {40, 64, 52, 88},
-        {44, 68, 56, 92},
-        {48, 72, 60, 96},
-        {52, 76, 64, 100},
-        {56, 80, 68, 104},
-        {60, 84, 72, 108},
-        {64, 88, 76, 112},
-        {68, 92, 80, 116},
-        {72, 96, 84, 120},
-        {76, 100, 88, 124},
-        {80, 104, 92, 128},
-        {84, 108, 96, 132},
-        {88, 112, 100, 136},
-        {92, 116, 104, 140},
-        {96, 120, 108, 144},
-        {100, 124, 112, 148},
-        {104, 128, 116, 152},
-        {108, 132, 120, 156},
-        {112, 136, 124, 160},
-        {116, 140, 128, 164},
-        {120, 144, 132, 168},
-        {124, 148, 136, 172},
-        {128, 152, 140, 176},
-        {132, 156, 144, 180},
-        {136, 160, 148, 184},
-        {140, 164, 152, 188},
-        {144, 168, 156, 192},
-        {148, 172, 160, 196},
-        {152, 176, 164, 200},
-        {156, 180, 168, 204},
-        {160, 184, 172, 208},
-        {164, 188, 176, 212},
-        {168, 192, 180, 216},
-        {172, 196, 184, 220},
-        {176, 200, 188, 224},
-        {180, 204, 192, 228},
-        {184, 208, 196, 232},
-        {188, 212, 200, 236},
-        {192, 216, 204, 240},
-        {196, 220, 208, 244},
-        {200, 224, 212, 248},
-        {204, 228, 216, 252},
-        {208, 232, 220, 256},
-        {212, 236, 224, 260},
-        {216, 240, 228, 264},
-        {220, 244, 232, 268},
-        {224, 248, 236, 272},
-        {228, 252, 240, 276},
-        {232, 256, 244, 280},
-        {236, 260, 248, 284},
-        {240, 264, 252, 288},
-        {244, 268, 256, 292},
-        {248, 272, 260, 296},
-        {252, 276, 264, 300},
-    },
-    { /* blk_fnum=44 */
-        {0, 26, 13, 52},
-        {4, 30, 17, 56},
-        {8, 34, 21, 60},
-        {12, 38, 25, 64},
-        {16, 42, 29, 68},
-        {20, 46, 33, 72},
-        {24, 50, 37, 76},
-        {28, 54, 41, 80},
-        {32, 58, 45, 84},
-        {36, 62, 49, 88},
-        {40, 66, 53, 92},
-        {44, 70, 57, 96},
-        {48, 74, 61, 100},
-        {52, 78, 65, 104},
-        {56, 82, 69, 108},
-        {60, 86, 73, 112},
-        {64, 90, 77, 116},
-        {68, 94, 81, 120},
-        {72, 98, 85, 124},
-        {76, 102, 89, 128},
-        {80, 106, 93, 132},
-        {84, 110, 97, 136},
-        {88, 114, 101, 140},
-        {92, 118, 105, 144},
-        {96, 122, 109, 148},
-        {100, 126, 113, 152},
-        {104, 130, 117, 156},
-        {108, 134, 121, 160},
-        {112, 138, 125, 164},
-        {116, 142, 129, 168},
-        {120, 146, 133, 172},
-        {124, 150, 137, 176},
-        {128, 154, 141, 180},
-        {132, 158, 145, 184},
-        {136, 162, 149, 188},
-        {140, 166, 153, 192},
-        {144, 170, 157, 196},
-        {148, 174, 161, 200},
-        {152, 178, 165, 204},
-        {156, 182, 169, 208},
-        {160, 186, 173, 212},
-        {164, 190, 177, 216},
-        {168, 194, 181, 220},
-        {172, 198, 185, 224},
-        {176, 202, 189, 228},
-        {180, 206, 193, 232},
-        {184, 210, 197, 236},
-        {188, 214, 201, 240},
-        {192, 218, 205, 244},
-        {196, 222, 209, 248},
-        {200, 226, 213, 252},
-        {204, 230, 217, 256},
-        {208, 234, 221, 260},
-        {212, 238, 225, 264},
-        {216, 242, 229, 268},
-        {220, 246, 233, 272},
-        {224, 250, 237, 276},
-        {228, 254, 241, 280},
-        {232, 258, 245, 284},
-        {236, 262, 249, 288},
-        {240, 266, 253, 292},
-        {244, 270, 257, 296},
-        {248, 274, 261, 300},
-        {252, 278, 265, 304},
-    },
-    { /* blk_fnum=45 */
-        {0, 28, 14, 56},
-        {4, 32, 18, 60},
-        {8, 36, 22, 64},
-        {12, 40, 26, 68},
-        {16, 44, 30, 72},
-        {20, 48, 34, 76},
-        {24, 52, 38, 80},
-        {28, 56, 42, 84},
-        {32, 60, 46, 88},
-        {36, 64, 50, 92},
-        {40, 68, 54, 96},
-        {44, 72, 58, 100},
-        {48, 76, 62, 104},
-        {52, 80, 66, 108},
-        {56, 84, 70, 112},
-        {60, 88, 74, 116},
-        {64, 92, 78, 120},
-        {68, 96, 82, 124},
-        {72, 100, 86, 128},
-        {76, 104, 90, 132},
-        {80, 108, 94, 136},
-        {84, 112, 98, 140},
-        {88, 116, 102, 144},
-        {92, 120, 106, 148},
-        {96, 124, 110, 152},
-        {100, 128, 114, 156},
-        {104, 132, 118, 160},
-        {108, 136, 122, 164},
-        {112, 140, 126, 168},
-        {116, 144, 130, 172},
-        {120, 148, 134, 176},
-        {124, 152, 138, 180},
-        {128, 156, 142, 184},
-        {132, 160, 146, 188},
-        {136, 164, 150, 192},
-        {140, 168, 154, 196},
-        {144, 172, 158, 200},
-        {148, 176, 162, 204},
-        {152, 180, 166, 208},
-        {156, 184, 170, 212},
-        {160, 188, 174, 216},
-        {164, 192, 178, 220},
-        {168, 196, 182, 224},
-        {172, 200, 186, 228},
-        {176, 204, 190, 232},
-        {180, 208, 194, 236},
-        {184, 212, 198, 240},
-        {188, 216, 202, 244},
-        {192, 220, 206, 248},
-        {196, 224, 210, 252},
-        {200, 228, 214, 256},
-        {204, 232, 218, 260},
-        {208, 236, 222, 264},
-        {212, 240, 226, 268},
-        {216, 244, 230, 272},
-        {220, 248, 234, 276},
-        {224, 252, 238, 280},
-        {228, 256, 242, 284},
-        {232, 260, 246, 288},
-        {236, 264, 250, 292},
-        {240, 268, 254, 296},
-        {244, 272, 258, 300},
-        {248, 276, 262, 304},
-        {252, 280, 266, 308},
-    },
-    { /* blk_fnum=46 */
-        {0, 30, 15, 60},
-        {4, 34, 19, 64},
-        {8, 38, 23, 68},
-        {12, 42, 27, 72},
-        {16, 46, 31, 76},
-        {20, 50, 35, 80},
-        {24, 54, 39, 84},
-        {28, 58, 43, 88},
-        {32, 62, 47, 92},
-        {36, 66, 51, 96},
-        {40, 70, 55, 100},
-        {44, 74, 59, 104},
-        {48, 78, 63, 108},
-        {52, 82, 67, 112},
-        {56, 86, 71, 116},
-        {60, 90, 75, 120},
-        {64, 94, 79, 124},
-        {68, 98, 83, 128},
-        {72, 102, 87, 132},
-        {76, 106, 91, 136},
-        {80, 110, 95, 140},
-        {84, 114, 99, 144},
-        {88, 118, 103, 148},
-        {92, 122, 107, 152},
-        {96, 126, 111, 156},
-        {100, 130, 115, 160},
-        {104, 134, 119, 164},
-        {108, 138, 123, 168},
-        {112, 142, 127, 172},
-        {116, 146, 131, 176},
-        {120, 150, 135, 180},
-        {124, 154, 139, 184},
-        {128, 158, 143, 188},
-        {132, 162, 147, 192},
-        {136, 166, 151, 196},
-        {140, 170, 155, 200},
-        {144, 174, 159, 204},
-        {148, 178, 163, 208},
-        {152, 182, 167, 212},
-        {156, 186, 171, 216},
-        {160, 190, 175, 220},
-        {164, 194, 179, 224},
-        {168, 198, 183, 228},
-        {172, 202, 187, 232},
-        {176, 206, 191, 236},
-        {180, 210, 195, 240},
-        {184, 214, 199, 244},
-        {188, 218, 203, 248},
-        {192, 222, 207, 252},
-        {196, 226, 211, 256},
-        {200, 230, 215, 260},
-        {204, 234, 219, 264},
-        {208, 238, 223, 268},
-        {212, 242, 227, 272},
-        {216, 246, 231, 276},
-        {220, 250, 235, 280},
-        {224, 254, 239, 284},
-        {228, 258, 243, 288},
-        {232, 262, 247, 292},
-        {236, 266, 251, 296},
-        {240, 270, 255, 300},
-        {244, 274, 259, 304},
-        {248, 278, 263, 308},
-        {252, 282, 267, 312},
-    },
-    { /* blk_fnum=47 */
-        {0, 32, 16, 64},
-        {4, 36, 20, 68},
-        {8, 40, 24, 72},
-        {12, 44, 28, 76},
-        {16, 48, 32, 80},
-        {20, 52, 36, 84},
-        {24, 56, 40, 88},
-        {28, 60, 44, 92},
-        {32, 64, 48, 96},
-        {36, 68, 52, 100},
-        {40, 72, 56, 104},
-        {44, 76, 60, 108},
-        {48, 80, 64, 112},
-        {52, 84, 68, 116},
-        {56, 88, 72, 120},
-        {60, 92, 76, 124},
-        {64, 96, 80, 128},
-        {68, 100, 84, 132},
-        {72, 104, 88, 136},
-        {76, 108, 92, 140},
-        {80, 112, 96, 144},
-        {84, 116, 100, 148},
-        {88, 120, 104, 152},
-        {92, 124, 108, 156},
-        {96, 128, 112, 160},
-        {100, 132, 116, 164},
-        {104, 136, 120, 168},
-        {108, 140, 124, 172},
-        {112, 144, 128, 176},
-        {116, 148, 132, 180},
-        {120, 152, 136, 184},
-        {124, 156, 140, 188},
-        {128, 160, 144, 192},
-        {132, 164, 148, 196},
-        {136, 168, 152, 200},
-        {140, 172, 156, 204},
-        {144, 176, 160, 208},
-        {148, 180, 164, 212},
-        {152, 184, 168, 216},
-        {156, 188, 172, 220},
-        {160, 192, 176, 224},
-        {164, 196, 180, 228},
-        {168, 200, 184, 232},
-        {172, 204, 188, 236},
-        {176, 208, 192, 240},
-        {180, 212, 196, 244},
-        {184, 216, 200, 248},
-        {188, 220, 204, 252},
-        {192, 224, 208, 256},
-        {196, 228, 212, 260},
-        {200, 232, 216, 264},
-        {204, 236, 220, 268},
-        {208, 240, 224, 272},
-        {212, 244, 228, 276},
-        {216, 248, 232, 280},
-        {220, 252, 236, 284},
-        {224, 256, 240, 288},
-        {228, 260, 244, 292},
-        {232, 264, 248, 296},
-        {236, 268, 252, 300},
-        {240, 272, 256, 304},
-        {244, 276, 260, 308},
-        {248, 280, 264, 312},
-        {252, 284, 268, 316},
-    },
-    { /* blk_fnum=48 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=49 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=50 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=51 */
-        {0, 10, 5, 20},
-        {4, 14, 9, 24},
-        {8, 18, 13, 28},
-        {12, 22, 17, 32},
-        {16, 26, 21, 36},
-        {20, 30, 25, 40},
-        {24, 34, 29, 44},
-        {28, 38, 33, 48},
-        {32, 42, 37, 52},
-        {36, 46, 41, 56},
-        {40, 50, 45, 60},
-        {44, 54, 49, 64},
-        {48, 58, 53, 68},
-        {52, 62, 57, 72},
-        {56, 66, 61, 76},
-        {60, 70, 65, 80},
-        {64, 74, 69, 84},
-        {68, 78, 73, 88},
-        {72, 82, 77, 92},
-        {76, 86, 81, 96},
-        {80, 90, 85, 100},
-        {84, 94, 89, 104},
-        {88, 98, 93, 108},
-        {92, 102, 97, 112},
-        {96, 106, 101, 116},
-        {100, 110, 105, 120},
-        {104, 114, 109, 124},
-        {108, 118, 113, 128},
-        {112, 122, 117, 132},
-        {116, 126, 121, 136},
-        {120, 130, 125, 140},
-        {124, 134, 129, 144},
-        {128, 138, 133, 148},
-        {132, 142, 137, 152},
-        {136, 146, 141, 156},
-        {140, 150, 145, 160},
-        {144, 154, 149, 164},
-        {148, 158, 153, 168},
-        {152, 162, 157, 172},
-        {156, 166, 161, 176},
-        {160, 170, 165, 180},
-        {164, 174, 169, 184},
-        {168, 178, 173, 188},
-        {172, 182, 177, 192},
-        {176, 186, 181, 196},
-        {180, 190, 185, 200},
-        {184, 194, 189, 204},
-        {188, 198, 193, 208},
-        {192, 202, 197, 212},
-        {196, 206, 201, 216},
-        {200, 210, 205, 220},
-        {204, 214, 209, 224},
-        {208, 218, 213, 228},
-        {212, 222, 217, 232},
-        {216, 226, 221, 236},
-        {220, 230, 225, 240},
-        {224, 234, 229, 244},
-        {228, 238, 233, 248},
-        {232, 242, 237, 252},
-        {236, 246, 241, 256},
-        {240, 250, 245, 260},
-        {244, 254, 249, 264},
-        {248, 258, 253, 268},
-        {252, 262, 257, 272},
-    },
-    { /* blk_fnum=52 */
-        {0, 16, 8, 32},
-        {4, 20, 12, 36},
-        {8, 24, 16, 40},
-        {12, 28, 20, 44},
-        {16, 32, 24, 48},
-        {20, 36, 28, 52},
-        {24, 40, 32, 56},
-        {28, 44, 36, 60},
-        {32, 48, 40, 64},
-        {36, 52, 44, 68},
-        {40, 56, 48, 72},
-        {44, 60, 52, 76},
-        {48, 64, 56, 80},
-        {52, 68, 60, 84},
-        {56, 72, 64, 88},
-        {60, 76, 68, 92},
-        {64, 80, 72, 96},
-        {68, 84, 76, 100},
-        {72, 88, 80, 104},
-        {76, 92, 84, 108},
-        {80, 96, 88, 112},
-        {84, 100, 92, 116},
-        {88, 104, 96, 120},
-        {92, 108, 100, 124},
-        {96, 112, 104, 128},
-        {100, 116, 108, 132},
-        {104, 120, 112, 136},
-        {108, 124, 116, 140},
-        {112, 128, 120, 144},
-        {116, 132, 124, 148},
-        {120, 136, 128, 152},
-        {124, 140, 132, 156},
-        {128, 144, 136, 160},
-        {132, 148, 140, 164},
-        {136, 152, 144, 168},
-        {140, 156, 148, 172},
-        {144, 160, 152, 176},
-        {148, 164, 156, 180},
-        {152, 168, 160, 184},
-        {156, 172, 164, 188},
-        {160, 176, 168, 192},
-        {164, 180, 172, 196},
-        {168, 184, 176, 200},
-        {172, 188, 180, 204},
-        {176, 192, 184, 208},
-        {180, 196, 188, 212},
-        {184, 200, 192, 216},
-        {188, 204, 196, 220},
-        {192, 208, 200, 224},
-        {196, 212, 204, 228},
-        {200, 216, 208, 232},
-        {204, 220, 212, 236},
-        {208, 224, 216, 240},
-        {212, 228, 220, 244},
-        {216, 232, 224, 248},
-        {220, 236, 228, 252},
-        {224, 240, 232, 256},
-        {228, 244, 236, 260},
-        {232, 248, 240, 264},
-        {236, 252, 244, 268},
-        {240, 256, 248, 272},
-        {244, 260, 252, 276},
-        {248, 264, 256, 280},
-        {252, 268, 260, 284},
-    },
-    { /* blk_fnum=53 */
-        {0, 22, 11, 44},
-        {4, 26, 15, 48},
-        {8, 30, 19, 52},
-        {12, 34, 23, 56},
-        {16, 38, 27, 60},
-        {20, 42, 31, 64},
-        {24, 46, 35, 68},
-        {28, 50, 39, 72},
-        {32, 54, 43, 76},
-        {36, 58, 47, 80},
-        {40, 62, 51, 84},
-        {44, 66, 55, 88},
-        {48, 70, 59, 92},
-        {52, 74, 63, 96},
-        {56, 78, 67, 100},
-        {60, 82, 71, 104},
-        {64, 86, 75, 108},
-        {68, 90, 79, 112},
-        {72, 94, 83, 116},
-        {76, 98, 87, 120},
-        {80, 102, 91, 124},
-        {84, 106, 95, 128},
-        {88, 110, 99, 132},
-        {92, 114, 103, 136},
-        {96, 118, 107, 140},
-        {100, 122, 111, 144},
-        {104, 126, 115, 148},
-        {108, 130, 119, 152},
-        {112, 134, 123, 156},
-        {116, 138, 127, 160},
-        {120, 142, 131, 164},
-        {124, 146, 135, 168},
-        {128, 150, 139, 172},
-        {132, 154, 143, 176},
-        {136, 158, 147, 180},
-        {140, 162, 151, 184},
-        {144, 166, 155, 188},
-        {148, 170, 159, 192},
-        {152, 174, 163, 196},
-        {156, 178, 167, 200},
-        {160, 182, 171, 204},
-        {164, 186, 175, 208},
-        {168, 190, 179, 212},
-        {172, 194, 183, 216},
-        {176, 198, 187, 220},
-        {180, 202, 191, 224},
-        {184, 206, 195, 228},
-        {188, 210, 199, 232},
-        {192, 214, 203, 236},
-        {196, 218, 207, 240},
-        {200, 222, 211, 244},
-        {204, 226, 215, 248},
-        {208, 230, 219, 252},
-        {212, 234, 223, 256},
-        {216, 238, 227, 260},
-        {220, 242, 231, 264},
-        {224, 246, 235, 268},
-        {228, 250, 239, 272},
-        {232, 254, 243, 276},
-        {236, 258, 247, 280},
-        {240, 262, 251, 284},
-        {244, 266, 255, 288},
-        {248, 270, 259, 292},
-        {252, 274, 263, 296},
-    },
-    { /* blk_fnum=54 */
-        {0, 26, 13, 52},
-        {4, 30, 17, 56},
-        {8, 34, 21, 60},
-        {12, 38, 25, 64},
-        {16, 42, 29, 68},
-        {20, 46, 33, 72},
-        {24, 50, 37, 76},
-        {28, 54, 41, 80},
-        {32, 58, 45, 84},
-        {36, 62, 49, 88},
-        {40, 66, 53, 92},
-        {44, 70, 57, 96},
-        {48, 74, 61, 100},
-        {52, 78, 65, 104},
-        {56, 82, 69, 108},
-        {60, 86, 73, 112},
-        {64, 90, 77, 116},
-        {68, 94, 81, 120},
-        {72, 98, 85, 124},
-        {76, 102, 89, 128},
-        {80, 106, 93, 132},
-        {84, 110, 97, 136},
-        {88, 114, 101, 140},
-        {92, 118, 105, 144},
-        {96, 122, 109, 148},
-        {100, 126, 113, 152},
-        {104, 130, 117, 156},
-        {108, 134, 121, 160},
-        {112, 138, 125, 164},
-        {116, 142, 129, 168},
-        {120, 146, 133, 172},
-        {124, 150, 137, 176},
-        {128, 154, 141, 180},
-        {132, 158, 145, 184},
-        {136, 162, 149, 188},
-        {140, 166, 153, 192},
-        {144, 170, 157, 196},
-        {148, 174, 161, 200},
-        {152, 178, 165, 204},
-        {156, 182, 169, 208},
-        {160, 186, 173, 212},
-        {164, 190, 177, 216},
-        {168, 194, 181, 220},
-        {172, 198, 185, 224},
-        {176, 202, 189, 228},
-        {180, 206, 193, 232},
-        {184, 210, 197, 236},
-        {188, 214, 201, 240},
-        {192, 218, 205, 244},
-        {196, 222, 209, 248},
-        {200, 226, 213, 252},
-        {204, 230, 217, 256},
-        {208, 234, 221, 260},
-        {212, 238, 225, 264},
-        {216, 242, 229, 268},
-        {220, 246, 233, 272},
-        {224, 250, 237, 276},
-        {228, 254, 241, 280},
-        {232, 258, 245, 284},
-        {236, 262, 249, 288},
-        {240, 266, 253, 292},
-        {244, 270, 257, 296},
-        {248, 274, 261, 300},
-        {252, 278, 265, 304},
-    },
-    { /* blk_fnum=55 */
-        {0, 30, 15, 60},
-        {4, 34, 19, 64},
-        {8, 38, 23, 68},
-        {12, 42, 27, 72},
-        {16, 46, 31, 76},
-        {20, 50, 35, 80},
-        {24, 54, 39, 84},
-        {28, 58, 43, 88},
-        {32, 62, 47, 92},
-        {36, 66, 51, 96},
-        {40, 70, 55, 100},
-        {44, 74, 59, 104},
-        {48, 78, 63, 108},
-        {52, 82, 67, 112},
-        {56, 86, 71, 116},
-        {60, 90, 75, 120},
-        {64, 94, 79, 124},
-        {68, 98, 83, 128},
-        {72, 102, 87, 132},
-        {76, 106, 91, 136},
-        {80, 110, 95, 140},
-        {84, 114, 99, 144},
-        {88, 118, 103, 148},
-        {92, 122, 107, 152},
-        {96, 126, 111, 156},
-        {100, 130, 115, 160},
-        {104, 134, 119, 164},
-        {108, 138, 123, 168},
-        {112, 142, 127, 172},
-        {116, 146, 131, 176},
-        {120, 150, 135, 180},
-        {124, 154, 139, 184},
-        {128, 158, 143, 188},
-        {132, 162, 147, 192},
-        {136, 166, 151, 196},
-        {140, 170, 155, 200},
-        {144, 174, 159, 204},
-        {148, 178, 163, 208},
-        {152, 182, 167, 212},
-        {156, 186, 171, 216},
-        {160, 190, 175, 220},
-        {164, 194, 179, 224},
-        {168, 198, 183, 228},
-        {172, 202, 187, 232},
-        {176, 206, 191, 236},
-        {180, 210, 195, 240},
-        {184, 214, 199, 244},
-        {188, 218, 203, 248},
-        {192, 222, 207, 252},
-        {196, 226, 211, 256},
-        {200, 230, 215, 260},
-        {204, 234, 219, 264},
-        {208, 238, 223, 268},
-        {212, 242, 227, 272},
-        {216, 246, 231, 276},
-        {220, 250, 235, 280},
-        {224, 254, 239, 284},
-        {228, 258, 243, 288},
-        {232, 262, 247, 292},
-        {236, 266, 251, 296},
-        {240, 270, 255, 300},
-        {244, 274, 259, 304},
-        {248, 278, 263, 308},
-        {252, 282, 267, 312},
-    },
-    { /* blk_fnum=56 */
-        {0, 32, 16, 64},
-        {4, 36, 20, 68},
-        {8, 40, 24, 72},
-        {12, 44, 28, 76},
-        {16, 48, 32, 80},
-        {20, 52, 36, 84},
-        {24, 56, 40, 88},
-        {28, 60, 44, 92},
-        {32, 64, 48, 96},
-        {36, 68, 52, 100},
-        {40, 72, 56, 104},
-        {44, 76, 60, 108},
-        {48, 80, 64, 112},
-        {52, 84, 68, 116},
-        {56, 88, 72, 120},
-        {60, 92, 76, 124},
-        {64, 96, 80, 128},
-        {68, 100, 84, 132},
-        {72, 104, 88, 136},
-        {76, 108, 92, 140},
-        {80, 112, 96, 144},
-        {84, 116, 100, 148},
-        {88, 120, 104, 152},
-        {92, 124, 108, 156},
-        {96, 128, 112, 160},
-        {100, 132, 116, 164},
-        {104, 136, 120, 168},
-        {108, 140, 124, 172},
-        {112, 144, 128, 176},
-        {116, 148, 132, 180},
-        {120, 152, 136, 184},
-        {124, 156, 140, 188},
-        {128, 160, 144, 192},
-        {132, 164, 148, 196},
-        {136, 168, 152, 200},
-        {140, 172, 156, 204},
-        {144, 176, 160, 208},
-        {148, 180, 164, 212},
-        {152, 184, 168, 216},
-        {156, 188, 172, 220},
-        {160, 192, 176, 224},
-        {164, 196, 180, 228},
-        {168, 200, 184, 232},
-        {172, 204, 188, 236},
-        {176, 208, 192, 240},
-        {180, 212, 196, 244},
-        {184, 216, 200, 248},
-        {188, 220, 204, 252},
-        {192, 224, 208, 256},
-        {196, 228, 212, 260},
-        {200, 232, 216, 264},
-        {204, 236, 220, 268},
-        {208, 240, 224, 272},
-        {212, 244, 228, 276},
-        {216, 248, 232, 280},
-        {220, 252, 236, 284},
-        {224, 256, 240, 288},
-        {228, 260, 244, 292},
-        {232, 264, 248, 296},
-        {236, 268, 252, 300},
-        {240, 272, 256, 304},
-        {244, 276, 260, 308},
-        {248, 280, 264, 312},
-        {252, 284, 268, 316},
-    },
-    { /* blk_fnum=57 */
-        {0, 36, 18, 72},
-        {4, 40, 22, 76},
-        {8, 44, 26, 80},
-        {12, 48, 30, 84},
-        {16, 52, 34, 88},
-        {20, 56, 38, 92},
-        {24, 60, 42, 96},
-        {28, 64, 46, 100},
-        {32, 68, 50, 104},
-        {36, 72, 54, 108},
-        {40, 76, 58, 112},
-        {44, 80, 62, 116},
-        {48, 84, 66, 120},
-        {52, 88, 70, 124},
-        {56, 92, 74, 128},
-        {60, 96, 78, 132},
-        {64, 100, 82, 136},
-        {68, 104, 86, 140},
-        {72, 108, 90, 144},
-        {76, 112, 94, 148},
-        {80, 116, 98, 152},
-        {84, 120, 102, 156},
-        {88, 124, 106, 160},
-        {92, 128, 110, 164},
-        {96, 132, 114, 168},
-        {100, 136, 118, 172},
-        {104, 140, 122, 176},
-        {108, 144, 126, 180},
-        {112, 148, 130, 184},
-        {116, 152, 134, 188},
-        {120, 156, 138, 192},
-        {124, 160, 142, 196},
-        {128, 164, 146, 200},
-        {132, 168, 150, 204},
-        {136, 172, 154, 208},
-        {140, 176, 158, 212},
-        {144, 180, 162, 216},
-        {148, 184, 166, 220},
-        {152, 188, 170, 224},
-        {156, 192, 174, 228},
-        {160, 196, 178, 232},
-        {164, 200, 182, 236},
-        {168, 204, 186, 240},
-        {172, 208, 190, 244},
-        {176, 212, 194, 248},
-        {180, 216, 198, 252},
-        {184, 220, 202, 256},
-        {188, 224, 206, 260},
-        {192, 228, 210, 264},
-        {196, 232, 214, 268},
-        {200, 236, 218, 272},
-        {204, 240, 222, 276},
-        {208, 244, 226, 280},
-        {212, 248, 230, 284},
-        {216, 252, 234, 288},
-        {220, 256, 238, 292},
-        {224, 260, 242, 296},
-        {228, 264, 246, 300},
-        {232, 268, 250, 304},
-        {236, 272, 254, 308},
-        {240, 276, 258, 312},
-        {244, 280, 262, 316},
-        {248, 284, 266, 320},
-        {252, 288, 270, 324},
-    },
-    { /* blk_fnum=58 */
-        {0, 38, 19, 76},
-        {4, 42, 23, 80},
-        {8, 46, 27, 84},
-        {12, 50, 31, 88},
-        {16, 54, 35, 92},
-        {20, 58, 39, 96},
-        {24, 62, 43, 100},
-        {28, 66, 47, 104},
-        {32, 70, 51, 108},
-        {36, 74, 55, 112},
-        {40, 78, 59, 116},
-        {44, 82, 63, 120},
-        {48, 86, 67, 124},
-        {52, 90, 71, 128},
-        {56, 94, 75, 132},
-        {60, 98, 79, 136},
-        {64, 102, 83, 140},
-        {68, 106, 87, 144},
-        {72, 110, 91, 148},
-        {76, 114, 95, 152},
-        {80, 118, 99, 156},
-        {84, 122, 103, 160},
-        {88, 126, 107, 164},
-        {92, 130, 111, 168},
-        {96, 134, 115, 172},
-        {100, 138, 119, 176},
-        {104, 142, 123, 180},
-        {108, 146, 127, 184},
-        {112, 150, 131, 188},
-        {116, 154, 135, 192},
-        {120, 158, 139, 196},
-        {124, 162, 143, 200},
-        {128, 166, 147, 204},
-        {132, 170, 151, 208},
-        {136, 174, 155, 212},
-        {140, 178, 159, 216},
-        {144, 182, 163, 220},
-        {148, 186, 167, 224},
-        {152, 190, 171, 228},
-        {156, 194, 175, 232},
-        {160, 198, 179, 236},
-        {164, 202, 183, 240},
-        {168, 206, 187, 244},
-        {172, 210, 191, 248},
-        {176, 214, 195, 252},
-        {180, 218, 199, 256},
-        {184, 222, 203, 260},
-        {188, 226, 207, 264},
-        {192, 230, 211, 268},
-        {196, 234, 215, 272},
-        {200, 238, 219, 276},
-        {204, 242, 223, 280},
-        {208, 246, 227, 284},
-        {212, 250, 231, 288},
-        {216, 254, 235, 292},
-        {220, 258, 239, 296},
-        {224, 262, 243, 300},
-        {228, 266, 247, 304},
-        {232, 270, 251, 308},
-        {236, 274, 255, 312},
-        {240, 278, 259, 316},
-        {244, 282, 263, 320},
-        {248, 286, 267, 324},
-        {252, 290, 271, 328},
-    },
-    { /* blk_fnum=59 */
-        {0, 40, 20, 80},
-        {4, 44, 24, 84},
-        {8, 48, 28, 88},
-        {12, 52, 32, 92},
-        {16, 56, 36, 96},
-        {20, 60, 40, 100},
-        {24, 64, 44, 104},
-        {28, 68, 48, 108},
-        {32, 72, 52, 112},
-        {36, 76, 56, 116},
-        {40, 80, 60, 120},
-        {44, 84, 64, 124},
-        {48, 88, 68, 128},
-        {52, 92, 72, 132},
-        {56, 96, 76, 136},
-        {60, 100, 80, 140},
-        {64, 104, 84, 144},
-        {68, 108, 88, 148},
-        {72, 112, 92, 152},
-        {76, 116, 96, 156},
-        {80, 120, 100, 160},
-        {84, 124, 104, 164},
-        {88, 128, 108, 168},
-        {92, 132, 112, 172},
-        {96, 136, 116, 176},
-        {100, 140, 120, 180},
-        {104, 144, 124, 184},
-        {108, 148, 128, 188},
-        {112, 152, 132, 192},
-        {116, 156, 136, 196},
-        {120, 160, 140, 200},
-        {124, 164, 144, 204},
-        {128, 168, 148, 208},
-        {132, 172, 152, 212},
-        {136, 176, 156, 216},
-        {140, 180, 160, 220},
-        {144, 184, 164, 224},
-        {148, 188, 168, 228},
-        {152, 192, 172, 232},
-        {156, 196, 176, 236},
-        {160, 200, 180, 240},
-        {164, 204, 184, 244},
-        {168, 208, 188, 248},
-        {172, 212, 192, 252},
-        {176, 216, 196, 256},
-        {180, 220, 200, 260},
-        {184, 224, 204, 264},
-        {188, 228, 208, 268},
-        {192, 232, 212, 272},
-        {196, 236, 216, 276},
-        {200, 240, 220, 280},
-        {204, 244, 224, 284},
-        {208, 248, 228, 288},
-        {212, 252, 232, 292},
-        {216, 256, 236, 296},
-        {220, 260, 240, 300},
-        {224, 264, 244, 304},
-        {228, 268, 248, 308},
-        {232, 272, 252, 312},
-        {236, 276, 256, 316},
-        {240, 280, 260, 320},
-        {244, 284, 264, 324},
-        {248, 288, 268, 328},
-        {252, 292, 272, 332},
-    },
-    { /* blk_fnum=60 */
-        {0, 42, 21, 84},
-        {4, 46, 25, 88},
-        {8, 50, 29, 92},
-        {12, 54, 33, 96},
-        {16, 58, 37, 100},
-        {20, 62, 41, 104},
-        {24, 66, 45, 108},
-        {28, 70, 49, 112},
-        {32, 74, 53, 116},
-        {36, 78, 57, 120},
-        {40, 82, 61, 124},
-        {44, 86, 65, 128},
-        {48, 90, 69, 132},
-        {52, 94, 73, 136},
-        {56, 98, 77, 140},
-        {60, 102, 81, 144},
-        {64, 106, 85, 148},
-        {68, 110, 89, 152},
-        {72, 114, 93, 156},
-        {76, 118, 97, 160},
-        {80, 122, 101, 164},
-        {84, 126, 105, 168},
-        {88, 130, 109, 172},
-        {92, 134, 113, 176},
-        {96, 138, 117, 180},
-        {100, 142, 121, 184},
-        {104, 146, 125, 188},
-        {108, 150, 129, 192},
-        {112, 154, 133, 196},
-        {116, 158, 137, 200},
-        {120, 162, 141, 204},
-        {124, 166, 145, 208},
-        {128, 170, 149, 212},
-        {132, 174, 153, 216},
-        {136, 178, 157, 220},
-        {140, 182, 161, 224},
-        {144, 186, 165, 228},
-        {148, 190, 169, 232},
-        {152, 194, 173, 236},
-        {156, 198, 177, 240},
-        {160, 202, 181, 244},
-        {164, 206, 185, 248},
-        {168, 210, 189, 252},
-        {172, 214, 193, 256},
-        {176, 218, 197, 260},
-        {180, 222, 201, 264},
-        {184, 226, 205, 268},
-        {188, 230, 209, 272},
-        {192, 234, 213, 276},
-        {196, 238, 217, 280},
-        {200, 242, 221, 284},
-        {204, 246, 225, 288},
-        {208, 250, 229, 292},
-        {212, 254, 233, 296},
-        {216, 258, 237, 300},
-        {220, 262, 241, 304},
-        {224, 266, 245, 308},
-        {228, 270, 249, 312},
-        {232, 274, 253, 316},
-        {236, 278, 257, 320},
-        {240, 282, 261, 324},
-        {244, 286, 265, 328},
-        {248, 290, 269, 332},
-        {252, 294, 273, 336},
-    },
-    { /* blk_fnum=61 */
-        {0, 44, 22, 88},
-        {4, 48, 26, 92},
-        {8, 52, 30, 96},
-        {12, 56, 34, 100},
-        {16, 60, 38, 104},
-        {20, 64, 42, 108},
-        {24, 68, 46, 112},
-        {28, 72, 50, 116},
-        {32, 76, 54, 120},
-        {36, 80, 58, 124},
-        {40, 84, 62, 128},
-        {44, 88, 66, 132},
-        {48, 92, 70, 136},
-        {52, 96, 74, 140},
-        {56, 100, 78, 144},
-        {60, 104, 82, 148},
-        {64, 108, 86, 152},
-        {68, 112, 90, 156},
-        {72, 116, 94, 160},
-        {76, 120, 98, 164},
-        {80, 124, 102, 168},
-        {84, 128, 106, 172},
-        {88, 132, 110, 176},
-        {92, 136, 114, 180},
-        {96, 140, 118, 184},
-        {100, 144, 122, 188},
-        {104, 148, 126, 192},
-        {108, 152, 130, 196},
-        {112, 156, 134, 200},
-        {116, 160, 138, 204},
-        {120, 164, 142, 208},
-        {124, 168, 146, 212},
-        {128, 172, 150, 216},
-        {132, 176, 154, 220},
-        {136, 180, 158, 224},
-        {140, 184, 162, 228},
-        {144, 188, 166, 232},
-        {148, 192, 170, 236},
-        {152, 196, 174, 240},
-        {156, 200, 178, 244},
-        {160, 204, 182, 248},
-        {164, 208, 186, 252},
-        {168, 212, 190, 256},
-        {172, 216, 194, 260},
-        {176, 220, 198, 264},
-        {180, 224, 202, 268},
-        {184, 228, 206, 272},
-        {188, 232, 210, 276},
-        {192, 236, 214, 280},
-        {196, 240, 218, 284},
-        {200, 244, 222, 288},
-        {204, 248, 226, 292},
-        {208, 252, 230, 296},
-        {212, 256, 234, 300},
-        {216, 260, 238, 304},
-        {220, 264, 242, 308},
-        {224, 268, 246, 312},
-        {228, 272, 250, 316},
-        {232, 276, 254, 320},
-        {236, 280, 258, 324},
-        {240, 284, 262, 328},
-        {244, 288, 266, 332},
-        {248, 292, 270, 336},
-        {252, 296, 274, 340},
-    },
-    { /* blk_fnum=62 */
-        {0, 46, 23, 92},
-        {4, 50, 27, 96},
-        {8, 54, 31, 100},
-        {12, 58, 35, 104},
-        {16, 62, 39, 108},
-        {20, 66, 43, 112},
-        {24, 70, 47, 116},
-        {28, 74, 51, 120},
-        {32, 78, 55, 124},
-        {36, 82, 59, 128},
-        {40, 86, 63, 132},
-        {44, 90, 67, 136},
-        {48, 94, 71, 140},
-        {52, 98, 75, 144},
-        {56, 102, 79, 148},
-        {60, 106, 83, 152},
-        {64, 110, 87, 156},
-        {68, 114, 91, 160},
-        {72, 118, 95, 164},
-        {76, 122, 99, 168},
-        {80, 126, 103, 172},
-        {84, 130, 107, 176},
-        {88, 134, 111, 180},
-        {92, 138, 115, 184},
-        {96, 142, 119, 188},
-        {100, 146, 123, 192},
-        {104, 150, 127, 196},
-        {108, 154, 131, 200},
-        {112, 158, 135, 204},
-        {116, 162, 139, 208},
-        {120, 166, 143, 212},
-        {124, 170, 147, 216},
-        {128, 174, 151, 220},
-        {132, 178, 155, 224},
-        {136, 182, 159, 228},
-        {140, 186, 163, 232},
-        {144, 190, 167, 236},
-        {148, 194, 171, 240},
-        {152, 198, 175, 244},
-        {156, 202, 179, 248},
-        {160, 206, 183, 252},
-        {164, 210, 187, 256},
-        {168, 214, 191, 260},
-        {172, 218, 195, 264},
-        {176, 222, 199, 268},
-        {180, 226, 203, 272},
-        {184, 230, 207, 276},
-        {188, 234, 211, 280},
-        {192, 238, 215, 284},
-        {196, 242, 219, 288},
-        {200, 246, 223, 292},
-        {204, 250, 227, 296},
-        {208, 254, 231, 300},
-        {212, 258, 235, 304},
-        {216, 262, 239, 308},
-        {220, 266, 243, 312},
-        {224, 270, 247, 316},
-        {228, 274, 251, 320},
-        {232, 278, 255, 324},
-        {236, 282, 259, 328},
-        {240, 286, 263, 332},
-        {244, 290, 267, 336},
-        {248, 294, 271, 340},
-        {252, 298, 275, 344},
-    },
-    { /* blk_fnum=63 */
-        {0, 48, 24, 96},
-        {4, 52, 28, 100},
-        {8, 56, 32, 104},
-        {12, 60, 36, 108},
-        {16, 64, 40, 112},
-        {20, 68, 44, 116},
-        {24, 72, 48, 120},
-        {28, 76, 52, 124},
-        {32, 80, 56, 128},
-        {36, 84, 60, 132},
-        {40, 88, 64, 136},
-        {44, 92, 68, 140},
-        {48, 96, 72, 144},
-        {52, 100, 76, 148},
-        {56, 104, 80, 152},
-        {60, 108, 84, 156},
-        {64, 112, 88, 160},
-        {68, 116, 92, 164},
-        {72, 120, 96, 168},
-        {76, 124, 100, 172},
-        {80, 128, 104, 176},
-        {84, 132, 108, 180},
-        {88, 136, 112, 184},
-        {92, 140, 116, 188},
-        {96, 144, 120, 192},
-        {100, 148, 124, 196},
-        {104, 152, 128, 200},
-        {108, 156, 132, 204},
-        {112, 160, 136, 208},
-        {116, 164, 140, 212},
-        {120, 168, 144, 216},
-        {124, 172, 148, 220},
-        {128, 176, 152, 224},
-        {132, 180, 156, 228},
-        {136, 184, 160, 232},
-        {140, 188, 164, 236},
-        {144, 192, 168, 240},
-        {148, 196, 172, 244},
-        {152, 200, 176, 248},
-        {156, 204, 180, 252},
-        {160, 208, 184, 256},
-        {164, 212, 188, 260},
-        {168, 216, 192, 264},
-        {172, 220, 196, 268},
-        {176, 224, 200, 272},
-        {180, 228, 204, 276},
-        {184, 232, 208, 280},
-        {188, 236, 212, 284},
-        {192, 240, 216, 288},
-        {196, 244, 220, 292},
-        {200, 248, 224, 296},
-        {204, 252, 228, 300},
-        {208, 256, 232, 304},
-        {212, 260, 236, 308},
-        {216, 264, 240, 312},
-        {220, 268, 244, 316},
-        {224, 272, 248, 320},
-        {228, 276, 252, 324},
-        {232, 280, 256, 328},
-        {236, 284, 260, 332},
-        {240, 288, 264, 336},
-        {244, 292, 268, 340},
-        {248, 296, 272, 344},
-        {252, 300, 276, 348},
-    },
-    { /* blk_fnum=64 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=65 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=66 */
-        {0, 16, 8, 32},
-        {4, 20, 12, 36},
-        {8, 24, 16, 40},
-        {12, 28, 20, 44},
-        {16, 32, 24, 48},
-        {20, 36, 28, 52},
-        {24, 40, 32, 56},
-        {28, 44, 36, 60},
-        {32, 48, 40, 64},
-        {36, 52, 44, 68},
-        {40, 56, 48, 72},
-        {44, 60, 52, 76},
-        {48, 64, 56, 80},
-        {52, 68, 60, 84},
-        {56, 72, 64, 88},
-        {60, 76, 68, 92},
-        {64, 80, 72, 96},
-        {68, 84, 76, 100},
-        {72, 88, 80, 104},
-        {76, 92, 84, 108},
-        {80, 96, 88, 112},
-        {84, 100, 92, 116},
-        {88, 104, 96, 120},
-        {92, 108, 100, 124},
-        {96, 112, 104, 128},
-        {100, 116, 108, 132},
-        {104, 120, 112, 136},
-        {108, 124, 116, 140},
-        {112, 128, 120, 144},
-        {116, 132, 124, 148},
-        {120, 136, 128, 152},
-        {124, 140, 132, 156},
-        {128, 144, 136, 160},
-        {132, 148, 140, 164},
-        {136, 152, 144, 168},
-        {140, 156, 148, 172},
-        {144, 160, 152, 176},
-        {148, 164, 156, 180},
-        {152, 168, 160, 184},
-        {156, 172, 164, 188},
-        {160, 176, 168, 192},
-        {164, 180, 172, 196},
-        {168, 184, 176, 200},
-        {172, 188, 180, 204},
-        {176, 192, 184, 208},
-        {180, 196, 188, 212},
-        {184, 200, 192, 216},
-        {188, 204, 196, 220},
-        {192, 208, 200, 224},
-        {196, 212, 204, 228},
-        {200, 216, 208, 232},
-        {204, 220, 212, 236},
-        {208, 224, 216, 240},
-        {212, 228, 220, 244},
-        {216, 232, 224, 248},
-        {220, 236, 228, 252},
-        {224, 240, 232, 256},
-        {228, 244, 236, 260},
-        {232, 248, 240, 264},
-        {236, 252, 244, 268},
-        {240, 256, 248, 272},
-        {244, 260, 252, 276},
-        {248, 264, 256, 280},
-        {252, 268, 260, 284},
-    },
-    { /* blk_fnum=67 */
-        {0, 26, 13, 52},
-        {4, 30, 17, 56},
-        {8, 34, 21, 60},
-        {12, 38, 25, 64},
-        {16, 42, 29, 68},
-        {20, 46, 33, 72},
-        {24, 50, 37, 76},
-        {28, 54, 41, 80},
-        {32, 58, 45, 84},
-        {36, 62, 49, 88},
-        {40, 66, 53, 92},
-        {44, 70, 57, 96},
-        {48, 74, 61, 100},
-        {52, 78, 65, 104},
-        {56, 82, 69, 108},
-        {60, 86, 73, 112},
-        {64, 90, 77, 116},
-        {68, 94, 81, 120},
-        {72, 98, 85, 124},
-        {76, 102, 89, 128},
-        {80, 106, 93, 132},
-        {84, 110, 97, 136},
-        {88, 114, 101, 140},
-        {92, 118, 105, 144},
-        {96, 122, 109, 148},
-        {100, 126, 113, 152},
-        {104, 130, 117, 156},
-        {108, 134, 121, 160},
-        {112, 138, 125, 164},
-        {116, 142, 129, 168},
-        {120, 146, 133, 172},
-        {124, 150, 137, 176},
-        {128, 154, 141, 180},
-        {132, 158, 145, 184},
-        {136, 162, 149, 188},
-        {140, 166, 153, 192},
-        {144, 170, 157, 196},
-        {148, 174, 161, 200},
-        {152, 178, 165, 204},
-        {156, 182, 169, 208},
-        {160, 186, 173, 212},
-        {164, 190, 177, 216},
-        {168, 194, 181, 220},
-        {172, 198, 185, 224},
-        {176, 202, 189, 228},
-        {180, 206, 193, 232},
-        {184, 210, 197, 236},
-        {188, 214, 201, 240},
-        {192, 218, 205, 244},
-        {196, 222, 209, 248},
-        {200, 226, 213, 252},
-        {204, 230, 217, 256},
-        {208, 234, 221, 260},
-        {212, 238, 225, 264},
-        {216, 242, 229, 268},
-        {220, 246, 233, 272},
-        {224, 250, 237, 276},
-        {228, 254, 241, 280},
-        {232, 258, 245, 284},
-        {236, 262, 249, 288},
-        {240, 266, 253, 292},
-        {244, 270, 257, 296},
-        {248, 274, 261, 300},
-        {252, 278, 265, 304},
-    },
-    { /* blk_fnum=68 */
-        {0, 32, 16, 64},
-        {4, 36, 20, 68},
-        {8, 40, 24, 72},
-        {12, 44, 28, 76},
-        {16, 48, 32, 80},
-        {20, 52, 36, 84},
-        {24, 56, 40, 88},
-        {28, 60, 44, 92},
-        {32, 64, 48, 96},
-        {36, 68, 52, 100},
-        {40, 72, 56, 104},
-        {44, 76, 60, 108},
-        {48, 80, 64, 112},
-        {52, 84, 68, 116},
-        {56, 88, 72, 120},
-        {60, 92, 76, 124},
-        {64, 96, 80, 128},
-        {68, 100, 84, 132},
-        {72, 104, 88, 136},
-        {76, 108, 92, 140},
-        {80, 112, 96, 144},
-        {84, 116, 100, 148},
-        {88, 120, 104, 152},
-        {92, 124, 108, 156},
-        {96, 128, 112, 160},
-        {100, 132, 116, 164},
-        {104, 136, 120, 168},
-        {108, 140, 124, 172},
-        {112, 144, 128, 176},
-        {116, 148, 132, 180},
-        {120, 152, 136, 184},
-        {124, 156, 140, 188},
-        {128, 160, 144, 192},
-        {132, 164, 148, 196},
-        {136, 168, 152, 200},
-        {140, 172, 156, 204},
-        {144, 176, 160, 208},
-        {148, 180, 164, 212},
-        {152, 184, 168, 216},
-        {156, 188, 172, 220},
-        {160, 192, 176, 224},
-        {164, 196, 180, 228},
-        {168, 200, 184, 232},
-        {172, 204, 188, 236},
-        {176, 208, 192, 240},
-        {180, 212, 196, 244},
-        {184, 216, 200, 248},
-        {188, 220, 204, 252},
-        {192, 224, 208, 256},
-        {196, 228, 212, 260},
-        {200, 232, 216, 264},
-        {204, 236, 220, 268},
-        {208, 240, 224, 272},
-        {212, 244, 228, 276},
-        {216, 248, 232, 280},
-        {220, 252, 236, 284},
-        {224, 256, 240, 288},
-        {228, 260, 244, 292},
-        {232, 264, 248, 296},
-        {236, 268, 252, 300},
-        {240, 272, 256, 304},
-        {244, 276, 260, 308},
-        {248, 280, 264, 312},
-        {252, 284, 268, 316},
-    },
-    { /* blk_fnum=69 */
-        {0, 38, 19, 76},
-        {4, 42, 23, 80},
-        {8, 46, 27, 84},
-        {12, 50, 31, 88},
-        {16, 54, 35, 92},
-        {20, 58, 39, 96},
-        {24, 62, 43, 100},
-        {28, 66, 47, 104},
-        {32, 70, 51, 108},
-        {36, 74, 55, 112},
-        {40, 78, 59, 116},
-        {44, 82, 63, 120},
-        {48, 86, 67, 124},
-        {52, 90, 71, 128},
-        {56, 94, 75, 132},
-        {60, 98, 79, 136},
-        {64, 102, 83, 140},
-        {68, 106, 87, 144},
-        {72, 110, 91, 148},
-        {76, 114, 95, 152},
-        {80, 118, 99, 156},
-        {84, 122, 103, 160},
-        {88, 126, 107, 164},
-        {92, 130, 111, 168},
-        {96, 134, 115, 172},
-        {100, 138, 119, 176},
-        {104, 142, 123, 180},
-        {108, 146, 127, 184},
-        {112, 150, 131, 188},
-        {116, 154, 135, 192},
-        {120, 158, 139, 196},
-        {124, 162, 143, 200},
-        {128, 166, 147, 204},
-        {132, 170, 151, 208},
-        {136, 174, 155, 212},
-        {140, 178, 159, 216},
-        {144, 182, 163, 220},
-        {148, 186, 167, 224},
-        {152, 190, 171, 228},
-        {156, 194, 175, 232},
-        {160, 198, 179, 236},
-        {164, 202, 183, 240},
-        {168, 206, 187, 244},
-        {172, 210, 191, 248},
-        {176, 214, 195, 252},
-        {180, 218, 199, 256},
-        {184, 222, 203, 260},
-        {188, 226, 207, 264},
-        {192, 230, 211, 268},
-        {196, 234, 215, 272},
-        {200, 238, 219, 276},
-        {204, 242, 223, 280},
-        {208, 246, 227, 284},
-        {212, 250, 231, 288},
-        {216, 254, 235, 292},
-        {220, 258, 239, 296},
-        {224, 262, 243, 300},
-        {228, 266, 247, 304},
-        {232, 270, 251, 308},
-        {236, 274, 255, 312},
-        {240, 278, 259, 316},
-        {244, 282, 263, 320},
-        {248, 286, 267, 324},
-        {252, 290, 271, 328},
-    },
-    { /* blk_fnum=70 */
-        {0, 42, 21, 84},
-        {4, 46, 25, 88},
-        {8, 50, 29, 92},
-        {12, 54, 33, 96},
-        {16, 58, 37, 100},
-        {20, 62, 41, 104},
-        {24, 66, 45, 108},
-        {28, 70, 49, 112},
-        {32, 74, 53, 116},
-        {36, 78, 57, 120},
-        {40, 82, 61, 124},
-        {44, 86, 65, 128},
-        {48, 90, 69, 132},
-        {52, 94, 73, 136},
-        {56, 98, 77, 140},
-        {60, 102, 81, 144},
-        {64, 106, 85, 148},
-        {68, 110, 89, 152},
-        {72, 114, 93, 156},
-        {76, 118, 97, 160},
-        {80, 122, 101, 164},
-        {84, 126, 105, 168},
-        {88, 130, 109, 172},
-        {92, 134, 113, 176},
-        {96, 138, 117, 180},
-        {100, 142, 121, 184},
-        {104, 146, 125, 188},
-        {108, 150, 129, 192},
-        {112, 154, 133, 196},
-        {116, 158, 137, 200},
-        {120, 162, 141, 204},
-        {124, 166, 145, 208},
-        {128, 170, 149, 212},
-        {132, 174, 153, 216},
-        {136, 178, 157, 220},
-        {140, 182, 161, 224},
-        {144, 186, 165, 228},
-        {148, 190, 169, 232},
-        {152, 194, 173, 236},
-        {156, 198, 177, 240},
-        {160, 202, 181, 244},
-        {164, 206, 185, 248},
-        {168, 210, 189, 252},
-        {172, 214, 193, 256},
-        {176, 218, 197, 260},
-        {180, 222, 201, 264},
-        {184, 226, 205, 268},
-        {188, 230, 209, 272},
-        {192, 234, 213, 276},
-        {196, 238, 217, 280},
-        {200, 242, 221, 284},
-        {204, 246, 225, 288},
-        {208, 250, 229, 292},
-        {212, 254, 233, 296},
-        {216, 258, 237, 300},
-        {220, 262, 241, 304},
-        {224, 266, 245, 308},
-        {228, 270, 249, 312},
-        {232, 274, 253, 316},
-        {236, 278, 257, 320},
-        {240, 282, 261, 324},
-        {244, 286, 265, 328},
-        {248, 290, 269, 332},
-        {252, 294, 273, 336},
-    },
-    { /* blk_fnum=71 */
-        {0, 46, 23, 92},
-        {4, 50, 27, 96},
-        {8, 54, 31, 100},
-        {12, 58, 35, 104},
-        {16, 62, 39, 108},
-        {20, 66, 43, 112},
-        {24, 70, 47, 116},
-        {28, 74, 51, 120},
-        {32, 78, 55, 124},
-        {36, 82, 59, 128},
-        {40, 86, 63, 132},
-        {44, 90, 67, 136},
-        {48, 94, 71, 140},
-        {52, 98, 75, 144},
-        {56, 102, 79, 148},
-        {60, 106, 83, 152},
-        {64, 110, 87, 156},
-        {68, 114, 91, 160},
-        {72, 118, 95, 164},
-        {76, 122, 99, 168},
-        {80, 126, 103, 172},
-        {84, 130, 107, 176},
-        {88, 134, 111, 180},
-        {92, 138, 115, 184},
-        {96, 142, 119, 188},
-        {100, 146, 123, 192},
-        {104, 150, 127, 196},
-        {108, 154, 131, 200},
-        {112, 158, 135, 204},
-        {116, 162, 139, 208},
-        {120, 166, 143, 212},
-        {124, 170, 147, 216},
-        {128, 174, 151, 220},
-        {132, 178, 155, 224},
-        {136, 182, 159, 228},
-        {140, 186, 163, 232},
-        {144, 190, 167, 236},
-        {148, 194, 171, 240},
-        {152, 198, 175, 244},
-        {156, 202, 179, 248},
-        {160, 206, 183, 252},
-        {164, 210, 187, 256},
-        {168, 214, 191, 260},
-        {172, 218, 195, 264},
-        {176, 222, 199, 268},
-        {180, 226, 203, 272},
-        {184, 230, 207, 276},
-        {188, 234, 211, 280},
-        {192, 238, 215, 284},
-        {196, 242, 219, 288},
-        {200, 246, 223, 292},
-        {204, 250, 227, 296},
-        {208, 254, 231, 300},
-        {212, 258, 235, 304},
-        {216, 262, 239, 308},
-        {220, 266, 243, 312},
-        {224, 270, 247, 316},
-        {228, 274, 251, 320},
-        {232, 278, 255, 324},
-        {236, 282, 259, 328},
-        {240, 286, 263, 332},
-        {244, 290, 267, 336},
-        {248, 294, 271, 340},
-        {252, 298, 275, 344},
-    },
-    { /* blk_fnum=72 */
-        {0, 48, 24, 96},
-        {4, 52, 28, 100},
-        {8, 56, 32, 104},
-        {12, 60, 36, 108},
-        {16, 64, 40, 112},
-        {20, 68, 44, 116},
-        {24, 72, 48, 120},
-        {28, 76, 52, 124},
-        {32, 80, 56, 128},
-        {36, 84, 60, 132},
-        {40, 88, 64, 136},
-        {44, 92, 68, 140},
-        {48, 96, 72, 144},
-        {52, 100, 76, 148},
-        {56, 104, 80, 152},
-        {60, 108, 84, 156},
-        {64, 112, 88, 160},
-        {68, 116, 92, 164},
-        {72, 120, 96, 168},
-        {76, 124, 100, 172},
-        {80, 128, 104, 176},
-        {84, 132, 108, 180},
-        {88, 136, 112, 184},
-        {92, 140, 116, 188},
-        {96, 144, 120, 192},
-        {100, 148, 124, 196},
-        {104, 152, 128, 200},
-        {108, 156, 132, 204},
-        {112, 160, 136, 208},
-        {116, 164, 140, 212},
-        {120, 168, 144, 216},
-        {124, 172, 148, 220},
-        {128, 176, 152, 224},
-        {132, 180, 156, 228},
-        {136, 184, 160, 232},
-        {140, 188, 164, 236},
-        {144, 192, 168, 240},
-        {148, 196, 172, 244},
-        {152, 200, 176, 248},
-        {156, 204, 180, 252},
-        {160, 208, 184, 256},
-        {164, 212, 188, 260},
-        {168, 216, 192, 264},
-        {172, 220, 196, 268},
-        {176, 224, 200, 272},
-        {180, 228, 204, 276},
-        {184, 232, 208, 280},
-        {188, 236, 212, 284},
-        {192, 240, 216, 288},
-        {196, 244, 220, 292},
-        {200, 248, 224, 296},
-        {204, 252, 228, 300},
-        {208, 256, 232, 304},
-        {212, 260, 236, 308},
-        {216, 264, 240, 312},
-        {220, 268, 244, 316},
-        {224, 272, 248, 320},
-        {228, 276, 252, 324},
-        {232, 280, 256, 328},
-        {236, 284, 260, 332},
-        {240, 288, 264, 336},
-        {244, 292, 268, 340},
-        {248, 296, 272, 344},
-        {252, 300, 276, 348},
-    },
-    { /* blk_fnum=73 */
-        {0, 52, 26, 104},
-        {4, 56, 30, 108},
-        {8, 60, 34, 112},
-        {12, 64, 38, 116},
-        {16, 68, 42, 120},
-        {20, 72, 46, 124},
-        {24, 76, 50, 128},
-        {28, 80, 54, 132},
-        {32, 84, 58, 136},
-        {36, 88, 62, 140},
-        {40, 92, 66, 144},
-        {44, 96, 70, 148},
-        {48, 100, 74, 152},
-        {52, 104, 78, 156},
-        {56, 108, 82, 160},
-        {60, 112, 86, 164},
-        {64, 116, 90, 168},
-        {68, 120, 94, 172},
-        {72, 124, 98, 176},
-        {76, 128, 102, 180},
-        {80, 132, 106, 184},
-        {84, 136, 110, 188},
-        {88, 140, 114, 192},
-        {92, 144, 118, 196},
-        {96, 148, 122, 200},
-        {100, 152, 126, 204},
-        {104, 156, 130, 208},
-        {108, 160, 134, 212},
-        {112, 164, 138, 216},
-        {116, 168, 142, 220},
-        {120, 172, 146, 224},
-        {124, 176, 150, 228},
-        {128, 180, 154, 232},
-        {132, 184, 158, 236},
-        {136, 188, 162, 240},
-        {140, 192, 166, 244},
-        {144, 196, 170, 248},
-        {148, 200, 174, 252},
-        {152, 204, 178, 256},
-        {156, 208, 182, 260},
-        {160, 212, 186, 264},
-        {164, 216, 190, 268},
-        {168, 220, 194, 272},
-        {172, 224, 198, 276},
-        {176, 228, 202, 280},
-        {180, 232, 206, 284},
-        {184, 236, 210, 288},
-        {188, 240, 214, 292},
-        {192, 244, 218, 296},
-        {196, 248, 222, 300},
-        {200, 252, 226, 304},
-        {204, 256, 230, 308},
-        {208, 260, 234, 312},
-        {212, 264, 238, 316},
-        {216, 268, 242, 320},
-        {220, 272, 246, 324},
-        {224, 276, 250, 328},
-        {228, 280, 254, 332},
-        {232, 284, 258, 336},
-        {236, 288, 262, 340},
-        {240, 292, 266, 344},
-        {244, 296, 270, 348},
-        {248, 300, 274, 352},
-        {252, 304, 278, 356},
-    },
-    { /* blk_fnum=74 */
-        {0, 54, 27, 108},
-        {4, 58, 31, 112},
-        {8, 62, 35, 116},
-        {12, 66, 39, 120},
-        {16, 70, 43, 124},
-        {20, 74, 47, 128},
-        {24, 78, 51, 132},
-        {28, 82, 55, 136},
-        {32, 86, 59, 140},
-        {36, 90, 63, 144},
-        {40, 94, 67, 148},
-        {44, 98, 71, 152},
-        {48, 102, 75, 156},
-        {52, 106, 79, 160},
-        {56, 110, 83, 164},
-        {60, 114, 87, 168},
-        {64, 118, 91, 172},
-        {68, 122, 95, 176},
-        {72, 126, 99, 180},
-        {76, 130, 103, 184},
-        {80, 134, 107, 188},
-        {84, 138, 111, 192},
-        {88, 142, 115, 196},
-        {92, 146, 119, 200},
-        {96, 150, 123, 204},
-        {100, 154, 127, 208},
-        {104, 158, 131, 212},
-        {108, 162, 135, 216},
-        {112, 166, 139, 220},
-        {116, 170, 143, 224},
-        {120, 174, 147, 228},
-        {124, 178, 151, 232},
-        {128, 182, 155, 236},
-        {132, 186, 159, 240},
-        {136, 190, 163, 244},
-        {140, 194, 167, 248},
-        {144, 198, 171, 252},
-        {148, 202, 175, 256},
-        {152, 206, 179, 260},
-        {156, 210, 183, 264},
-        {160, 214, 187, 268},
-        {164, 218, 191, 272},
-        {168, 222, 195, 276},
-        {172, 226, 199, 280},
-        {176, 230, 203, 284},
-        {180, 234, 207, 288},
-        {184, 238, 211, 292},
-        {188, 242, 215, 296},
-        {192, 246, 219, 300},
-        {196, 250, 223, 304},
-        {200, 254, 227, 308},
-        {204, 258, 231, 312},
-        {208, 262, 235, 316},
-        {212, 266, 239, 320},
-        {216, 270, 243, 324},
-        {220, 274, 247, 328},
-        {224, 278, 251, 332},
-        {228, 282, 255, 336},
-        {232, 286, 259, 340},
-        {236, 290, 263, 344},
-        {240, 294, 267, 348},
-        {244, 298, 271, 352},
-        {248, 302, 275, 356},
-        {252, 306, 279, 360},
-    },
-    { /* blk_fnum=75 */
-        {0, 56, 28, 112},
-        {4, 60, 32, 116},
-        {8, 64, 36, 120},
-        {12, 68, 40, 124},
-        {16, 72, 44, 128},
-        {20, 76, 48, 132},
-        {24, 80, 52, 136},
-        {28, 84, 56, 140},
-        {32, 88, 60, 144},
-        {36, 92, 64, 148},
-        {40, 96, 68, 152},
-        {44, 100, 72, 156},
-        {48, 104, 76, 160},
-        {52, 108, 80, 164},
-        {56, 112, 84, 168},
-        {60, 116, 88, 172},
-        {64, 120, 92, 176},
-        {68, 124, 96, 180},
-        {72, 128, 100, 184},
-        {76, 132, 104, 188},
-        {80, 136, 108, 192},
-        {84, 140, 112, 196},
-        {88, 144, 116, 200},
-        {92, 148, 120, 204},
-        {96, 152, 124, 208},
-        {100, 156, 128, 212},
-        {104, 160, 132, 216},
-        {108, 164, 136, 220},
-        {112, 168, 140, 224},
-        {116, 172, 144, 228},
-        {120, 176, 148, 232},
-        {124, 180, 152, 236},
-        {128, 184, 156, 240},
-        {132, 188, 160, 244},
-        {136, 192, 164, 248},
-        {140, 196, 168, 252},
-        {144, 200, 172, 256},
-        {148, 204, 176, 260},
-        {152, 208, 180, 264},
-        {156, 212, 184, 268},
-        {160, 216, 188, 272},
-        {164, 220, 192, 276},
-        {168, 224, 196, 280},
-        {172, 228, 200, 284},
-        {176, 232, 204, 288},
-        {180, 236, 208, 292},
-        {184, 240, 212, 296},
-        {188, 244, 216, 300},
-        {192, 248, 220, 304},
-        {196, 252, 224, 308},
-        {200, 256, 228, 312},
-        {204, 260, 232, 316},
-        {208, 264, 236, 320},
-        {212, 268, 240, 324},
-        {216, 272, 244, 328},
-        {220, 276, 248, 332},
-        {224, 280, 252, 336},
-        {228, 284, 256, 340},
-        {232, 288, 260, 344},
-        {236, 292, 264, 348},
-        {240, 296, 268, 352},
-        {244, 300, 272, 356},
-        {248, 304, 276, 360},
-        {252, 308, 280, 364},
-    },
-    { /* blk_fnum=76 */
-        {0, 58, 29, 116},
-        {4, 62, 33, 120},
-        {8, 66, 37, 124},
-        {12, 70, 41, 128},
-        {16, 74, 45, 132},
-        {20, 78, 49, 136},
-        {24, 82, 53, 140},
-        {28, 86, 57, 144},
-        {32, 90, 61, 148},
-        {36, 94, 65, 152},
-        {40, 98, 69, 156},
-        {44, 102, 73, 160},
-        {48, 106, 77, 164},
-        {52, 110, 81, 168},
-        {56, 114, 85, 172},
-        {60, 118, 89, 176},
-        {64, 122, 93, 180},
-        {68, 126, 97, 184},
-        {72, 130, 101, 188},
-        {76, 134, 105, 192},
-        {80, 138, 109, 196},
-        {84, 142, 113, 200},
-        {88, 146, 117, 204},
-        {92, 150, 121, 208},
-        {96, 154, 125, 212},
-        {100, 158, 129, 216},
-        {104, 162, 133, 220},
-        {108, 166, 137, 224},
-        {112, 170, 141, 228},
-        {116, 174, 145, 232},
-        {120, 178, 149, 236},
-        {124, 182, 153, 240},
-        {128, 186, 157, 244},
-        {132, 190, 161, 248},
-        {136, 194, 165, 252},
-        {140, 198, 169, 256},
-        {144, 202, 173, 260},
-        {148, 206, 177, 264},
-        {152, 210, 181, 268},
-        {156, 214, 185, 272},
-        {160, 218, 189, 276},
-        {164, 222, 193, 280},
-        {168, 226, 197, 284},
-        {172, 230, 201, 288},
-        {176, 234, 205, 292},
-        {180, 238, 209, 296},
-        {184, 242, 213, 300},
-        {188, 246, 217, 304},
-        {192, 250, 221, 308},
-        {196, 254, 225, 312},
-        {200, 258, 229, 316},
-        {204, 262, 233, 320},
-        {208, 266, 237, 324},
-        {212, 270, 241, 328},
-        {216, 274, 245, 332},
-        {220, 278, 249, 336},
-        {224, 282, 253, 340},
-        {228, 286, 257, 344},
-        {232, 290, 261, 348},
-        {236, 294, 265, 352},
-        {240, 298, 269, 356},
-        {244, 302, 273, 360},
-        {248, 306, 277, 364},
-        {252, 310, 281, 368},
-    },
-    { /* blk_fnum=77 */
-        {0, 60, 30, 120},
-        {4, 64, 34, 124},
-        {8, 68, 38, 128},
-        {12, 72, 42, 132},
-        {16, 76, 46, 136},
-        {20, 80, 50, 140},
-        {24, 84, 54, 144},
-        {28, 88, 58, 148},
-        {32, 92, 62, 152},
-        {36, 96, 66, 156},
-        {40, 100, 70, 160},
-        {44, 104, 74, 164},
-        {48, 108, 78, 168},
-        {52, 112, 82, 172},
-        {56, 116, 86, 176},
-        {60, 120, 90, 180},
-        {64, 124, 94, 184},
-        {68, 128, 98, 188},
-        {72, 132, 102, 192},
-        {76, 136, 106, 196},
-        {80, 140, 110, 200},
-        {84, 144, 114, 204},
-        {88, 148, 118, 208},
-        {92, 152, 122, 212},
-        {96, 156, 126, 216},
-        {100, 160, 130, 220},
-        {104, 164, 134, 224},
-        {108, 168, 138, 228},
-        {112, 172, 142, 232},
-        {116, 176, 146, 236},
-        {120, 180, 150, 240},
-        {124, 184, 154, 244},
-        {128, 188, 158, 248},
-        {132, 192, 162, 252},
-        {136, 196, 166, 256},
-        {140, 200, 170, 260},
-        {144, 204, 174, 264},
-        {148, 208, 178, 268},
-        {152, 212, 182, 272},
-        {156, 216, 186, 276},
-        {160, 220, 190, 280},
-        {164, 224, 194, 284},
-        {168, 228, 198, 288},
-        {172, 232, 202, 292},
-        {176, 236, 206, 296},
-        {180, 240, 210, 300},
-        {184, 244, 214, 304},
-        {188, 248, 218, 308},
-        {192, 252, 222, 312},
-        {196, 256, 226, 316},
-        {200, 260, 230, 320},
-        {204, 264, 234, 324},
-        {208, 268, 238, 328},
-        {212, 272, 242, 332},
-        {216, 276, 246, 336},
-        {220, 280, 250, 340},
-        {224, 284, 254, 344},
-        {228, 288, 258, 348},
-        {232, 292, 262, 352},
-        {236, 296, 266, 356},
-        {240, 300, 270, 360},
-        {244, 304, 274, 364},
-        {248, 308, 278, 368},
-        {252, 312, 282, 372},
-    },
-    { /* blk_fnum=78 */
-        {0, 62, 31, 124},
-        {4, 66, 35, 128},
-        {8, 70, 39, 132},
-        {12, 74, 43, 136},
-        {16, 78, 47, 140},
-        {20, 82, 51, 144},
-        {24, 86, 55, 148},
-        {28, 90, 59, 152},
-        {32, 94, 63, 156},
-        {36, 98, 67, 160},
-        {40, 102, 71, 164},
-        {44, 106, 75, 168},
-        {48, 110, 79, 172},
-        {52, 114, 83, 176},
-        {56, 118, 87, 180},
-        {60, 122, 91, 184},
-        {64, 126, 95, 188},
-        {68, 130, 99, 192},
-        {72, 134, 103, 196},
-        {76, 138, 107, 200},
-        {80, 142, 111, 204},
-        {84, 146, 115, 208},
-        {88, 150, 119, 212},
-        {92, 154, 123, 216},
-        {96, 158, 127, 220},
-        {100, 162, 131, 224},
-        {104, 166, 135, 228},
-        {108, 170, 139, 232},
-        {112, 174, 143, 236},
-        {116, 178, 147, 240},
-        {120, 182, 151, 244},
-        {124, 186, 155, 248},
-        {128, 190, 159, 252},
-        {132, 194, 163, 256},
-        {136, 198, 167, 260},
-        {140, 202, 171, 264},
-        {144, 206, 175, 268},
-        {148, 210, 179, 272},
-        {152, 214, 183, 276},
-        {156, 218, 187, 280},
-        {160, 222, 191, 284},
-        {164, 226, 195, 288},
-        {168, 230, 199, 292},
-        {172, 234, 203, 296},
-        {176, 238, 207, 300},
-        {180, 242, 211, 304},
-        {184, 246, 215, 308},
-        {188, 250, 219, 312},
-        {192, 254, 223, 316},
-        {196, 258, 227, 320},
-        {200, 262, 231, 324},
-        {204, 266, 235, 328},
-        {208, 270, 239, 332},
-        {212, 274, 243, 336},
-        {216, 278, 247, 340},
-        {220, 282, 251, 344},
-        {224, 286, 255, 348},
-        {228, 290, 259, 352},
-        {232, 294, 263, 356},
-        {236, 298, 267, 360},
-        {240, 302, 271, 364},
-        {244, 306, 275, 368},
-        {248, 310, 279, 372},
-        {252, 314, 283, 376},
-    },
-    { /* blk_fnum=79 */
-        {0, 64, 32, 128},
-        {4, 68, 36, 132},
-        {8, 72, 40, 136},
-        {12, 76, 44, 140},
-        {16, 80, 48, 144},
-        {20, 84, 52, 148},
-        {24, 88, 56, 152},
-        {28, 92, 60, 156},
-        {32, 96, 64, 160},
-        {36, 100, 68, 164},
-        {40, 104, 72, 168},
-        {44, 108, 76, 172},
-        {48, 112, 80, 176},
-        {52, 116, 84, 180},
-        {56, 120, 88, 184},
-        {60, 124, 92, 188},
-        {64, 128, 96, 192},
-        {68, 132, 100, 196},
-        {72, 136, 104, 200},
-        {76, 140, 108, 204},
-        {80, 144, 112, 208},
-        {84, 148, 116, 212},
-        {88, 152, 120, 216},
-        {92, 156, 124, 220},
-        {96, 160, 128, 224},
-        {100, 164, 132, 228},
-        {104, 168, 136, 232},
-        {108, 172, 140, 236},
-        {112, 176, 144, 240},
-        {116, 180, 148, 244},
-        {120, 184, 152, 248},
-        {124, 188, 156, 252},
-        {128, 192, 160, 256},
-        {132, 196, 164, 260},
-        {136, 200, 168, 264},
-        {140, 204, 172, 268},
-        {144, 208, 176, 272},
-        {148, 212, 180, 276},
-        {152, 216, 184, 280},
-        {156, 220, 188, 284},
-        {160, 224, 192, 288},
-        {164, 228, 196, 292},
-        {168, 232, 200, 296},
-        {172, 236, 204, 300},
-        {176, 240, 208, 304},
-        {180, 244, 212, 308},
-        {184, 248, 216, 312},
-        {188, 252, 220, 316},
-        {192, 256, 224, 320},
-        {196, 260, 228, 324},
-        {200, 264, 232, 328},
-        {204, 268, 236, 332},
-        {208, 272, 240, 336},
-        {212, 276, 244, 340},
-        {216, 280, 248, 344},
-        {220, 284, 252, 348},
-        {224, 288, 256, 352},
-        {228, 292, 260, 356},
-        {232, 296, 264, 360},
-        {236, 300, 268, 364},
-        {240, 304, 272, 368},
-        {244, 308, 276, 372},
-        {248, 312, 280, 376},
-        {252, 316, 284, 380},
-    },
-    { /* blk_fnum=80 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=81 */
-        {0, 16, 8, 32},
-        {4, 20, 12, 36},
-        {8, 24, 16, 40},
-        {12, 28, 20, 44},
-        {16, 32, 24, 48},
-        {20, 36, 28, 52},
-        {24, 40, 32, 56},
-        {28, 44, 36, 60},
-        {32, 48, 40, 64},
-        {36, 52, 44, 68},
-        {40, 56, 48, 72},
-        {44, 60, 52, 76},
-        {48, 64, 56, 80},
-        {52, 68, 60, 84},
-        {56, 72, 64, 88},
-        {60, 76, 68, 92},
-        {64, 80, 72, 96},
-        {68, 84, 76, 100},
-        {72, 88, 80, 104},
-        {76, 92, 84, 108},
-        {80, 96, 88, 112},
-        {84, 100, 92, 116},
-        {88, 104, 96, 120},
-        {92, 108, 100, 124},
-        {96, 112, 104, 128},
-        {100, 116, 108, 132},
-        {104, 120, 112, 136},
-        {108, 124, 116, 140},
-        {112, 128, 120, 144},
-        {116, 132, 124, 148},
-        {120, 136, 128, 152},
-        {124, 140, 132, 156},
-        {128, 144, 136, 160},
-        {132, 148, 140, 164},
-        {136, 152, 144, 168},
-        {140, 156, 148, 172},
-        {144, 160, 152, 176},
-        {148, 164, 156, 180},
-        {152, 168, 160, 184},
-        {156, 172, 164, 188},
-        {160, 176, 168, 192},
-        {164, 180, 172, 196},
-        {168, 184, 176, 200},
-        {172, 188, 180, 204},
-        {176, 192, 184, 208},
-        {180, 196, 188, 212},
-        {184, 200, 192, 216},
-        {188, 204, 196, 220},
-        {192, 208, 200, 224},
-        {196, 212, 204, 228},
-        {200, 216, 208, 232},
-        {204, 220, 212, 236},
-        {208, 224, 216, 240},
-        {212, 228, 220, 244},
-        {216, 232, 224, 248},
-        {220, 236, 228, 252},
-        {224, 240, 232, 256},
-        {228, 244, 236, 260},
-        {232, 248, 240, 264},
-        {236, 252, 244, 268},
-        {240, 256, 248, 272},
-        {244, 260, 252, 276},
-        {248, 264, 256, 280},
-        {252, 268, 260, 284},
-    },
-    { /* blk_fnum=82 */
-        {0, 32, 16, 64},
-        {4, 36, 20, 68},
-        {8, 40, 24, 72},
-        {12, 44, 28, 76},
-        {16, 48, 32, 80},
-        {20, 52, 36, 84},
-        {24, 56, 40, 88},
-        {28, 60, 44, 92},
-        {32, 64, 48, 96},
-        {36, 68, 52, 100},
-        {40, 72, 56, 104},
-        {44, 76, 60, 108},
-        {48, 80, 64, 112},
-        {52, 84, 68, 116},
-        {56, 88, 72, 120},
-        {60, 92, 76, 124},
-        {64, 96, 80, 128},
-        {68, 100, 84, 132},
-        {72, 104, 88, 136},
-        {76, 108, 92, 140},
-        {80, 112, 96, 144},
-        {84, 116, 100, 148},
-        {88, 120, 104, 152},
-        {92, 124, 108, 156},
-        {96, 128, 112, 160},
-        {100, 132, 116, 164},
-        {104, 136, 120, 168},
-        {108, 140, 124, 172},
-        {112, 144, 128, 176},
-        {116, 148, 132, 180},
-        {120, 152, 136, 184},
-        {124, 156, 140, 188},
-        {128, 160, 144, 192},
-        {132, 164, 148, 196},
-        {136, 168, 152, 200},
-        {140, 172, 156, 204},
-        {144, 176, 160, 208},
-        {148, 180, 164, 212},
-        {152, 184, 168, 216},
-        {156, 188, 172, 220},
-        {160, 192, 176, 224},
-        {164, 196, 180, 228},
-        {168, 200, 184, 232},
-        {172, 204, 188, 236},
-        {176, 208, 192, 240},
-        {180, 212, 196, 244},
-        {184, 216, 200, 248},
-        {188, 220, 204, 252},
-        {192, 224, 208, 256},
-        {196, 228, 212, 260},
-        {200, 232, 216, 264},
-        {204, 236, 220, 268},
-        {208, 240, 224, 272},
-        {212, 244, 228, 276},
-        {216, 248, 232, 280},
-        {220, 252, 236, 284},
-        {224, 256, 240, 288},
-        {228, 260, 244, 292},
-        {232, 264, 248, 296},
-        {236, 268, 252, 300},
-        {240, 272, 256, 304},
-        {244, 276, 260, 308},
-        {248, 280, 264, 312},
-        {252, 284, 268, 316},
-    },
-    { /* blk_fnum=83 */
-        {0, 42, 21, 84},
-        {4, 46, 25, 88},
-        {8, 50, 29, 92},
-        {12, 54, 33, 96},
-        {16, 58, 37, 100},
-        {20, 62, 41, 104},
-        {24, 66, 45, 108},
-        {28, 70, 49, 112},
-        {32, 74, 53, 116},
-        {36, 78, 57, 120},
-        {40, 82, 61, 124},
-        {44, 86, 65, 128},
-        {48, 90, 69, 132},
-        {52, 94, 73, 136},
-        {56, 98, 77, 140},
-        {60, 102, 81, 144},
-        {64, 106, 85, 148},
-        {68, 110, 89, 152},
-        {72, 114, 93, 156},
-        {76, 118, 97, 160},
-        {80, 122, 101, 164},
-        {84, 126, 105, 168},
-        {88, 130, 109, 172},
-        {92, 134, 113, 176},
-        {96, 138, 117, 180},
-        {100, 142, 121, 184},
-        {104, 146, 125, 188},
-        {108, 150, 129, 192},
-        {112, 154, 133, 196},
-        {116, 158, 137, 200},
-        {120, 162, 141, 204},
-        {124, 166, 145, 208},
-        {128, 170, 149, 212},
-        {132, 174, 153, 216},
-        {136, 178, 157, 220},
-        {140, 182, 161, 224},
-        {144, 186, 165, 228},
-        {148, 190, 169, 232},
-        {152, 194, 173, 236},
-        {156, 198, 177, 240},
-        {160, 202, 181, 244},
-        {164, 206, 185, 248},
-        {168, 210, 189, 252},
-        {172, 214, 193, 256},
-        {176, 218, 197, 260},
-        {180, 222, 201, 264},
-        {184, 226, 205, 268},
-        {188, 230, 209, 272},
-        {192, 234, 213, 276},
-        {196, 238, 217, 280},
-        {200, 242, 221, 284},
-        {204, 246, 225, 288},
-        {208, 250, 229, 292},
-        {212, 254, 233, 296},
-        {216, 258, 237, 300},
-        {220, 262, 241, 304},
-        {224, 266, 245, 308},
-        {228, 270, 249, 312},
-        {232, 274, 253, 316},
-        {236, 278, 257, 320},
-        {240, 282, 261, 324},
-        {244, 286, 265, 328},
-        {248, 290, 269, 332},
-        {252, 294, 273, 336},
-    },
-    { /* blk_fnum=84 */
-        {0, 48, 24, 96},
-        {4, 52, 28, 100},
-        {8, 56, 32, 104},
-        {12, 60, 36, 108},
-        {16, 64, 40, 112},
-        {20, 68, 44, 116},
-        {24, 72, 48, 120},
-        {28, 76, 52, 124},
-        {32, 80, 56, 128},
-        {36, 84, 60, 132},
-        {40, 88, 64, 136},
-        {44, 92, 68, 140},
-        {48, 96, 72, 144},
-        {52, 100, 76, 148},
-        {56, 104, 80, 152},
-        {60, 108, 84, 156},
-        {64, 112, 88, 160},
-        {68, 116, 92, 164},
-        {72, 120, 96, 168},
-        {76, 124, 100, 172},
-        {80, 128, 104, 176},
-        {84, 132, 108, 180},
-        {88, 136, 112, 184},
-        {92, 140, 116, 188},
-        {96, 144, 120, 192},
-        {100, 148, 124, 196},
-        {104, 152, 128, 200},
-        {108, 156, 132, 204},
-        {112, 160, 136, 208},
-        {116, 164, 140, 212},
-        {120, 168, 144, 216},
-        {124, 172, 148, 220},
-        {128, 176, 152, 224},
-        {132, 180, 156, 228},
-        {136, 184, 160, 232},
-        {140, 188, 164, 236},
-        {144, 192, 168, 240},
-        {148, 196, 172, 244},
-        {152, 200, 176, 248},
-        {156, 204, 180, 252},
-        {160, 208, 184, 256},
-        {164, 212, 188, 260},
-        {168, 216, 192, 264},
-        {172, 220, 196, 268},
-        {176, 224, 200, 272},
-        {180, 228, 204, 276},
-        {184, 232, 208, 280},
-        {188, 236, 212, 284},
-        {192, 240, 216, 288},
-        {196, 244, 220, 292},
-        {200, 248, 224, 296},
-        {204, 252, 228, 300},
-        {208, 256, 232, 304},
-        {212, 260, 236, 308},
-        {216, 264, 240, 312},
-        {220, 268, 244, 316},
-        {224, 272, 248, 320},
-        {228, 276, 252, 324},
-        {232, 280, 256, 328},
-        {236, 284, 260, 332},
-        {240, 288, 264, 336},
-        {244, 292, 268, 340},
-        {248, 296, 272, 344},
-        {252, 300, 276, 348},
-    },
-    { /* blk_fnum=85 */
-        {0, 54, 27, 108},
-        {4, 58, 31, 112},
-        {8, 62, 35, 116},
-        {12, 66, 39, 120},
-        {16, 70, 43, 124},
-        {20, 74, 47, 128},
-        {24, 78, 51, 132},
-        {28, 82, 55, 136},
-        {32, 86, 59, 140},
-        {36, 90, 63, 144},
-        {40, 94, 67, 148},
-        {44, 98, 71, 152},
-        {48, 102, 75, 156},
-        {52, 106, 79, 160},
-        {56, 110, 83, 164},
-        {60, 114, 87, 168},
-        {64, 118, 91, 172},
-        {68, 122, 95, 176},
-        {72, 126, 99, 180},
-        {76, 130, 103, 184},
-        {80, 134, 107, 188},
-        {84, 138, 111, 192},
-        {88, 142, 115, 196},
-        {92, 146, 119, 200},
-        {96, 150, 123, 204},
-        {100, 154, 127, 208},
-        {104, 158, 131, 212},
-        {108, 162, 135, 216},
-        {112, 166, 139, 220},
-        {116, 170, 143, 224},
-        {120, 174, 147, 228},
-        {124, 178, 151, 232},
-        {128, 182, 155, 236},
-        {132, 186, 159, 240},
-        {136, 190, 163, 244},
-        {140, 194, 167, 248},
-        {144, 198, 171, 252},
-        {148, 202, 175, 256},
-        {152, 206, 179, 260},
-        {156, 210, 183, 264},
-        {160, 214, 187, 268},
-        {164, 218, 191, 272},
-        {168, 222, 195, 276},
-        {172, 226, 199, 280},
-        {176, 230, 203, 284},
-        {180, 234, 207, 288},
-        {184, 238, 211, 292},
-        {188, 242, 215, 296},
-        {192, 246, 219, 300},
-        {196, 250, 223, 304},
-        {200, 254, 227, 308},
-        {204, 258, 231, 312},
-        {208, 262, 235, 316},
-        {212, 266, 239, 320},
-        {216, 270, 243, 324},
-        {220, 274, 247, 328},
-        {224, 278, 251, 332},
-        {228, 282, 255, 336},
-        {232, 286, 259, 340},
-        {236, 290, 263, 344},
-        {240, 294, 267, 348},
-        {244, 298, 271, 352},
-        {248, 302, 275, 356},
-        {252, 306, 279, 360},
-    },
-    { /* blk_fnum=86 */
-        {0, 58, 29, 116},
-        {4, 62, 33, 120},
-        {8, 66, 37, 124},
-        {12, 70, 41, 128},
-        {16, 74, 45, 132},
-        {20, 78, 49, 136},
-        {24, 82, 53, 140},
-        {28, 86, 57, 144},
-        {32, 90, 61, 148},
-        {36, 94, 65, 152},
-        {40, 98, 69, 156},
-        {44, 102, 73, 160},
-        {48, 106, 77, 164},
-        {52, 110, 81, 168},
-        {56, 114, 85, 172},
-        {60, 118, 89, 176},
-        {64, 122, 93, 180},
-        {68, 126, 97, 184},
-        {72, 130, 101, 188},
-        {76, 134, 105, 192},
-        {80, 138, 109, 196},
-        {84, 142, 113, 200},
-        {88, 146, 117, 204},
-        {92, 150, 121, 208},
-        {96, 154, 125, 212},
-        {100, 158, 129, 216},
-        {104, 162, 133, 220},
-        {108, 166, 137, 224},
-        {112, 170, 141, 228},
-        {116, 174, 145, 232},
-        {120, 178, 149, 236},
-        {124, 182, 153, 240},
-        {128, 186, 157, 244},
-        {132, 190, 161, 248},
-        {136, 194, 165, 252},
-        {140, 198, 169, 256},
-        {144, 202, 173, 260},
-        {148, 206, 177, 264},
-        {152, 210, 181, 268},
-        {156, 214, 185, 272},
-        {160, 218, 189, 276},
-        {164, 222, 193, 280},
-        {168, 226, 197, 284},
-        {172, 230, 201, 288},
-        {176, 234, 205, 292},
-        {180, 238, 209, 296},
-        {184, 242, 213, 300},
-        {188, 246, 217, 304},
-        {192, 250, 221, 308},
-        {196, 254, 225, 312},
-        {200, 258, 229, 316},
-        {204, 262, 233, 320},
-        {208, 266, 237, 324},
-        {212, 270, 241, 328},
-        {216, 274, 245, 332},
-        {220, 278, 249, 336},
-        {224, 282, 253, 340},
-        {228, 286, 257, 344},
-        {232, 290, 261, 348},
-        {236, 294, 265, 352},
-        {240, 298, 269, 356},
-        {244, 302, 273, 360},
-        {248, 306, 277, 364},
-        {252, 310, 281, 368},
-    },
-    { /* blk_fnum=87 */
-        {0, 62, 31, 124},
-        {4, 66, 35, 128},
-        {8, 70, 39, 132},
-        {12, 74, 43, 136},
-        {16, 78, 47, 140},
-        {20, 82, 51, 144},
-        {24, 86, 55, 148},
-        {28, 90, 59, 152},
-        {32, 94, 63, 156},
-        {36, 98, 67, 160},
-        {40, 102, 71, 164},
-        {44, 106, 75, 168},
-        {48, 110, 79, 172},
-        {52, 114, 83, 176},
-        {56, 118, 87, 180},
-        {60, 122, 91, 184},
-        {64, 126, 95, 188},
-        {68, 130, 99, 192},
-        {72, 134, 103, 196},
-        {76, 138, 107, 200},
-        {80, 142, 111, 204},
-        {84, 146, 115, 208},
-        {88, 150, 119, 212},
-        {92, 154, 123, 216},
-        {96, 158, 127, 220},
-        {100, 162, 131, 224},
-        {104, 166, 135, 228},
-        {108, 170, 139, 232},
-        {112, 174, 143, 236},
-        {116, 178, 147, 240},
-        {120, 182, 151, 244},
-        {124, 186, 155, 248},
-        {128, 190, 159, 252},
-        {132, 194, 163, 256},
-        {136, 198, 167, 260},
-        {140, 202, 171, 264},
-        {144, 206, 175, 268},
-        {148, 210, 179, 272},
-        {152, 214, 183, 276},
-        {156, 218, 187, 280},
-        {160, 222, 191, 284},
-        {164, 226, 195, 288},
-        {168, 230, 199, 292},
-        {172, 234, 203, 296},
-        {176, 238, 207, 300},
-        {180, 242, 211, 304},
-        {184, 246, 215, 308},
-        {188, 250, 219, 312},
-        {192, 254, 223, 316},
-        {196, 258, 227, 320},
-        {200, 262, 231, 324},
-        {204, 266, 235, 328},
-        {208, 270, 239, 332},
-        {212, 274, 243, 336},
-        {216, 278, 247, 340},
-        {220, 282, 251, 344},
-        {224, 286, 255, 348},
-        {228, 290, 259, 352},
-        {232, 294, 263, 356},
-        {236, 298, 267, 360},
-        {240, 302, 271, 364},
-        {244, 306, 275, 368},
-        {248, 310, 279, 372},
-        {252, 314, 283, 376},
-    },
-    { /* blk_fnum=88 */
-        {0, 64, 32, 128},
-        {4, 68, 36, 132},
-        {8, 72, 40, 136},
-        {12, 76, 44, 140},
-        {16, 80, 48, 144},
-        {20, 84, 52, 148},
-        {24, 88, 56, 152},
-        {28, 92, 60, 156},
-        {32, 96, 64, 160},
-        {36, 100, 68, 164},
-        {40, 104, 72, 168},
-        {44, 108, 76, 172},
-        {48, 112, 80, 176},
-        {52, 116, 84, 180},
-        {56, 120, 88, 184},
-        {60, 124, 92, 188},
-        {64, 128, 96, 192},
-        {68, 132, 100, 196},
-        {72, 136, 104, 200},
-        {76, 140, 108, 204},
-        {80, 144, 112, 208},
-        {84, 148, 116, 212},
-        {88, 152, 120, 216},
-        {92, 156, 124, 220},
-        {96, 160, 128, 224},
-        {100, 164, 132, 228},
-        {104, 168, 136, 232},
-        {108, 172, 140, 236},
-        {112, 176, 144, 240},
-        {116, 180, 148, 244},
-        {120, 184, 152, 248},
-        {124, 188, 156, 252},
-        {128, 192, 160, 256},
-        {132, 196, 164, 260},
-        {136, 200, 168, 264},
-        {140, 204, 172, 268},
-        {144, 208, 176, 272},
-        {148, 212, 180, 276},
-        {152, 216, 184, 280},
-        {156, 220, 188, 284},
-        {160, 224, 192, 288},
-        {164, 228, 196, 292},
-        {168, 232, 200, 296},
-        {172, 236, 204, 300},
-        {176, 240, 208, 304},
-        {180, 244, 212, 308},
-        {184, 248, 216, 312},
-        {188, 252, 220, 316},
-        {192, 256, 224, 320},
-        {196, 260, 228, 324},
-        {200, 264, 232, 328},
-        {204, 268, 236, 332},
-        {208, 272, 240, 336},
-        {212, 276, 244, 340},
-        {216, 280, 248, 344},
-        {220, 284, 252, 348},
-        {224, 288, 256, 352},
-        {228, 292, 260, 356},
-        {232, 296, 264, 360},
-        {236, 300, 268, 364},
-        {240, 304, 272, 368},
-        {244, 308, 276, 372},
-        {248, 312, 280, 376},
-        {252, 316, 284, 380},
-    },
-    { /* blk_fnum=89 */
-        {0, 68, 34, 136},
-        {4, 72, 38, 140},
-        {8, 76, 42, 144},
-        {12, 80, 46, 148},
-        {16, 84, 50, 152},
-        {20, 88, 54, 156},
-        {24, 92, 58, 160},
-        {28, 96, 62, 164},
-        {32, 100, 66, 168},
-        {36, 104, 70, 172},
-        {40, 108, 74, 176},
-        {44, 112, 78, 180},
-        {48, 116, 82, 184},
-        {52, 120, 86, 188},
-        {56, 124, 90, 192},
-        {60, 128, 94, 196},
-        {64, 132, 98, 200},
-        {68, 136, 102, 204},
-        {72, 140, 106, 208},
-        {76, 144, 110, 212},
-        {80, 148, 114, 216},
-        {84, 152, 118, 220},
-        {88, 156, 122, 224},
-        {92, 160, 126, 228},
-        {96, 164, 130, 232},
-        {100, 168, 134, 236},
-        {104, 172, 138, 240},
-        {108, 176, 142, 244},
-        {112, 180, 146, 248},
-        {116, 184, 150, 252},
-        {120, 188, 154, 256},
-        {124, 192, 158, 260},
-        {128, 196, 162, 264},
-        {132, 200, 166, 268},
-        {136, 204, 170, 272},
-        {140, 208, 174, 276},
-        {144, 212, 178, 280},
-        {148, 216, 182, 284},
-        {152, 220, 186, 288},
-        {156, 224, 190, 292},
-        {160, 228, 194, 296},
-        {164, 232, 198, 300},
-        {168, 236, 202, 304},
-        {172, 240, 206, 308},
-        {176, 244, 210, 312},
-        {180, 248, 214, 316},
-        {184, 252, 218, 320},
-        {188, 256, 222, 324},
-        {192, 260, 226, 328},
-        {196, 264, 230, 332},
-        {200, 268, 234, 336},
-        {204, 272, 238, 340},
-        {208, 276, 242, 344},
-        {212, 280, 246, 348},
-        {216, 284, 250, 352},
-        {220, 288, 254, 356},
-        {224, 292, 258, 360},
-        {228, 296, 262, 364},
-        {232, 300, 266, 368},
-        {236, 304, 270, 372},
-        {240, 308, 274, 376},
-        {244, 312, 278, 380},
-        {248, 316, 282, 384},
-        {252, 320, 286, 388},
-    },
-    { /* blk_fnum=90 */
-        {0, 70, 35, 140},
-        {4, 74, 39, 144},
-        {8, 78, 43, 148},
-        {12, 82, 47, 152},
-        {16, 86, 51, 156},
-        {20, 90, 55, 160},
-        {24, 94, 59, 164},
-        {28, 98, 63, 168},
-        {32, 102, 67, 172},
-        {36, 106, 71, 176},
-        {40, 110, 75, 180},
-        {44, 114, 79, 184},
-        {48, 118, 83, 188},
-        {52, 122, 87, 192},
-        {56, 126, 91, 196},
-        {60, 130, 95, 200},
-        {64, 134, 99, 204},
-        {68, 138, 103, 208},
-        {72, 142, 107, 212},
-        {76, 146, 111, 216},
-        {80, 150, 115, 220},
-        {84, 154, 119, 224},
-        {88, 158, 123, 228},
-        {92, 162, 127, 232},
-        {96, 166, 131, 236},
-        {100, 170, 135, 240},
-        {104, 174, 139, 244},
-        {108, 178, 143, 248},
-        {112, 182, 147, 252},
-        {116, 186, 151, 256},
-        {120, 190, 155, 260},
-        {124, 194, 159, 264},
-        {128, 198, 163, 268},
-        {132, 202, 167, 272},
-        {136, 206, 171, 276},
-        {140, 210, 175, 280},
-        {144, 214, 179, 284},
-        {148, 218, 183, 288},
-        {152, 222, 187, 292},
-        {156, 226, 191, 296},
-        {160, 230, 195, 300},
-        {164, 234, 199, 304},
-        {168, 238, 203, 308},
-        {172, 242, 207, 312},
-        {176, 246, 211, 316},
-        {180, 250, 215, 320},
-        {184, 254, 219, 324},
-        {188, 258, 223, 328},
-        {192, 262, 227, 332},
-        {196, 266, 231, 336},
-        {200, 270, 235, 340},
-        {204, 274, 239, 344},
-        {208, 278, 243, 348},
-        {212, 282, 247, 352},
-        {216, 286, 251, 356},
-        {220, 290, 255, 360},
-        {224, 294, 259, 364},
-        {228, 298, 263, 368},
-        {232, 302, 267, 372},
-        {236, 306, 271, 376},
-        {240, 310, 275, 380},
-        {244, 314, 279, 384},
-        {248, 318, 283, 388},
-        {252, 322, 287, 392},
-    },
-    { /* blk_fnum=91 */
-        {0, 72, 36, 144},
-        {4, 76, 40, 148},
-        {8, 80, 44, 152},
-        {12, 84, 48, 156},
-        {16, 88, 52, 160},
-        {20, 92, 56, 164},
-        {24, 96, 60, 168},
-        {28, 100, 64, 172},
-        {32, 104, 68, 176},
-        {36, 108, 72, 180},
-        {40, 112, 76, 184},
-        {44, 116, 80, 188},
-        {48, 120, 84, 192},
-        {52, 124, 88, 196},
-        {56, 128, 92, 200},
-        {60, 132, 96, 204},
-        {64, 136, 100, 208},
-        {68, 140, 104, 212},
-        {72, 144, 108, 216},
-        {76, 148, 112, 220},
-        {80, 152, 116, 224},
-        {84, 156, 120, 228},
-        {88, 160, 124, 232},
-        {92, 164, 128, 236},
-        {96, 168, 132, 240},
-        {100, 172, 136, 244},
-        {104, 176, 140, 248},
-        {108, 180, 144, 252},
-        {112, 184, 148, 256},
-        {116, 188, 152, 260},
-        {120, 192, 156, 264},
-        {124, 196, 160, 268},
-        {128, 200, 164, 272},
-        {132, 204, 168, 276},
-        {136, 208, 172, 280},
-        {140, 212, 176, 284},
-        {144, 216, 180, 288},
-        {148, 220, 184, 292},
-        {152, 224, 188, 296},
-        {156, 228, 192, 300},
-        {160, 232, 196, 304},
-        {164, 236, 200, 308},
-        {168, 240, 204, 312},
-        {172, 244, 208, 316},
-        {176, 248, 212, 320},
-        {180, 252, 216, 324},
-        {184, 256, 220, 328},
-        {188, 260, 224, 332},
-        {192, 264, 228, 336},
-        {196, 268, 232, 340},
-        {200, 272, 236, 344},
-        {204, 276, 240, 348},
-        {208, 280, 244, 352},
-        {212, 284, 248, 356},
-        {216, 288, 252, 360},
-        {220, 292, 256, 364},
-        {224, 296, 260, 368},
-        {228, 300, 264, 372},
-        {232, 304, 268, 376},
-        {236, 308, 272, 380},
-        {240, 312, 276, 384},
-        {244, 316, 280, 388},
-        {248, 320, 284, 392},
-        {252, 324, 288, 396},
-    },
-    { /* blk_fnum=92 */
-        {0, 74, 37, 148},
-        {4, 78, 41, 152},
-        {8, 82, 45, 156},
-        {12, 86, 49, 160},
-        {16, 90, 53, 164},
-        {20, 94, 57, 168},
-        {24, 98, 61, 172},
-        {28, 102, 65, 176},
-        {32, 106, 69, 180},
-        {36, 110, 73, 184},
-        {40, 114, 77, 188},
-        {44, 118, 81, 192},
-        {48, 122, 85, 196},
-        {52, 126, 89, 200},
-        {56, 130, 93, 204},
-        {60, 134, 97, 208},
-        {64, 138, 101, 212},
-        {68, 142, 105, 216},
-        {72, 146, 109, 220},
-        {76, 150, 113, 224},
-        {80, 154, 117, 228},
-        {84, 158, 121, 232},
-        {88, 162, 125, 236},
-        {92, 166, 129, 240},
-        {96, 170, 133, 244},
-        {100, 174, 137, 248},
-        {104, 178, 141, 252},
-        {108, 182, 145, 256},
-        {112, 186, 149, 260},
-        {116, 190, 153, 264},
-        {120, 194, 157, 268},
-        {124, 198, 161, 272},
-        {128, 202, 165, 276},
-        {132, 206, 169, 280},
-        {136, 210, 173, 284},
-        {140, 214, 177, 288},
-        {144, 218, 181, 292},
-        {148, 222, 185, 296},
-        {152, 226, 189, 300},
-        {156, 230, 193, 304},
-        {160, 234, 197, 308},
-        {164, 238, 201, 312},
-        {168, 242, 205, 316},
-        {172, 246, 209, 320},
-        {176, 250, 213, 324},
-        {180, 254, 217, 328},
-        {184, 258, 221, 332},
-        {188, 262, 225, 336},
-        {192, 266, 229, 340},
-        {196, 270, 233, 344},
-        {200, 274, 237, 348},
-        {204, 278, 241, 352},
-        {208, 282, 245, 356},
-        {212, 286, 249, 360},
-        {216, 290, 253, 364},
-        {220, 294, 257, 368},
-        {224, 298, 261, 372},
-        {228, 302, 265, 376},
-        {232, 306, 269, 380},
-        {236, 310, 273, 384},
-        {240, 314, 277, 388},
-        {244, 318, 281, 392},
-        {248, 322, 285, 396},
-        {252, 326, 289, 400},
-    },
-    { /* blk_fnum=93 */
-        {0, 76, 38, 152},
-        {4, 80, 42, 156},
-        {8, 84, 46, 160},
-        {12, 88, 50, 164},
-        {16, 92, 54, 168},
-        {20, 96, 58, 172},
-        {24, 100, 62, 176},
-        {28, 104, 66, 180},
-        {32, 108, 70, 184},
-        {36, 112, 74, 188},
-        {40, 116, 78, 192},
-        {44, 120, 82, 196},
-        {48, 124, 86, 200},
-        {52, 128, 90, 204},
-        {56, 132, 94, 208},
-        {60, 136, 98, 212},
-        {64, 140, 102, 216},
-        {68, 144, 106, 220},
-        {72, 148, 110, 224},
-        {76, 152, 114, 228},
-        {80, 156, 118, 232},
-        {84, 160, 122, 236},
-        {88, 164, 126, 240},
-        {92, 168, 130, 244},
-        {96, 172, 134, 248},
-        {100, 176, 138, 252},
-        {104, 180, 142, 256},
-        {108, 184, 146, 260},
-        {112, 188, 150, 264},
-        {116, 192, 154, 268},
-        {120, 196, 158, 272},
-        {124, 200, 162, 276},
-        {128, 204, 166, 280},
-        {132, 208, 170, 284},
-        {136, 212, 174, 288},
-        {140, 216, 178, 292},
-        {144, 220, 182, 296},
-        {148, 224, 186, 300},
-        {152, 228, 190, 304},
-        {156, 232, 194, 308},
-        {160, 236, 198, 312},
-        {164, 240, 202, 316},
-        {168, 244, 206, 320},
-        {172, 248, 210, 324},
-        {176, 252, 214, 328},
-        {180, 256, 218, 332},
-        {184, 260, 222, 336},
-        {188, 264, 226, 340},
-        {192, 268, 230, 344},
-        {196, 272, 234, 348},
-        {200, 276, 238, 352},
-        {204, 280, 242, 356},
-        {208, 284, 246, 360},
-        {212, 288, 250, 364},
-        {216, 292, 254, 368},
-        {220, 296, 258, 372},
-        {224, 300, 262, 376},
-        {228, 304, 266, 380},
-        {232, 308, 270, 384},
-        {236, 312, 274, 388},
-        {240, 316, 278, 392},
-        {244, 320, 282, 396},
-        {248, 324, 286, 400},
-        {252, 328, 290, 404},
-    },
-    { /* blk_fnum=94 */
-        {0, 78, 39, 156},
-        {4, 82, 43, 160},
-        {8, 86, 47, 164},
-        {12, 90, 51, 168},
-        {16, 94, 55, 172},
-        {20, 98, 59, 176},
-        {24, 102, 63, 180},
-        {28, 106, 67, 184},
-        {32, 110, 71, 188},
-        {36, 114, 75, 192},
-        {40, 118, 79, 196},
-        {44, 122, 83, 200},
-        {48, 126, 87, 204},
-        {52, 130, 91, 208},
-        {56, 134, 95, 212},
-        {60, 138, 99, 216},
-        {64, 142, 103, 220},
-        {68, 146, 107, 224},
-        {72, 150, 111, 228},
-        {76, 154, 115, 232},
-        {80, 158, 119, 236},
-        {84, 162, 123, 240},
-        {88, 166, 127, 244},
-        {92, 170, 131, 248},
-        {96, 174, 135, 252},
-        {100, 178, 139, 256},
-        {104, 182, 143, 260},
-        {108, 186, 147, 264},
-        {112, 190, 151, 268},
-        {116, 194, 155, 272},
-        {120, 198, 159, 276},
-        {124, 202, 163, 280},
-        {128, 206, 167, 284},
-        {132, 210, 171, 288},
-        {136, 214, 175, 292},
-        {140, 218, 179, 296},
-        {144, 222, 183, 300},
-        {148, 226, 187, 304},
-        {152, 230, 191, 308},
-        {156, 234, 195, 312},
-        {160, 238, 199, 316},
-        {164, 242, 203, 320},
-        {168, 246, 207, 324},
-        {172, 250, 211, 328},
-        {176, 254, 215, 332},
-        {180, 258, 219, 336},
-        {184, 262, 223, 340},
-        {188, 266, 227, 344},
-        {192, 270, 231, 348},
-        {196, 274, 235, 352},
-        {200, 278, 239, 356},
-        {204, 282, 243, 360},
-        {208, 286, 247, 364},
-        {212, 290, 251, 368},
-        {216, 294, 255, 372},
-        {220, 298, 259, 376},
-        {224, 302, 263, 380},
-        {228, 306, 267, 384},
-        {232, 310, 271, 388},
-        {236, 314, 275, 392},
-        {240, 318, 279, 396},
-        {244, 322, 283, 400},
-        {248, 326, 287, 404},
-        {252, 330, 291, 408},
-    },
-    { /* blk_fnum=95 */
-        {0, 80, 40, 160},
-        {4, 84, 44, 164},
-        {8, 88, 48, 168},
-        {12, 92, 52, 172},
-        {16, 96, 56, 176},
-        {20, 100, 60, 180},
-        {24, 104, 64, 184},
-        {28, 108, 68, 188},
-        {32, 112, 72, 192},
-        {36, 116, 76, 196},
-        {40, 120, 80, 200},
-        {44, 124, 84, 204},
-        {48, 128, 88, 208},
-        {52, 132, 92, 212},
-        {56, 136, 96, 216},
-        {60, 140, 100, 220},
-        {64, 144, 104, 224},
-        {68, 148, 108, 228},
-        {72, 152, 112, 232},
-        {76, 156, 116, 236},
-        {80, 160, 120, 240},
-        {84, 164, 124, 244},
-        {88, 168, 128, 248},
-        {92, 172, 132, 252},
-        {96, 176, 136, 256},
-        {100, 180, 140, 260},
-        {104, 184, 144, 264},
-        {108, 188, 148, 268},
-        {112, 192, 152, 272},
-        {116, 196, 156, 276},
-        {120, 200, 160, 280},
-        {124, 204, 164, 284},
-        {128, 208, 168, 288},
-        {132, 212, 172, 292},
-        {136, 216, 176, 296},
-        {140, 220, 180, 300},
-        {144, 224, 184, 304},
-        {148, 228, 188, 308},
-        {152, 232, 192, 312},
-        {156, 236, 196, 316},
-        {160, 240, 200, 320},
-        {164, 244, 204, 324},
-        {168, 248, 208, 328},
-        {172, 252, 212, 332},
-        {176, 256, 216, 336},
-        {180, 260, 220, 340},
-        {184, 264, 224, 344},
-        {188, 268, 228, 348},
-        {192, 272, 232, 352},
-        {196, 276, 236, 356},
-        {200, 280, 240, 360},
-        {204, 284, 244, 364},
-        {208, 288, 248, 368},
-        {212, 292, 252, 372},
-        {216, 296, 256, 376},
-        {220, 300, 260, 380},
-        {224, 304, 264, 384},
-        {228, 308, 268, 388},
-        {232, 312, 272, 392},
-        {236, 316, 276, 396},
-        {240, 320, 280, 400},
-        {244, 324, 284, 404},
-        {248, 328, 288, 408},
-        {252, 332, 292, 412},
-    },
-    { /* blk_fnum=96 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=97 */
-        {0, 32, 16, 64},
-        {4, 36, 20, 68},
-        {8, 40, 24, 72},
-        {12, 44, 28, 76},
-        {16, 48, 32, 80},
-        {20, 52, 36, 84},
-        {24, 56, 40, 88},
-        {28, 60, 44, 92},
-        {32, 64, 48, 96},
-        {36, 68, 52, 100},
-        {40, 72, 56, 104},
-        {44, 76, 60, 108},
-        {48, 80, 64, 112},
-        {52, 84, 68, 116},
-        {56, 88, 72, 120},
-        {60, 92, 76, 124},
-        {64, 96, 80, 128},
-        {68, 100, 84, 132},
-        {72, 104, 88, 136},
-        {76, 108, 92, 140},
-        {80, 112, 96, 144},
-        {84, 116, 100, 148},
-        {88, 120, 104, 152},
-        {92, 124, 108, 156},
-        {96, 128, 112, 160},
-        {100, 132, 116, 164},
-        {104, 136, 120, 168},
-        {108, 140, 124, 172},
-        {112, 144, 128, 176},
-        {116, 148, 132, 180},
-        {120, 152, 136, 184},
-        {124, 156, 140, 188},
-        {128, 160, 144, 192},
-        {132, 164, 148, 196},
-        {136, 168, 152, 200},
-        {140, 172, 156, 204},
-        {144, 176, 160, 208},
-        {148, 180, 164, 212},
-        {152, 184, 168, 216},
-        {156, 188, 172, 220},
-        {160, 192, 176, 224},
-        {164, 196, 180, 228},
-        {168, 200, 184, 232},
-        {172, 204, 188, 236},
-        {176, 208, 192, 240},
-        {180, 212, 196, 244},
-        {184, 216, 200, 248},
-        {188, 220, 204, 252},
-        {192, 224, 208, 256},
-        {196, 228, 212, 260},
-        {200, 232, 216, 264},
-        {204, 236, 220, 268},
-        {208, 240, 224, 272},
-        {212, 244, 228, 276},
-        {216, 248, 232, 280},
-        {220, 252, 236, 284},
-        {224, 256, 240, 288},
-        {228, 260, 244, 292},
-        {232, 264, 248, 296},
-        {236, 268, 252, 300},
-        {240, 272, 256, 304},
-        {244, 276, 260, 308},
-        {248, 280, 264, 312},
-        {252, 284, 268, 316},
-    },
-    { /* blk_fnum=98 */
-        {0, 48, 24, 96},
-        {4, 52, 28, 100},
-        {8, 56, 32, 104},
-        {12, 60, 36, 108},
-        {16, 64, 40, 112},
-        {20, 68, 44, 116},
-        {24, 72, 48, 120},
-        {28, 76, 52, 124},
-        {32, 80, 56, 128},
-        {36, 84, 60, 132},
-        {40, 88, 64, 136},
-        {44, 92, 68, 140},
-        {48, 96, 72, 144},
-        {52, 100, 76, 148},
-        {56, 104, 80, 152},
-        {60, 108, 84, 156},
-        {64, 112, 88, 160},
-        {68, 116, 92, 164},
-        {72, 120, 96, 168},
-        {76, 124, 100, 172},
-        {80, 128, 104, 176},
-        {84, 132, 108, 180},
-        {88, 136, 112, 184},
-        {92, 140, 116, 188},
-        {96, 144, 120, 192},
-        {100, 148, 124, 196},
-        {104, 152, 128, 200},
-        {108, 156, 132, 204},
-        {112, 160, 136, 208},
-        {116, 164, 140, 212},
-        {120, 168, 144, 216},
-        {124, 172, 148, 220},
-        {128, 176, 152, 224},
-        {132, 180, 156, 228},
-        {136, 184, 160, 232},
-        {140, 188, 164, 236},
-        {144, 192, 168, 240},
-        {148, 196, 172, 244},
-        {152, 200, 176, 248},
-        {156, 204, 180, 252},
-        {160, 208, 184, 256},
-        {164, 212, 188, 260},
-        {168, 216, 192, 264},
-        {172, 220, 196, 268},
-        {176, 224, 200, 272},
-        {180, 228, 204, 276},
-        {184, 232, 208, 280},
-        {188, 236, 212, 284},
-        {192, 240, 216, 288},
-        {196, 244, 220, 292},
-        {200, 248, 224, 296},
-        {204, 252, 228, 300},
-        {208, 256, 232, 304},
-        {212, 260, 236, 308},
-        {216, 264, 240, 312},
-        {220, 268, 244, 316},
-        {224, 272, 248, 320},
-        {228, 276, 252, 324},
-        {232, 280, 256, 328},
-        {236, 284, 260, 332},
-        {240, 288, 264, 336},
-        {244, 292, 268, 340},
-        {248, 296, 272, 344},
-        {252, 300, 276, 348},
-    },
-    { /* blk_fnum=99 */
-        {0, 58, 29, 116},
-        {4, 62, 33, 120},
-        {8, 66, 37, 124},
-        {12, 70, 41, 128},
-        {16, 74, 45, 132},
-        {20, 78, 49, 136},
-        {24, 82, 53, 140},
-        {28, 86, 57, 144},
-        {32, 90, 61, 148},
-        {36, 94, 65, 152},
-        {40, 98, 69, 156},
-        {44, 102, 73, 160},
-        {48, 106, 77, 164},
-        {52, 110, 81, 168},
-        {56, 114, 85, 172},
-        {60, 118, 89, 176},
-        {64, 122, 93, 180},
-        {68, 126, 97, 184},
-        {72, 130, 101, 188},
-        {76, 134, 105, 192},
-        {80, 138, 109, 196},
-        {84, 142, 113, 200},
-        {88, 146, 117, 204},
-        {92, 150, 121, 208},
-        {96, 154, 125, 212},
-        {100, 158, 129, 216},
-        {104, 162, 133, 220},
-        {108, 166, 137, 224},
-        {112, 170, 141, 228},
-        {116, 174, 145, 232},
-        {120, 178, 149, 236},
-        {124, 182, 153, 240},
-        {128, 186, 157, 244},
-        {132, 190, 161, 248},
-        {136, 194, 165, 252},
-        {140, 198, 169, 256},
-        {144, 202, 173, 260},
-        {148, 206, 177, 264},
-        {152, 210, 181, 268},
-        {156, 214, 185, 272},
-        {160, 218, 189, 276},
-        {164, 222, 193, 280},
-        {168, 226, 197, 284},
-        {172, 230, 201, 288},
-        {176, 234, 205, 292},
-        {180, 238, 209, 296},
-        {184, 242, 213, 300},
-        {188, 246, 217, 304},
-        {192, 250, 221, 308},
-        {196, 254, 225, 312},
-        {200, 258, 229, 316},
-        {204, 262, 233, 320},
-        {208, 266, 237, 324},
-        {212, 270, 241, 328},
-        {216, 274, 245, 332},
-        {220, 278, 249, 336},
-        {224, 282, 253, 340},
-        {228, 286, 257, 344},
-        {232, 290, 261, 348},
-        {236, 294, 265, 352},
-        {240, 298, 269, 356},
-        {244, 302, 273, 360},
-        {248, 306, 277, 364},
-        {252, 310, 281, 368},
-    },
-    { /* blk_fnum=100 */
-        {0, 64, 32, 128},
-        {4, 68, 36, 132},
-        {8, 72, 40, 136},
-        {12, 76, 44, 140},
-        {16, 80, 48, 144},
-        {20, 84, 52, 148},
-        {24, 88, 56, 152},
-        {28, 92, 60, 156},
-        {32, 96, 64, 160},
-        {36, 100, 68, 164},
-        {40, 104, 72, 168},
-        {44, 108, 76, 172},
-        {48, 112, 80, 176},
-        {52, 116, 84, 180},
-        {56, 120, 88, 184},
-        {60, 124, 92, 188},
-        {64, 128, 96, 192},
-        {68, 132, 100, 196},
-        {72, 136, 104, 200},
-        {76, 140, 108, 204},
-        {80, 144, 112, 208},
-        {84, 148, 116, 212},
-        {88, 152, 120, 216},
-        {92, 156, 124, 220},
-        {96, 160, 128, 224},
-        {100, 164, 132, 228},
-        {104, 168, 136, 232},
-        {108, 172, 140, 236},
-        {112, 176, 144, 240},
-        {116, 180, 148, 244},
-        {120, 184, 152, 248},
-        {124, 188, 156, 252},
-        {128, 192, 160, 256},
-        {132, 196, 164, 260},
-        {136, 200, 168, 264},
-        {140, 204, 172, 268},
-        {144, 208, 176, 272},
-        {148, 212, 180, 276},
-        {152, 216, 184, 280},
-        {156, 220, 188, 284},
-        {160, 224, 192, 288},
-        {164, 228, 196, 292},
-        {168, 232, 200, 296},
-        {172, 236, 204, 300},
-        {176, 240, 208, 304},
-        {180, 244, 212, 308},
-        {184, 248, 216, 312},
-        {188, 252, 220, 316},
-        {192, 256, 224, 320},
-        {196, 260, 228, 324},
-        {200, 264, 232, 328},
-        {204, 268, 236, 332},
-        {208, 272, 240, 336},
-        {212, 276, 244, 340},
-        {216, 280, 248, 344},
-        {220, 284, 252, 348},
-        {224, 288, 256, 352},
-        {228, 292, 260, 356},
-        {232, 296, 264, 360},
-        {236, 300, 268, 364},
-        {240, 304, 272, 368},
-        {244, 308, 276, 372},
-        {248, 312, 280, 376},
-        {252, 316, 284, 380},
-    },
-    { /* blk_fnum=101 */
-        {0, 70, 35, 140},
-        {4, 74, 39, 144},
-        {8, 78, 43, 148},
-        {12, 82, 47, 152},
-        {16, 86, 51, 156},
-        {20, 90, 55, 160},
-        {24, 94, 59, 164},
-        {28, 98, 63, 168},
-        {32, 102, 67, 172},
-        {36, 106, 71, 176},
-        {40, 110, 75, 180},
-        {44, 114, 79, 184},
-        {48, 118, 83, 188},
-        {52, 122, 87, 192},
-        {56, 126, 91, 196},
-        {60, 130, 95, 200},
-        {64, 134, 99, 204},
-        {68, 138, 103, 208},
-        {72, 142, 107, 212},
-        {76, 146, 111, 216},
-        {80, 150, 115, 220},
-        {84, 154, 119, 224},
-        {88, 158, 123, 228},
-        {92, 162, 127, 232},
-        {96, 166, 131, 236},
-        {100, 170, 135, 240},
-        {104, 174, 139, 244},
-        {108, 178, 143, 248},
-        {112, 182, 147, 252},
-        {116, 186, 151, 256},
-        {120, 190, 155, 260},
-        {124, 194, 159, 264},
-        {128, 198, 163, 268},
-        {132, 202, 167, 272},
-        {136, 206, 171, 276},
-        {140, 210, 175, 280},
-        {144, 214, 179, 284},
-        {148, 218, 183, 288},
-        {152, 222, 187, 292},
-        {156, 226, 191, 296},
-        {160, 230, 195, 300},
-        {164, 234, 199, 304},
-        {168, 238, 203, 308},
-        {172, 242, 207, 312},
-        {176, 246, 211, 316},
-        {180, 250, 215, 320},
-        {184, 254, 219, 324},
-        {188, 258, 223, 328},
-        {192, 262, 227, 332},
-        {196, 266, 231, 336},
-        {200, 270, 235, 340},
-        {204, 274, 239, 344},
-        {208, 278, 243, 348},
-        {212, 282, 247, 352},
-        {216, 286, 251, 356},
-        {220, 290, 255, 360},
-        {224, 294, 259, 364},
-        {228, 298, 263, 368},
-        {232, 302, 267, 372},
-        {236, 306, 271, 376},
-        {240, 310, 275, 380},
-        {244, 314, 279, 384},
-        {248, 318, 283, 388},
-        {252, 322, 287, 392},
-    },
-    { /* blk_fnum=102 */
-        {0, 74, 37, 148},
-        {4, 78, 41, 152},
-        {8, 82, 45, 156},
-        {12, 86, 49, 160},
-        {16, 90, 53, 164},
-        {20, 94, 57, 168},
-        {24, 98, 61, 172},
-        {28, 102, 65, 176},
-        {32, 106, 69, 180},
-        {36, 110, 73, 184},
-        {40, 114, 77, 188},
-        {44, 118, 81, 192},
-        {48, 122, 85, 196},
-        {52, 126, 89, 200},
-        {56, 130, 93, 204},
-        {60, 134, 97, 208},
-        {64, 138, 101, 212},
-        {68, 142, 105, 216},
-        {72, 146, 109, 220},
-        {76, 150, 113, 224},
-        {80, 154, 117, 228},
-        {84, 158, 121, 232},
-        {88, 162, 125, 236},
-        {92, 166, 129, 240},
-        {96, 170, 133, 244},
-        {100, 174, 137, 248},
-        {104, 178, 141, 252},
-        {108, 182, 145, 256},
-        {112, 186, 149, 260},
-        {116, 190, 153, 264},
-        {120, 194, 157, 268},
-        {124, 198, 161, 272},
-        {128, 202, 165, 276},
-        {132, 206, 169, 280},
-        {136, 210, 173, 284},
-        {140, 214, 177, 288},
-        {144, 218, 181, 292},
-        {148, 222, 185, 296},
-        {152, 226, 189, 300},
-        {156, 230, 193, 304},
-        {160, 234, 197, 308},
-        {164, 238, 201, 312},
-        {168, 242, 205, 316},
-        {172, 246, 209, 320},
-        {176, 250, 213, 324},
-        {180, 254, 217, 328},
-        {184, 258, 221, 332},
-        {188, 262, 225, 336},
-        {192, 266, 229, 340},
-        {196, 270, 233, 344},
-        {200, 274, 237, 348},
-        {204, 278, 241, 352},
-        {208, 282, 245, 356},
-        {212, 286, 249, 360},
-        {216, 290, 253, 364},
-        {220, 294, 257, 368},
-        {224, 298, 261, 372},
-        {228, 302, 265, 376},
-        {232, 306, 269, 380},
-        {236, 310, 273, 384},
-        {240, 314, 277, 388},
-        {244, 318, 281, 392},
-        {248, 322, 285, 396},
-        {252, 326, 289, 400},
-    },
-    { /* blk_fnum=103 */
-        {0, 78, 39, 156},
-        {4, 82, 43, 160},
-        {8, 86, 47, 164},
-        {12, 90, 51, 168},
-        {16, 94, 55, 172},
-        {20, 98, 59, 176},
-        {24, 102, 63, 180},
-        {28, 106, 67, 184},
-        {32, 110, 71, 188},
-        {36, 114, 75, 192},
-        {40, 118, 79, 196},
-        {44, 122, 83, 200},
-        {48, 126, 87, 204},
-        {52, 130, 91, 208},
-        {56, 134, 95, 212},
-        {60, 138, 99, 216},
-        {64, 142, 103, 220},
-        {68, 146, 107, 224},
-        {72, 150, 111, 228},
-        {76, 154, 115, 232},
-        {80, 158, 119, 236},
-        {84, 162, 123, 240},
-        {88, 166, 127, 244},
-        {92, 170, 131, 248},
-        {96, 174, 135, 252},
-        {100, 178, 139, 256},
-        {104, 182, 143, 260},
-        {108, 186, 147, 264},
-        {112, 190, 151, 268},
-        {116, 194, 155, 272},
-        {120, 198, 159, 276},
-        {124, 202, 163, 280},
-        {128, 206, 167, 284},
-        {132, 210, 171, 288},
-        {136, 214, 175, 292},
-        {140, 218, 179, 296},
-        {144, 222, 183, 300},
-        {148, 226, 187, 304},
-        {152, 230, 191, 308},
-        {156, 234, 195, 312},
-        {160, 238, 199, 316},
-        {164, 242, 203, 320},
-        {168, 246, 207, 324},
-        {172, 250, 211, 328},
-        {176, 254, 215, 332},
-        {180, 258, 219, 336},
-        {184, 262, 223, 340},
-        {188, 266, 227, 344},
-        {192, 270, 231, 348},
-        {196, 274, 235, 352},
-        {200, 278, 239, 356},
-        {204, 282, 243, 360},
-        {208, 286, 247, 364},
-        {212, 290, 251, 368},
-        {216, 294, 255, 372},
-        {220, 298, 259, 376},
-        {224, 302, 263, 380},
-        {228, 306, 267, 384},
-        {232, 310, 271, 388},
-        {236, 314, 275, 392},
-        {240, 318, 279, 396},
-        {244, 322, 283, 400},
-        {248, 326, 287, 404},
-        {252, 330, 291, 408},
-    },
-    { /* blk_fnum=104 */
-        {0, 80, 40, 160},
-        {4, 84, 44, 164},
-        {8, 88, 48, 168},
-        {12, 92, 52, 172},
-        {16, 96, 56, 176},
-        {20, 100, 60, 180},
-        {24, 104, 64, 184},
-        {28, 108, 68, 188},
-        {32, 112, 72, 192},
-        {36, 116, 76, 196},
-        {40, 120, 80, 200},
-        {44, 124, 84, 204},
-        {48, 128, 88, 208},
-        {52, 132, 92, 212},
-        {56, 136, 96, 216},
-        {60, 140, 100, 220},
-        {64, 144, 104, 224},
-        {68, 148, 108, 228},
-        {72, 152, 112, 232},
-        {76, 156, 116, 236},
-        {80, 160, 120, 240},
-        {84, 164, 124, 244},
-        {88, 168, 128, 248},
-        {92, 172, 132, 252},
-        {96, 176, 136, 256},
-        {100, 180, 140, 260},
-        {104, 184, 144, 264},
-        {108, 188, 148, 268},
-        {112, 192, 152, 272},
-        {116, 196, 156, 276},
-        {120, 200, 160, 280},
-        {124, 204, 164, 284},
-        {128, 208, 168, 288},
-        {132, 212, 172, 292},
-        {136, 216, 176, 296},
-        {140, 220, 180, 300},
-        {144, 224, 184, 304},
-        {148, 228, 188, 308},
-        {152, 232, 192, 312},
-        {156, 236, 196, 316},
-        {160, 240, 200, 320},
-        {164, 244, 204, 324},
-        {168, 248, 208, 328},
-        {172, 252, 212, 332},
-        {176, 256, 216, 336},
-        {180, 260, 220, 340},
-        {184, 264, 224, 344},
-        {188, 268, 228, 348},
-        {192, 272, 232, 352},
-        {196, 276, 236, 356},
-        {200, 280, 240, 360},
-        {204, 284, 244, 364},
-        {208, 288, 248, 368},
-        {212, 292, 252, 372},
-        {216, 296, 256, 376},
-        {220, 300, 260, 380},
-        {224, 304, 264, 384},
-        {228, 308, 268, 388},
-        {232, 312, 272, 392},
-        {236, 316, 276, 396},
-        {240, 320, 280, 400},
-        {244, 324, 284, 404},
-        {248, 328, 288, 408},
-        {252, 332, 292, 412},
-    },
-    { /* blk_fnum=105 */
-        {0, 84, 42, 168},
-        {4, 88, 46, 172},
-        {8, 92, 50, 176},
-        {12, 96, 54, 180},
-        {16, 100, 58, 184},
-        {20, 104, 62, 188},
-        {24, 108, 66, 192},
-        {28, 112, 70, 196},
-        {32, 116, 74, 200},
-        {36, 120, 78, 204},
-        {40, 124, 82, 208},
-        {44, 128, 86, 212},
-        {48, 132, 90, 216},
-        {52, 136, 94, 220},
-        {56, 140, 98, 224},
-        {60, 144, 102, 228},
-        {64, 148, 106, 232},
-        {68, 152, 110, 236},
-        {72, 156, 114, 240},
-        {76, 160, 118, 244},
-        {80, 164, 122, 248},
-        {84, 168, 126, 252},
-        {88, 172, 130, 256},
-        {92, 176, 134, 260},
-        {96, 180, 138, 264},
-        {100, 184, 142, 268},
-        {104, 188, 146, 272},
-        {108, 192, 150, 276},
-        {112, 196, 154, 280},
-        {116, 200, 158, 284},
-        {120, 204, 162, 288},
-        {124, 208, 166, 292},
-        {128, 212, 170, 296},
-        {132, 216, 174, 300},
-        {136, 220, 178, 304},
-        {140, 224, 182, 308},
-        {144, 228, 186, 312},
-        {148, 232, 190, 316},
-        {152, 236, 194, 320},
-        {156, 240, 198, 324},
-        {160, 244, 202, 328},
-        {164, 248, 206, 332},
-        {168, 252, 210, 336},
-        {172, 256, 214, 340},
-        {176, 260, 218, 344},
-        {180, 264, 222, 348},
-        {184, 268, 226, 352},
-        {188, 272, 230, 356},
-        {192, 276, 234, 360},
-        {196, 280, 238, 364},
-        {200, 284, 242, 368},
-        {204, 288, 246, 372},
-        {208, 292, 250, 376},
-        {212, 296, 254, 380},
-        {216, 300, 258, 384},
-        {220, 304, 262, 388},
-        {224, 308, 266, 392},
-        {228, 312, 270, 396},
-        {232, 316, 274, 400},
-        {236, 320, 278, 404},
-        {240, 324, 282, 408},
-        {244, 328, 286, 412},
-        {248, 332, 290, 416},
-        {252, 336, 294, 420},
-    },
-    { /* blk_fnum=106 */
-        {0, 86, 43, 172},
-        {4, 90, 47, 176},
-        {8, 94, 51, 180},
-        {12, 98, 55, 184},
-        {16, 102, 59, 188},
-        {20, 106, 63, 192},
-        {24, 110, 67, 196},
-        {28, 114, 71, 200},
-        {32, 118, 75, 204},
-        {36, 122, 79, 208},
-        {40, 126, 83, 212},
-        {44, 130, 87, 216},
-        {48, 134, 91, 220},
-        {52, 138, 95, 224},
-        {56, 142, 99, 228},
-        {60, 146, 103, 232},
-        {64, 150, 107, 236},
-        {68, 154, 111, 240},
-        {72, 158, 115, 244},
-        {76, 162, 119, 248},
-        {80, 166, 123, 252},
-        {84, 170, 127, 256},
-        {88, 174, 131, 260},
-        {92, 178, 135, 264},
-        {96, 182, 139, 268},
-        {100, 186, 143, 272},
-        {104, 190, 147, 276},
-        {108, 194, 151, 280},
-        {112, 198, 155, 284},
-        {116, 202, 159, 288},
-        {120, 206, 163, 292},
-        {124, 210, 167, 296},
-        {128, 214, 171, 300},
-        {132, 218, 175, 304},
-        {136, 222, 179, 308},
-        {140, 226, 183, 312},
-        {144, 230, 187, 316},
-        {148, 234, 191, 320},
-        {152, 238, 195, 324},
-        {156, 242, 199, 328},
-        {160, 246, 203, 332},
-        {164, 250, 207, 336},
-        {168, 254, 211, 340},
-        {172, 258, 215, 344},
-        {176, 262, 219, 348},
-        {180, 266, 223, 352},
-        {184, 270, 227, 356},
-        {188, 274, 231, 360},
-        {192, 278, 235, 364},
-        {196, 282, 239, 368},
-        {200, 286, 243, 372},
-        {204, 290, 247, 376},
-        {208, 294, 251, 380},
-        {212, 298, 255, 384},
-        {216, 302, 259, 388},
-        {220, 306, 263, 392},
-        {224, 310, 267, 396},
-        {228, 314, 271, 400},
-        {232, 318, 275, 404},
-        {236, 322, 279, 408},
-        {240, 326, 283, 412},
-        {244, 330, 287, 416},
-        {248, 334, 291, 420},
-        {252, 338, 295, 424},
-    },
-    { /* blk_fnum=107 */
-        {0, 88, 44, 176},
-        {4, 92, 48, 180},
-        {8, 96, 52, 184},
-        {12, 100, 56, 188},
-        {16, 104, 60, 192},
-        {20, 108, 64, 196},
-        {24, 112, 68, 200},
-        {28, 116, 72, 204},
-        {32, 120, 76, 208},
-        {36, 124, 80, 212},
-        {40, 128, 84, 216},
-        {44, 132, 88, 220},
-        {48, 136, 92, 224},
-        {52, 140, 96, 228},
-        {56, 144, 100, 232},
-        {60, 148, 104, 236},
-        {64, 152, 108, 240},
-        {68, 156, 112, 244},
-        {72, 160, 116, 248},
-        {76, 164, 120, 252},
-        {80, 168, 124, 256},
-        {84, 172, 128, 260},
-        {88, 176, 132, 264},
-        {92, 180, 136, 268},
-        {96, 184, 140, 272},
-        {100, 188, 144, 276},
-        {104, 192, 148, 280},
-        {108, 196, 152, 284},
-        {112, 200, 156, 288},
-        {116, 204, 160, 292},
-        {120, 208, 164, 296},
-        {124, 212, 168, 300},
-        {128, 216, 172, 304},
-        {132, 220, 176, 308},
-        {136, 224, 180, 312},
-        {140, 228, 184, 316},
-        {144, 232, 188, 320},
-        {148, 236, 192, 324},
-        {152, 240, 196, 328},
-        {156, 244, 200, 332},
-        {160, 248, 204, 336},
-        {164, 252, 208, 340},
-        {168, 256, 212, 344},
-        {172, 260, 216, 348},
-        {176, 264, 220, 352},
-        {180, 268, 224, 356},
-        {184, 272, 228, 360},
-        {188, 276, 232, 364},
-        {192, 280, 236, 368},
-        {196, 284, 240, 372},
-        {200, 288, 244, 376},
-        {204, 292, 248, 380},
-        {208, 296, 252, 384},
-        {212, 300, 256, 388},
-        {216, 304, 260, 392},
-        {220, 308, 264, 396},
-        {224, 312, 268, 400},
-        {228, 316, 272, 404},
-        {232, 320, 276, 408},
-        {236, 324, 280, 412},
-        {240, 328, 284, 416},
-        {244, 332, 288, 420},
-        {248, 336, 292, 424},
-        {252, 340, 296, 428},
-    },
-    { /* blk_fnum=108 */
-        {0, 90, 45, 180},
-        {4, 94, 49, 184},
-        {8, 98, 53, 188},
-        {12, 102, 57, 192},
-        {16, 106, 61, 196},
-        {20, 110, 65, 200},
-        {24, 114, 69, 204},
-        {28, 118, 73, 208},
-        {32, 122, 77, 212},
-        {36, 126, 81, 216},
-        {40, 130, 85, 220},
-        {44, 134, 89, 224},
-        {48, 138, 93, 228},
-        {52, 142, 97, 232},
-        {56, 146, 101, 236},
-        {60, 150, 105, 240},
-        {64, 154, 109, 244},
-        {68, 158, 113, 248},
-        {72, 162, 117, 252},
-        {76, 166, 121, 256},
-        {80, 170, 125, 260},
-        {84, 174, 129, 264},
-        {88, 178, 133, 268},
-        {92, 182, 137, 272},
-        {96, 186, 141, 276},
-        {100, 190, 145, 280},
-        {104, 194, 149, 284},
-        {108, 198, 153, 288},
-        {112, 202, 157, 292},
-        {116, 206, 161, 296},
-        {120, 210, 165, 300},
-        {124, 214, 169, 304},
-        {128, 218, 173, 308},
-        {132, 222, 177, 312},
-        {136, 226, 181, 316},
-        {140, 230, 185, 320},
-        {144, 234, 189, 324},
-        {148, 238, 193, 328},
-        {152, 242, 197, 332},
-        {156, 246, 201, 336},
-        {160, 250, 205, 340},
-        {164, 254, 209, 344},
-        {168, 258, 213, 348},
-        {172, 262, 217, 352},
-        {176, 266, 221, 356},
-        {180, 270, 225, 360},
-        {184, 274, 229, 364},
-        {188, 278, 233, 368},
-        {192, 282, 237, 372},
-        {196, 286, 241, 376},
-        {200, 290, 245, 380},
-        {204, 294, 249, 384},
-        {208, 298, 253, 388},
-        {212, 302, 257, 392},
-        {216, 306, 261, 396},
-        {220, 310, 265, 400},
-        {224, 314, 269, 404},
-        {228, 318, 273, 408},
-        {232, 322, 277, 412},
-        {236, 326, 281, 416},
-        {240, 330, 285, 420},
-        {244, 334, 289, 424},
-        {248, 338, 293, 428},
-        {252, 342, 297, 432},
-    },
-    { /* blk_fnum=109 */
-        {0, 92, 46, 184},
-        {4, 96, 50, 188},
-        {8, 100, 54, 192},
-        {12, 104, 58, 196},
-        {16, 108, 62, 200},
-        {20, 112, 66, 204},
-        {24, 116, 70, 208},
-        {28, 120, 74, 212},
-        {32, 124, 78, 216},
-        {36, 128, 82, 220},
-        {40, 132, 86, 224},
-        {44, 136, 90, 228},
-        {48, 140, 94, 232},
-        {52, 144, 98, 236},
-        {56, 148, 102, 240},
-        {60, 152, 106, 244},
-        {64, 156, 110, 248},
-        {68, 160, 114, 252},
-        {72, 164, 118, 256},
-        {76, 168, 122, 260},
-        {80, 172, 126, 264},
-        {84, 176, 130, 268},
-        {88, 180, 134, 272},
-        {92, 184, 138, 276},
-        {96, 188, 142, 280},
-        {100, 192, 146, 284},
-        {104, 196, 150, 288},
-        {108, 200, 154, 292},
-        {112, 204, 158, 296},
-        {116, 208, 162, 300},
-        {120, 212, 166, 304},
-        {124, 216, 170, 308},
-        {128, 220, 174, 312},
-        {132, 224, 178, 316},
-        {136, 228, 182, 320},
-        {140, 232, 186, 324},
-        {144, 236, 190, 328},
-        {148, 240, 194, 332},
-        {152, 244, 198, 336},
-        {156, 248, 202, 340},
-        {160, 252, 206, 344},
-        {164, 256, 210, 348},
-        {168, 260, 214, 352},
-        {172, 264, 218, 356},
-        {176, 268, 222, 360},
-        {180, 272, 226, 364},
-        {184, 276, 230, 368},
-        {188, 280, 234, 372},
-        {192, 284, 238, 376},
-        {196, 288, 242, 380},
-        {200, 292, 246, 384},
-        {204, 296, 250, 388},
-        {208, 300, 254, 392},
-        {212, 304, 258, 396},
-        {216, 308, 262, 400},
-        {220, 312, 266, 404},
-        {224, 316, 270, 408},
-        {228, 320, 274, 412},
-        {232, 324, 278, 416},
-        {236, 328, 282, 420},
-        {240, 332, 286, 424},
-        {244, 336, 290, 428},
-        {248, 340, 294, 432},
-        {252, 344, 298, 436},
-    },
-    { /* blk_fnum=110 */
-        {0, 94, 47, 188},
-        {4, 98, 51, 192},
-        {8, 102, 55, 196},
-        {12, 106, 59, 200},
-        {16, 110, 63, 204},
-        {20, 114, 67, 208},
-        {24, 118, 71, 212},
-        {28, 122, 75, 216},
-        {32, 126, 79, 220},
-        {36, 130, 83, 224},
-        {40, 134, 87, 228},
-        {44, 138, 91, 232},
-        {48, 142, 95, 236},
-        {52, 146, 99, 240},
-        {56, 150, 103, 244},
-        {60, 154, 107, 248},
-        {64, 158, 111, 252},
-        {68, 162, 115, 256},
-        {72, 166, 119, 260},
-        {76, 170, 123, 264},
-        {80, 174, 127, 268},
-        {84, 178, 131, 272},
-        {88, 182, 135, 276},
-        {92, 186, 139, 280},
-        {96, 190, 143, 284},
-        {100, 194, 147, 288},
-        {104, 198, 151, 292},
-        {108, 202, 155, 296},
-        {112, 206, 159, 300},
-        {116, 210, 163, 304},
-        {120, 214, 167, 308},
-        {124, 218, 171, 312},
-        {128, 222, 175, 316},
-        {132, 226, 179, 320},
-        {136, 230, 183, 324},
-        {140, 234, 187, 328},
-        {144, 238, 191, 332},
-        {148, 242, 195, 336},
-        {152, 246, 199, 340},
-        {156, 250, 203, 344},
-        {160, 254, 207, 348},
-        {164, 258, 211, 352},
-        {168, 262, 215, 356},
-        {172, 266, 219, 360},
-        {176, 270, 223, 364},
-        {180, 274, 227, 368},
-        {184, 278, 231, 372},
-        {188, 282, 235, 376},
-        {192, 286, 239, 380},
-        {196, 290, 243, 384},
-        {200, 294, 247, 388},
-        {204, 298, 251, 392},
-        {208, 302, 255, 396},
-        {212, 306, 259, 400},
-        {216, 310, 263, 404},
-        {220, 314, 267, 408},
-        {224, 318, 271, 412},
-        {228, 322, 275, 416},
-        {232, 326, 279, 420},
-        {236, 330, 283, 424},
-        {240, 334, 287, 428},
-        {244, 338, 291, 432},
-        {248, 342, 295, 436},
-        {252, 346, 299, 440},
-    },
-    { /* blk_fnum=111 */
-        {0, 96, 48, 192},
-        {4, 100, 52, 196},
-        {8, 104, 56, 200},
-        {12, 108, 60, 204},
-        {16, 112, 64, 208},
-        {20, 116, 68, 212},
-        {24, 120, 72, 216},
-        {28, 124, 76, 220},
-        {32, 128, 80, 224},
-        {36, 132, 84, 228},
-        {40, 136, 88, 232},
-        {44, 140, 92, 236},
-        {48, 144, 96, 240},
-        {52, 148, 100, 244},
-        {56, 152, 104, 248},
-        {60, 156, 108, 252},
-        {64, 160, 112, 256},
-        {68, 164, 116, 260},
-        {72, 168, 120, 264},
-        {76, 172, 124, 268},
-        {80, 176, 128, 272},
-        {84, 180, 132, 276},
-        {88, 184, 136, 280},
-        {92, 188, 140, 284},
-        {96, 192, 144, 288},
-        {100, 196, 148, 292},
-        {104, 200, 152, 296},
-        {108, 204, 156, 300},
-        {112, 208, 160, 304},
-        {116, 212, 164, 308},
-        {120, 216, 168, 312},
-        {124, 220, 172, 316},
-        {128, 224, 176, 320},
-        {132, 228, 180, 324},
-        {136, 232, 184, 328},
-        {140, 236, 188, 332},
-        {144, 240, 192, 336},
-        {148, 244, 196, 340},
-        {152, 248, 200, 344},
-        {156, 252, 204, 348},
-        {160, 256, 208, 352},
-        {164, 260, 212, 356},
-        {168, 264, 216, 360},
-        {172, 268, 220, 364},
-        {176, 272, 224, 368},
-        {180, 276, 228, 372},
-        {184, 280, 232, 376},
-        {188, 284, 236, 380},
-        {192, 288, 240, 384},
-        {196, 292, 244, 388},
-        {200, 296, 248, 392},
-        {204, 300, 252, 396},
-        {208, 304, 256, 400},
-        {212, 308, 260, 404},
-        {216, 312, 264, 408},
-        {220, 316, 268, 412},
-        {224, 320, 272, 416},
-        {228, 324, 276, 420},
-        {232, 328, 280, 424},
-        {236, 332, 284, 428},
-        {240, 336, 288, 432},
-        {244, 340, 292, 436},
-        {248, 344, 296, 440},
-        {252, 348, 300, 444},
-    },
-    { /* blk_fnum=112 */
-        {0, 0, 0, 0},
-        {4, 4, 4, 4},
-        {8, 8, 8, 8},
-        {12, 12, 12, 12},
-        {16, 16, 16, 16},
-        {20, 20, 20, 20},
-        {24, 24, 24, 24},
-        {28, 28, 28, 28},
-        {32, 32, 32, 32},
-        {36, 36, 36, 36},
-        {40, 40, 40, 40},
-        {44, 44, 44, 44},
-        {48, 48, 48, 48},
-        {52, 52, 52, 52},
-        {56, 56, 56, 56},
-        {60, 60, 60, 60},
-        {64, 64, 64, 64},
-        {68, 68, 68, 68},
-        {72, 72, 72, 72},
-        {76, 76, 76, 76},
-        {80, 80, 80, 80},
-        {84, 84, 84, 84},
-        {88, 88, 88, 88},
-        {92, 92, 92, 92},
-        {96, 96, 96, 96},
-        {100, 100, 100, 100},
-        {104, 104, 104, 104},
-        {108, 108, 108, 108},
-        {112, 112, 112, 112},
-        {116, 116, 116, 116},
-        {120, 120, 120, 120},
-        {124, 124, 124, 124},
-        {128, 128, 128, 128},
-        {132, 132, 132, 132},
-        {136, 136, 136, 136},
-        {140, 140, 140, 140},
-        {144, 144, 144, 144},
-        {148, 148, 148, 148},
-        {152, 152, 152, 152},
-        {156, 156, 156, 156},
-        {160, 160, 160, 160},
-        {164, 164, 164, 164},
-        {168, 168, 168, 168},
-        {172, 172, 172, 172},
-        {176, 176, 176, 176},
-        {180, 180, 180, 180},
-        {184, 184, 184, 184},
-        {188, 188, 188, 188},
-        {192, 192, 192, 192},
-        {196, 196, 196, 196},
-        {200, 200, 200, 200},
-        {204, 204, 204, 204},
-        {208, 208, 208, 208},
-        {212, 212, 212, 212},
-        {216, 216, 216, 216},
-        {220, 220, 220, 220},
-        {224, 224, 224, 224},
-        {228, 228, 228, 228},
-        {232, 232, 232, 232},
-        {236, 236, 236, 236},
-        {240, 240, 240, 240},
-        {244, 244, 244, 244},
-        {248, 248, 248, 248},
-        {252, 252, 252, 252},
-    },
-    { /* blk_fnum=113 */
-        {0, 48, 24, 96},
-        {4, 52, 28, 100},
-        {8, 56, 32, 104},
-        {12, 60, 36, 108},
-        {16, 64, 40, 112},
-        {20, 68, 44, 116},
-        {24, 72, 48, 120},
-        {28, 76, 52, 124},
-        {32, 80, 56, 128},
-        {36, 84, 60, 132},
-        {40, 88, 64, 136},
-        {44, 92, 68, 140},
-        {48, 96, 72, 144},
-        {52, 100, 76, 148},
-        {56, 104, 80, 152},
-        {60, 108, 84, 156},
-        {64, 112, 88, 160},
-        {68, 116, 92, 164},
-        {72, 120, 96, 168},
-        {76, 124, 100, 172},
-        {80, 128, 104, 176},
-        {84, 132, 108, 180},
-        {88, 136, 112, 184},
-        {92, 140, 116, 188},
-        {96, 144, 120, 192},
-        {100, 148, 124, 196},
-        {104, 152, 128, 200},
-        {108, 156, 132, 204},
-        {112, 160, 136, 208},
-        {116, 164, 140, 212},
-        {120, 168, 144, 216},
-        {124, 172, 148, 220},
-        {128, 176, 152, 224},
-        {132, 180, 156, 228},
-        {136, 184, 160, 232},
-        {140, 188, 164, 236},
-        {144, 192, 168, 240},
-        {148, 196, 172, 244},
-        {152, 200, 176, 248},
-        {156, 204, 180, 252},
-        {160, 208, 184, 256},
-        {164, 212, 188, 260},
-        {168, 216, 192, 264},
-        {172, 220, 196, 268},
-        {176, 224, 200, 272},
-        {180, 228, 204, 276},
-        {184, 232, 208, 280},
-        {188, 236, 212, 284},
-        {192, 240, 216, 288},
-        {196, 244, 220, 292},
-        {200, 248, 224, 296},
-        {204, 252, 228, 300},
-        {208, 256, 232, 304},
-        {212, 260, 236, 308},
-        {216, 264, 240, 312},
-        {220, 268, 244, 316},
-        {224, 272, 248, 320},
-        {228, 276, 252, 324},
-        {232, 280, 256, 328},
-        {236, 284, 260, 332},
-        {240, 288, 264, 336},
-        {244, 292, 268, 340},
-        {248, 296, 272, 344},
-        {252, 300, 276, 348},
-    },
-    { /* blk_fnum=114 */
-        {0, 64, 32, 128},
-        {4, 68, 36, 132},
-        {8, 72, 40, 136},
-        {12, 76, 44, 140},
-        {16, 80, 48, 144},
-        {20, 84, 52, 148},
-        {24, 88, 56, 152},
-        {28, 92, 60, 156},
-        {32, 96, 64, 160},
-        {36, 100, 68, 164},
-        {40, 104, 72, 168},
-        {44, 108, 76, 172},
-        {48, 112, 80, 176},
-        {52, 116, 84, 180},
-        {56, 120, 88, 184},
-        {60, 124, 92, 188},
-        {64, 128, 96, 192},
-        {68, 132, 100, 196},
-        {72, 136, 104, 200},
-        {76, 140, 108, 204},
-        {80, 144, 112, 208},
-        {84, 148, 116, 212},
-        {88, 152, 120, 216},
-        {92, 156, 124, 220},
-        {96, 160, 128, 224},
-        {100, 164, 132, 228},
-        {104, 168, 136, 232},
-        {108, 172, 140, 236},
-        {112, 176, 144, 240},
-        {116, 180, 148, 244},
-        {120, 184, 152, 248},
-        {124, 188, 156, 252},
-        {128, 192, 160, 256},
-        {132, 196, 164, 260},
-        {136, 200, 168, 264},
-        {140, 204, 172, 268},
-        {144, 208, 176, 272},
-        {148, 212, 180, 276},
-        {152, 216, 184, 280},
-        {156, 220, 188, 284},
-        {160, 224, 192, 288},
-        {164, 228, 196, 292},
-        {168, 232, 200, 296},
-        {172, 236, 204, 300},
-        {176, 240, 208, 304},
-        {180, 244, 212, 308},
-        {184, 248, 216, 312},
-        {188, 252, 220, 316},
-        {192, 256, 224, 320},
-        {196, 260, 228, 324},
-        {200, 264, 232, 328},
-        {204, 268, 236, 332},
-        {208, 272, 240, 336},
-        {212, 276, 244, 340},
-        {216, 280, 248, 344},
-        {220, 284, 252, 348},
-        {224, 288, 256, 352},
-        {228, 292, 260, 356},
-        {232, 296, 264, 360},
-        {236, 300, 268, 364},
-        {240, 304, 272, 368},
-        {244, 308, 276, 372},
-        {248, 312, 280, 376},
-        {252, 316, 284, 380},
-    },
-    { /* blk_fnum=115 */
-        {0, 74, 37, 148},
-        {4, 78, 41, 152},
-        {8, 82, 45, 156},
-        {12, 86, 49, 160},
-        {16, 90, 53, 164},
-        {20, 94, 57, 168},
-        {24, 98, 61, 172},
-        {28, 102, 65, 176},
-        {32, 106, 69, 180},
-        {36, 110, 73, 184},
-        {40, 114, 77, 188},
-        {44, 118, 81, 192},
-        {48, 122, 85, 196},
-        {52, 126, 89, 200},
-        {56, 130, 93, 204},
-        {60, 134, 97, 208},
-        {64, 138, 101, 212},
-        {68, 142, 105, 216},
-        {72, 146, 109, 220},
-        {76, 150, 113, 224},
-        {80, 154, 117, 228},
-        {84, 158, 121, 232},
-        {88, 162, 125, 236},
-        {92, 166, 129, 240},
-        {96, 170, 133, 244},
-        {100, 174, 137, 248},
-        {104, 178, 141, 252},
-        {108, 182, 145, 256},
-        {112, 186, 149, 260},
-        {116, 190, 153, 264},
-        {120, 194, 157, 268},
-        {124, 198, 161, 272},
-        {128, 202, 165, 276},
-        {132, 206, 169, 280},
-        {136, 210, 173, 284},
-        {140, 214, 177, 288},
-        {144, 218, 181, 292},
-        {148, 222, 185, 296},
-        {152, 226, 189, 300},
-        {156, 230, 193, 304},
-        {160, 234, 197, 308},
-        {164, 238, 201, 312},
-        {168, 242, 205, 316},
-        {172, 246, 209, 320},
-        {176, 250, 213, 324},
-        {180, 254, 217, 328},
-        {184, 258, 221, 332},
-        {188, 262, 225, 336},
-        {192, 266, 229, 340},
-        {196, 270, 233, 344},
-        {200, 274, 237, 348},
-        {204, 278, 241, 352},
-        {208, 282, 245, 356},
-        {212, 286, 249, 360},
-        {216, 290, 253, 364},
-        {220, 294, 257, 368},
-        {224, 298, 261, 372},
-        {228, 302, 265, 376},
-        {232, 306, 269, 380},
-        {236, 310, 273, 384},
-        {240, 314, 277, 388},
-        {244, 318, 281, 392},
-        {248, 322, 285, 396},
-        {252, 326, 289, 400},
-    },
-    { /* blk_fnum=116 */
-        {0, 80, 40, 160},
-        {4, 84, 44, 164},
-        {8, 88, 48, 168},
-        {12, 92, 52, 172},
-        {16, 96, 56, 176},
-        {20, 100, 60, 180},
-        {24, 104, 64, 184},
-        {28, 108, 68, 188},
-        {32, 112, 72, 192},
-        {36, 116, 76, 196},
-        {40, 120, 80, 200},
-        {44, 124, 84, 204},
-        {48, 128, 88, 208},
-        {52, 132, 92, 212},
-        {56, 136, 96, 216},
-        {60, 140, 100, 220},
-        {64, 144, 104, 224},
-        {68, 148, 108, 228},
-        {72, 152, 112, 232},
-        {76, 156, 116, 236},
-        {80, 160, 120, 240},
-        {84, 164, 124, 244},
-        {88, 168, 128, 248},
-        {92, 172, 132, 252},
-        {96, 176, 136, 256},
-        {100, 180, 140, 260},
-        {104, 184, 144, 264},
-        {108, 188, 148, 268},
-        {112, 192, 152, 272},
-        {116, 196, 156, 276},
-        {120, 200, 160, 280},
-        {124, 204, 164, 284},
-        {128, 208, 168, 288},
-        {132, 212, 172, 292},
-        {136, 216, 176, 296},
-        {140, 220, 180, 300},
-        {144, 224, 184, 304},
-        {148, 228, 188, 308},
-        {152, 232, 192, 312},
-        {156, 236, 196, 316},
-        {160, 240, 200, 320},
-        {164, 244, 204, 324},
-        {168, 248, 208, 328},
-        {172, 252, 212, 332},
-        {176, 256, 216, 336},
-        {180, 260, 220, 340},
-        {184, 264, 224, 344},
-        {188, 268, 228, 348},
-        {192, 272, 232, 352},
-        {196, 276, 236, 356},
-        {200, 280, 240, 360},
-        {204, 284, 244, 364},
-        {208, 288, 248, 368},
-        {212, 292, 252, 372},
-        {216, 296, 256, 376},
-        {220, 300, 260, 380},
-        {224, 304, 264, 384},
-        {228, 308, 268, 388},
-        {232, 312, 272, 392},
-        {236, 316, 276, 396},
-        {240, 320, 280, 400},
-        {244, 324, 284, 404},
-        {248, 328, 288, 408},
-        {252, 332, 292, 412},
-    },
-    { /* blk_fnum=117 */
-        {0, 86, 43, 172},
-        {4, 90, 47, 176},
-        {8, 94, 51, 180},
-        {12, 98, 55, 184},
-        {16, 102, 59, 188},
-        {20, 106, 63, 192},
-        {24, 110, 67, 196},
-        {28, 114, 71, 200},
-        {32, 118, 75, 204},
-        {36, 122, 79, 208},
-        {40, 126, 83, 212},
-        {44, 130, 87, 216},
-        {48, 134, 91, 220},
-        {52, 138, 95, 224},
-        {56, 142, 99, 228},
-        {60, 146, 103, 232},
-        {64, 150, 107, 236},
-        {68, 154, 111, 240},
-        {72, 158, 115, 244},
-        {76, 162, 119, 248},
-        {80, 166, 123, 252},
-        {84, 170, 127, 256},
-        {88, 174, 131, 260},
-        {92, 178, 135, 264},
-        {96, 182, 139, 268},
-        {100, 186, 143, 272},
-        {104, 190, 147, 276},
-        {108, 194, 151, 280},
-        {112, 198, 155, 284},
-        {116, 202, 159, 288},
-        {120, 206, 163, 292},
-        {124, 210, 167, 296},
-        {128, 214, 171, 300},
-        {132, 218, 175, 304},
-        {136, 222, 179, 308},
-        {140, 226, 183, 312},
-        {144, 230, 187, 316},
-        {148, 234, 191, 320},
-        {152, 238, 195, 324},
-        {156, 242, 199, 328},
-        {160, 246, 203, 332},
-        {164, 250, 207, 336},
-        {168, 254, 211, 340},
-        {172, 258, 215, 344},
-        {176, 262, 219, 348},
-        {180, 266, 223, 352},
-        {184, 270, 227, 356},
-        {188, 274, 231, 360},
-        {192, 278, 235, 364},
-        {196, 282, 239, 368},
-        {200, 286, 243, 372},
-        {204, 290, 247, 376},
-        {208, 294, 251, 380},
-        {212, 298, 255, 384},
-        {216, 302, 259, 388},
-        {220, 306, 263, 392},
-        {224, 310, 267, 396},
-        {228, 314, 271, 400},
-        {232, 318, 275, 404},
-        {236, 322, 279, 408},
-        {240, 326, 283, 412},
-        {244, 330, 287, 416},
-        {248, 334, 291, 420},
-        {252, 338, 295, 424},
-    },
-    { /* blk_fnum=118 */
-        {0, 90, 45, 180},
-        {4, 94, 49, 184},
-        {8, 98, 53, 188},
-        {12, 102, 57, 192},
-        {16, 106, 61, 196},
-        {20, 110, 65, 200},
-        {24, 114, 69, 204},
-        {28, 118, 73, 208},
-        {32, 122, 77, 212},
-        {36, 126, 81, 216},
-        {40, 130, 85, 220},
-        {44, 134, 89, 224},
-        {48, 138, 93, 228},
-        {52, 142, 97, 232},
-        {56, 146, 101, 236},
-        {60, 150, 105, 240},
-        {64, 154, 109, 244},
-        {68, 158, 113, 248},
-        {72, 162, 117, 252},
-        {76, 166, 121, 256},
-        {80, 170, 125, 260},
-        {84, 174, 129, 264},
-        {88, 178, 133, 268},
-        {92, 182, 137, 272},
-        {96, 186, 141, 276},
-        {100, 190, 145, 280},
-        {104, 194, 149, 284},
-        {108, 198, 153, 288},
-        {112, 202, 157, 292},
-        {116, 206, 161, 296},
-        {120, 210, 165, 300},
-        {124, 214, 169, 304},
-        {128, 218, 173, 308},
-        {132, 222, 177, 312},
-        {136, 226, 181, 316},
-        {140, 230, 185, 320},
-        {144, 234, 189, 324},
-        {148, 238, 193, 328},
-        {152, 242, 197, 332},
-        {156, 246, 201, 336},
-        {160, 250, 205, 340},
-        {164, 254, 209, 344},
-        {168, 258, 213, 348},
-        {172, 262, 217, 352},
-        {176, 266, 221, 356},
-        {180, 270, 225, 360},
-        {184, 274, 229, 364},
-        {188, 278, 233, 368},
-        {192, 282, 237, 372},
-        {196, 286, 241, 376},
-        {200, 290, 245, 380},
-        {204, 294, 249, 384},
-        {208, 298, 253, 388},
-        {212, 302, 257, 392},
-        {216, 306, 261, 396},
-        {220, 310, 265, 400},
-        {224, 314, 269, 404},
-        {228, 318, 273, 408},
-        {232, 322, 277, 412},
-        {236, 326, 281, 416},
-        {240, 330, 285, 420},
-        {244, 334, 289, 424},
-        {248, 338, 293, 428},
-        {252, 342, 297, 432},
-    },
-    { /* blk_fnum=119 */
-        {0, 94, 47, 188},
-        {4, 98, 51, 192},
-        {8, 102, 55, 196},
-        {12, 106, 59, 200},
-        {16, 110, 63, 204},
-        {20, 114, 67, 208},
-        {24, 118, 71, 212},
-        {28, 122, 75, 216},
-        {32, 126, 79, 220},
-        {36, 130, 83, 224},
-        {40, 134, 87, 228},
-        {44, 138, 91, 232},
-        {48, 142, 95, 236},
-        {52, 146, 99, 240},
-        {56, 150, 103, 244},
-        {60, 154, 107, 248},
-        {64, 158, 111, 252},
-        {68, 162, 115, 256},
-        {72, 166, 119, 260},
-        {76, 170, 123, 264},
-        {80, 174, 127, 268},
-        {84, 178, 131, 272},
-        {88, 182, 135, 276},
-        {92, 186, 139, 280},
-        {96, 190, 143, 284},
-        {100, 194, 147, 288},
-        {104, 198, 151, 292},
-        {108, 202, 155, 296},
-        {112, 206, 159, 300},
-        {116, 210, 163, 304},
-        {120, 214, 167, 308},
-        {124, 218, 171, 312},
-        {128, 222, 175, 316},
-        {132, 226, 179, 320},
-        {136, 230, 183, 324},
-        {140, 234, 187, 328},
-        {144, 238, 191, 332},
-        {148, 242, 195, 336},
-        {152, 246, 199, 340},
-        {156, 250, 203, 344},
-        {160, 254, 207, 348},
-        {164, 258, 211, 352},
-        {168, 262, 215, 356},
-        {172, 266, 219, 360},
-        {176, 270, 223, 364},
-        {180, 274, 227, 368},
-        {184, 278, 231, 372},
-        {188, 282, 235, 376},
-        {192, 286, 239, 380},
-        {196, 290, 243, 384},
-        {200, 294, 247, 388},
-        {204, 298, 251, 392},
-        {208, 302, 255, 396},
-        {212, 306, 259, 400},
-        {216, 310, 263, 404},
-        {220, 314, 267, 408},
-        {224, 318, 271, 412},
-        {228, 322, 275, 416},
-        {232, 326, 279, 420},
-        {236, 330, 283, 424},
-        {240, 334, 287, 428},
-        {244, 338, 291, 432},
-        {248, 342, 295, 436},
-        {252, 346, 299, 440},
-    },
-    { /* blk_fnum=120 */
-        {0, 96, 48, 192},
-        {4, 100, 52, 196},
-        {8, 104, 56, 200},
-        {12, 108, 60, 204},
-        {16, 112, 64, 208},
-        {20, 116, 68, 212},
-        {24, 120, 72, 216},
-        {28, 124, 76, 220},
-        {32, 128, 80, 224},
-        {36, 132, 84, 228},
-        {40, 136, 88, 232},
-        {44, 140, 92, 236},
-        {48, 144, 96, 240},
-        {52, 148, 100, 244},
-        {56, 152, 104, 248},
-        {60, 156, 108, 252},
-        {64, 160, 112, 256},
-        {68, 164, 116, 260},
-        {72, 168, 120, 264},
-        {76, 172, 124, 268},
-        {80, 176, 128, 272},
-        {84, 180, 132, 276},
-        {88, 184, 136, 280},
-        {92, 188, 140, 284},
-        {96, 192, 144, 288},
-        {100, 196, 148, 292},
-        {104, 200, 152, 296},
-        {108, 204, 156, 300},
-        {112, 208, 160, 304},
-        {116, 212, 164, 308},
-        {120, 216, 168, 312},
-        {124, 220, 172, 316},
-        {128, 224, 176, 320},
-        {132, 228, 180, 324},
-        {136, 232, 184, 328},
-        {140, 236, 188, 332},
-        {144, 240, 192, 336},
-        {148, 244, 196, 340},
-        {152, 248, 200, 344},
-        {156, 252, 204, 348},
-        {160, 256, 208, 352},
-        {164, 260, 212, 356},
-        {168, 264, 216, 360},
-        {172, 268, 220, 364},
-        {176, 272, 224, 368},
-        {180, 276, 228, 372},
-        {184, 280, 232, 376},
-        {188, 284, 236, 380},
-        {192, 288, 240, 384},
-        {196, 292, 244, 388},
-        {200, 296, 248, 392},
-        {204, 300, 252, 396},
-        {208, 304, 256, 400},
-        {212, 308, 260, 404},
-        {216, 312, 264, 408},
-        {220, 316, 268, 412},
-        {224, 320, 272, 416},
-        {228, 324, 276, 420},
-        {232, 328, 280, 424},
-        {236, 332, 284, 428},
-        {240, 336, 288, 432},
-        {244, 340, 292, 436},
-        {248, 344, 296, 440},
-        {252, 348, 300, 444},
-    },
-    { /* blk_fnum=121 */
-        {0, 100, 50, 200},
-        {4, 104, 54, 204},
-        {8, 108, 58, 208},
-        {12, 112, 62, 212},
-        {16, 116, 66, 216},
-        {20, 120, 70, 220},
-        {24, 124, 74, 224},
-        {28, 128, 78, 228},
-        {32, 132, 82, 232},
-        {36, 136, 86, 236},
-        {40, 140, 90, 240},
-        {44, 144, 94, 244},
-        {48, 148, 98, 248},
-        {52, 152, 102, 252},
-        {56, 156, 106, 256},
-        {60, 160, 110, 260},
-        {64, 164, 114, 264},
-        {68, 168, 118, 268},
-        {72, 172, 122, 272},
-        {76, 176, 126, 276},
-        {80, 180, 130, 280},
-        {84, 184, 134, 284},
-        {88, 188, 138, 288},
-        {92, 192, 142, 292},
-        {96, 196, 146, 296},
-        {100, 200, 150, 300},
-        {104, 204, 154, 304},
-        {108, 208, 158, 308},
-        {112, 212, 162, 312},
-        {116, 216, 166, 316},
-        {120, 220, 170, 320},
-        {124, 224, 174, 324},
-        {128, 228, 178, 328},
-        {132, 232, 182, 332},
-        {136, 236, 186, 336},
-        {140, 240, 190, 340},
-        {144, 244, 194, 344},
-        {148, 248, 198, 348},
-        {152, 252, 202, 352},
-        {156, 256, 206, 356},
-        {160, 260, 210, 360},
-        {164, 264, 214, 364},
-        {168, 268, 218, 368},
-        {172, 272, 222, 372},
-        {176, 276, 226, 376},
-        {180, 280, 230, 380},
-        {184, 284, 234, 384},
-        {188, 288, 238, 388},
-        {192, 292, 242, 392},
-        {196, 296, 246, 396},
-        {200, 300, 250, 400},
-        {204, 304, 254, 404},
-        {208, 308, 258, 408},
-        {212, 312, 262, 412},
-        {216, 316, 266, 416},
-        {220, 320, 270, 420},
-        {224, 324, 274, 424},
-        {228, 328, 278, 428},
-        {232, 332, 282, 432},
-        {236, 336, 286, 436},
-        {240, 340, 290, 440},
-        {244, 344, 294, 444},
-        {248, 348, 298, 448},
-        {252, 352, 302, 452},
-    },
-    { /* blk_fnum=122 */
-        {0, 102, 51, 204},
-        {4, 106, 55, 208},
-        {8, 110, 59, 212},
-        {12, 114, 63, 216},
-        {16, 118, 67, 220},
-        {20, 122, 71, 224},
-        {24, 126, 75, 228},
-        {28, 130, 79, 232},
-        {32, 134, 83, 236},
-        {36, 138, 87, 240},
-        {40, 142, 91, 244},
-        {44, 146, 95, 248},
-        {48, 150, 99, 252},
-        {52, 154, 103, 256},
-        {56, 158, 107, 260},
-        {60, 162, 111, 264},
-        {64, 166, 115, 268},
-        {68, 170, 119, 272},
-        {72, 174, 123, 276},
-        {76, 178, 127, 280},
-        {80, 182, 131, 284},
-        {84, 186, 135, 288},
-        {88, 190, 139, 292},
-        {92, 194, 143, 296},
-        {96, 198, 147, 300},
-        {100, 202, 151, 304},
-        {104, 206, 155, 308},
-        {108, 210, 159, 312},
-        {112, 214, 163, 316},
-        {116, 218, 167, 320},
-        {120, 222, 171, 324},
-        {124, 226, 175, 328},
-        {128, 230, 179, 332},
-        {132, 234, 183, 336},
-        {136, 238, 187, 340},
-        {140, 242, 191, 344},
-        {144, 246, 195, 348},
-        {148, 250, 199, 352},
-        {152, 254, 203, 356},
-        {156, 258, 207, 360},
-        {160, 262, 211, 364},
-        {164, 266, 215, 368},
-        {168, 270, 219, 372},
-        {172, 274, 223, 376},
-        {176, 278, 227, 380},
-        {180, 282, 231, 384},
-        {184, 286, 235, 388},
-        {188, 290, 239, 392},
-        {192, 294, 243, 396},
-        {196, 298, 247, 400},
-        {200, 302, 251, 404},
-        {204, 306, 255, 408},
-        {208, 310, 259, 412},
-        {212, 314, 263, 416},
-        {216, 318, 267, 420},
-        {220, 322, 271, 424},
-        {224, 326, 275, 428},
-        {228, 330, 279, 432},
-        {232, 334, 283, 436},
-        {236, 338, 287, 440},
-        {240, 342, 291, 444},
-        {244, 346, 295, 448},
-        {248, 350, 299, 452},
-        {252, 354, 303, 456},
-    },
-    { /* blk_fnum=123 */
-        {0, 104, 52, 208},
-        {4, 108, 56, 212},
-        {8, 112, 60, 216},
-        {12, 116, 64, 220},
-        {16, 120, 68, 224},
-        {20, 124, 72, 228},
-        {24, 128, 76, 232},
-        {28, 132, 80, 236},
-        {32, 136, 84, 240},
-        {36, 140, 88, 244},
-        {40, 144, 92, 248},
-        {44, 148, 96, 252},
-        {48, 152, 100, 256},
-        {52, 156, 104, 260},
-        {56, 160, 108, 264},
-        {60, 164, 112, 268},
-        {64, 168, 116, 272},
-        {68, 172, 120, 276},
-        {72, 176, 124, 280},
-        {76, 180, 128, 284},
-        {80, 184, 132, 288},
-        {84, 188, 136, 292},
-        {88, 192, 140, 296},
-        {92, 196, 144, 300},
-        {96, 200, 148, 304},
-        {100, 204, 152, 308},
-        {104, 208, 156, 312},
-        {108, 212, 160, 316},
-        {112, 216, 164, 320},
-        {116, 220, 168, 324},
-        {120, 224, 172, 328},
-        {124, 228, 176, 332},
-        {128, 232, 180, 336},
-        {132, 236, 184, 340},
-        {136, 240, 188, 344},
-        {140, 244, 192, 348},
-        {144, 248, 196, 352},
-        {148, 252, 200, 356},
-        {152, 256, 204, 360},
-        {156, 260, 208, 364},
-        {160, 264, 212, 368},
-        {164, 268, 216, 372},
-        {168, 272, 220, 376},
-        {172, 276, 224, 380},
-        {176, 280, 228, 384},
-        {180, 284, 232, 388},
-        {184, 288, 236, 392},
-        {188, 292, 240, 396},
-        {192, 296, 244, 400},
-        {196, 300, 248, 404},
-        {200, 304, 252, 408},
-        {204, 308, 256, 412},
-        {208, 312, 260, 416},
-        {212, 316, 264, 420},
-        {216, 320, 268, 424},
-        {220, 324, 272, 428},
-        {224, 328, 276, 432},
-        {228, 332, 280, 436},
-        {232, 336, 284, 440},
-        {236, 340, 288, 444},
-        {240, 344, 292, 448},
-        {244, 348, 296, 452},
-        {248, 352, 300, 456},
-        {252, 356, 304, 460},
-    },
-    { /* blk_fnum=124 */
-        {0, 106, 53, 212},
-        {4, 110, 57, 216},
-        {8, 114, 61, 220},
-        {12, 118, 65, 224},
-        {16, 122, 69, 228},
-        {20, 126, 73, 232},
-        {24, 130, 77, 236},
-        {28, 134, 81, 240},
-        {32, 138, 85, 244},
-        {36, 142, 89, 248},
-        {40, 146, 93, 252},
-        {44, 150, 97, 256},
-        {48, 154, 101, 260},
-        {52, 158, 105, 264},
-        {56, 162, 109, 268},
-        {60, 166, 113, 272},
-        {64, 170, 117, 276},
-        {68, 174, 121, 280},
-        {72, 178, 125, 284},
-        {76, 182, 129, 288},
-        {80, 186, 133, 292},
-        {84, 190, 137, 296},
-        {88, 194, 141, 300},
-        {92, 198, 145, 304},
-        {96, 202, 149, 308},
-        {100, 206, 153, 312},
-        {104, 210, 157, 316},
-        {108, 214, 161, 320},
-        {112, 218, 165, 324},
-        {116, 222, 169, 328},
-        {120, 226, 173, 332},
-        {124, 230, 177, 336},
-        {128, 234, 181, 340},
-        {132, 238, 185, 344},
-        {136, 242, 189, 348},
-        {140, 246, 193, 352},
-        {144, 250, 197, 356},
-        {148, 254, 201, 360},
-        {152, 258, 205, 364},
-        {156, 262, 209, 368},
-        {160, 266, 213, 372},
-        {164, 270, 217, 376},
-        {168, 274, 221, 380},
-        {172, 278, 225, 384},
-        {176, 282, 229, 388},
-        {180, 286, 233, 392},
-        {184, 290, 237, 396},
-        {188, 294, 241, 400},
-        {192, 298, 245, 404},
-        {196, 302, 249, 408},
-        {200, 306, 253, 412},
-        {204, 310, 257, 416},
-        {208, 314, 261, 420},
-        {212, 318, 265, 424},
-        {216, 322, 269, 428},
-        {220, 326, 273, 432},
-        {224, 330, 277, 436},
-        {228, 334, 281, 440},
-        {232, 338, 285, 444},
-        {236, 342, 289, 448},
-        {240, 346, 293, 452},
-        {244, 350, 297, 456},
-        {248, 354, 301, 460},
-        {252, 358, 305, 464},
-    },
-    { /* blk_fnum=125 */
-        {0, 108, 54, 216},
-        {4, 112, 58, 220},
-        {8, 116, 62, 224},
-        {12, 120, 66, 228},
-        {16, 124, 70, 232},
-        {20, 128, 74, 236},
-        {24, 132, 78, 240},
-        {28, 136, 82, 244},
-        {32, 140, 86, 248},
-        {36, 144, 90, 252},
-        {40, 148, 94, 256},
-        {44, 152, 98, 260},
-        {48, 156, 102, 264},
-        {52, 160, 106, 268},
-        {56, 164, 110, 272},
-        {60, 168, 114, 276},
-        {64, 172, 118, 280},
-        {68, 176, 122, 284},
-        {72, 180, 126, 288},
-        {76, 184, 130, 292},
-        {80, 188, 134, 296},
-        {84, 192, 138, 300},
-        {88, 196, 142, 304},
-        {92, 200, 146, 308},
-        {96, 204, 150, 312},
-        {100, 208, 154, 316},
-        {104, 212, 158, 320},
-        {108, 216, 162, 324},
-        {112, 220, 166, 328},
-        {116, 224, 170, 332},
-        {120, 228, 174, 336},
-        {124, 232, 178, 340},
-        {128, 236, 182, 344},
-        {132, 240, 186, 348},
-        {136, 244, 190, 352},
-        {140, 248, 194, 356},
-        {144, 252, 198, 360},
-        {148, 256, 202, 364},
-        {152, 260, 206, 368},
-        {156, 264, 210, 372},
-        {160, 268, 214, 376},
-        {164, 272, 218, 380},
-        {168, 276, 222, 384},
-        {172, 280, 226, 388},
-        {176, 284, 230, 392},
-        {180, 288, 234, 396},
-        {184, 292, 238, 400},
-        {188, 296, 242, 404},
-        {192, 300, 246, 408},
-        {196, 304, 250, 412},
-        {200, 308, 254, 416},
-        {204, 312, 258, 420},
-        {208, 316, 262, 424},
-        {212, 320, 266, 428},
-        {216, 324, 270, 432},
-        {220, 328, 274, 436},
-        {224, 332, 278, 440},
-        {228, 336, 282, 444},
-        {232, 340, 286, 448},
-        {236, 344, 290, 452},
-        {240, 348, 294, 456},
-        {244, 352, 298, 460},
-        {248, 356, 302, 464},
-        {252, 360, 306, 468},
-    },
-    { /* blk_fnum=126 */
-        {0, 110, 55, 220},
-        {4, 114, 59, 224},
-        {8, 118, 63, 228},
-        {12, 122, 67, 232},
-        {16, 126, 71, 236},
-        {20, 130, 75, 240},
-        {24, 134, 79, 244},
-        {28, 138, 83, 248},
-        {32, 142, 87, 252},
-        {36, 146, 91, 256},
-        {40, 150, 95, 260},
-        {44, 154, 99, 264},
-        {48, 158, 103, 268},
-        {52, 162, 107, 272},
-        {56, 166, 111, 276},
-        {60, 170, 115, 280},
-        {64, 174, 119, 284},
-        {68, 178, 123, 288},
-        {72, 182, 127, 292},
-        {76, 186, 131, 296},
-        {80, 190, 135, 300},
-        {84, 194, 139, 304},
-        {88, 198, 143, 308},
-        {92, 202, 147, 312},
-        {96, 206, 151, 316},
-        {100, 210, 155, 320},
-        {104, 214, 159, 324},
-        {108, 218, 163, 328},
-        {112, 222, 167, 332},
-        {116, 226, 171, 336},
-        {120, 230, 175, 340},
-        {124, 234, 179, 344},
-        {128, 238, 183, 348},
-        {132, 242, 187, 352},
-        {136, 246, 191, 356},
-        {140, 250, 195, 360},
-        {144, 254, 199, 364},
-        {148, 258, 203, 368},
-        {152, 262, 207, 372},
-        {156, 266, 211, 376},
-        {160, 270, 215, 380},
-        {164, 274, 219, 384},
-        {168, 278, 223, 388},
-        {172, 282, 227, 392},
-        {176, 286, 231, 396},
-        {180, 290, 235, 400},
-        {184, 294, 239, 404},
-        {188, 298, 243, 408},
-        {192, 302, 247, 412},
-        {196, 306, 251, 416},
-        {200, 310, 255, 420},
-        {204, 314, 259, 424},
-        {208, 318, 263, 428},
-        {212, 322, 267, 432},
-        {216, 326, 271, 436},
-        {220, 330, 275, 440},
-        {224, 334, 279, 444},
-        {228, 338, 283, 448},
-        {232, 342, 287, 452},
-        {236, 346, 291, 456},
-        {240, 350, 295, 460},
-        {244, 354, 299, 464},
-        {248, 358, 303, 468},
-        {252, 362, 307, 472},
-    },
-    { /* blk_fnum=127 */
-        {0, 112, 56, 224},
-        {4, 116, 60, 228},
-        {8, 120, 64, 232},
-        {12, 124, 68, 236},
-        {16, 128, 72, 240},
-        {20, 132, 76, 244},
-        {24, 136, 80, 248},
-        {28, 140, 84, 252},
-        {32, 144, 88, 256},
-        {36, 148, 92, 260},
-        {40, 152, 96, 264},
-        {44, 156, 100, 268},
-        {48, 160, 104, 272},
-        {52, 164, 108, 276},
-        {56, 168, 112, 280},
-        {60, 172, 116, 284},
-        {64, 176, 120, 288},
-        {68, 180, 124, 292},
-        {72, 184, 128, 296},
-        {76, 188, 132, 300},
-        {80, 192, 136, 304},
-        {84, 196, 140, 308},
-        {88, 200, 144, 312},
-        {92, 204, 148, 316},
-        {96, 208, 152, 320},
-        {100, 212, 156, 324},
-        {104, 216, 160, 328},
-        {108, 220, 164, 332},
-        {112, 224, 168, 336},
-        {116, 228, 172, 340},
-        {120, 232, 176, 344},
-        {124, 236, 180, 348},
-        {128, 240, 184, 352},
-        {132, 244, 188, 356},
-        {136, 248, 192, 360},
-        {140, 252, 196, 364},
-        {144, 256, 200, 368},
-        {148, 260, 204, 372},
-        {152, 264, 208, 376},
-        {156, 268, 212, 380},
-        {160, 272, 216, 384},
-        {164, 276, 220, 388},
-        {168, 280, 224, 392},
-        {172, 284, 228, 396},
-        {176, 288, 232, 400},
-        {180, 292, 236, 404},
-        {184, 296, 240, 408},
-        {188, 300, 244, 412},
-        {192, 304, 248, 416},
-        {196, 308, 252, 420},
-        {200, 312, 256, 424},
-        {204, 316, 260, 428},
-        {208, 320, 264, 432},
-        {212, 324, 268, 436},
-        {216, 328, 272, 440},
-        {220, 332, 276, 444},
-        {224, 336, 280, 448},
-        {228, 340, 284, 452},
-        {232, 344, 288, 456},
-        {236, 348, 292, 460},
-        {240, 352, 296, 464},
-        {244, 356, 300, 468},
-        {248, 360, 304, 472},
-        {252, 364, 308, 476},
-    },
-};
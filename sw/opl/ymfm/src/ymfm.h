@@ -47,6 +47,23 @@
 #include <string>
 #include <vector>
 
+// PicoGUS: with OPL_NATIVE_RATE the chip is generated at the 44.1 kHz output
+// rate instead of its native clock/288 (49716 Hz), so chip time advances
+// YMFM_RATE_NUM/YMFM_RATE_DEN ticks per generated sample. Phase steps are
+// scaled by that ratio and envelopes, LFO and noise get an extra tick when due.
+#if OPL_NATIVE_RATE
+#define YMFM_RATE_NUM 49716
+#define YMFM_RATE_DEN 44100
+#endif
+
+// PicoGUS: with YMFM_BLOCK_RENDER the ym3812/ymf262 get a generate_block() that
+// clocks and renders up to YMFM_BLOCK_SIZE samples one channel and operator at
+// a time, with the channel algorithm and left/right routing as template
+// parameters. The result is bit-exact with generate() for outputs 0 and 1.
+#if YMFM_BLOCK_RENDER
+#define YMFM_BLOCK_SIZE 128
+#endif
+
 namespace ymfm
 {
 
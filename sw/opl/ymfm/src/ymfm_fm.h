@@ -78,6 +78,26 @@ struct opdata_cache
 };
 
 
+#if YMFM_BLOCK_RENDER
+// ======================> fm_block_state
+
+// PicoGUS: per-sample engine state for one block of fm_engine_base::
+// clock_output_block(), recorded before the channels are rendered, plus
+// scratch space for the operator outputs of the channel being rendered
+struct fm_block_state
+{
+	uint32_t env_counter[YMFM_BLOCK_SIZE];  // envelope counter passed to clock()
+	int32_t lfo_raw_pm[YMFM_BLOCK_SIZE];    // raw PM LFO value passed to clock()
+	uint16_t am_offset[YMFM_BLOCK_SIZE];    // AM LFO offset seen by the output
+#ifdef YMFM_RATE_NUM
+	uint32_t extra_env_counter[YMFM_BLOCK_SIZE]; // envelope counter of the extra tick
+	uint8_t extra[YMFM_BLOCK_SIZE];         // non-zero if an extra tick follows
+#endif
+	int16_t opout[3][YMFM_BLOCK_SIZE];      // operator 1-3 outputs
+};
+#endif
+
+
 // ======================> fm_registers_base
 
 // base class for family-specific register classes; this provides a few
@@ -190,6 +210,23 @@ public:
 	// master clocking function
 	void clock(uint32_t env_counter, int32_t lfo_raw_pm);
 
+#ifdef YMFM_RATE_NUM
+	// extra envelope-only tick when generating below the native rate
+	void clock_extra(uint32_t env_counter);
+#endif
+
+#if YMFM_BLOCK_RENDER
+	// clock for sample samp of a block
+	void clock_block(fm_block_state const &state, uint32_t samp)
+	{
+		clock(state.env_counter[samp], state.lfo_raw_pm[samp]);
+#ifdef YMFM_RATE_NUM
+		if (state.extra[samp])
+			clock_extra(state.extra_env_counter[samp]);
+#endif
+	}
+#endif
+
 	// return the current phase value
 	uint32_t phase() const { return m_phase >> 10; }
 
@@ -282,6 +319,17 @@ public:
 	// master clocking function
 	void clock(uint32_t env_counter, int32_t lfo_raw_pm);
 
+#ifdef YMFM_RATE_NUM
+	// extra envelope-only tick when generating below the native rate
+	void clock_extra(uint32_t env_counter);
+#endif
+
+#if YMFM_BLOCK_RENDER
+	// clock samples [start, end) of a block and, if active, add the channel
+	// output to left/right (outputs 0 and 1)
+	void output_block(fm_block_state &state, uint32_t start, uint32_t end, bool active, int32_t *left, int32_t *right, uint32_t rshift, int32_t clipmax);
+#endif
+
 	// specific 2-operator and 4-operator output handlers
 	void output_2op(output_data &output, uint32_t rshift, int32_t clipmax) const;
 	void output_4op(output_data &output, uint32_t rshift, int32_t clipmax) const;
@@ -306,6 +354,12 @@ public:
 	fm_operator<RegisterType> *debug_operator(uint32_t index) const { return m_op[index]; }
 
 private:
+#if YMFM_BLOCK_RENDER
+	// block renderer for one algorithm and left/right routing
+	template<uint32_t Algorithm, uint32_t Route>
+	void output_block(fm_block_state &state, uint32_t start, uint32_t end, int32_t *left, int32_t *right, uint32_t rshift, int32_t clipmax);
+#endif
+
 	// helper to add values to the outputs based on channel enables
 	void add_to_output(uint32_t choffs, output_data &output, int32_t value) const
 	{
@@ -375,6 +429,13 @@ public:
 	// compute sum of channel outputs
 	void output(output_data &output, uint32_t rshift, int32_t clipmax, uint32_t chanmask) const;
 
+#if YMFM_BLOCK_RENDER
+	// clock numsamples (at most YMFM_BLOCK_SIZE) samples of all channels and
+	// write the sums of outputs 0 and 1 to left/right; right is unused on
+	// single-output chips
+	void clock_output_block(int32_t *left, int32_t *right, uint32_t numsamples, uint32_t rshift, int32_t clipmax);
+#endif
+
 	// write to the OPN registers
 	void write(uint16_t regnum, uint8_t data);
 
@@ -450,6 +511,12 @@ protected:
 	uint32_t m_active_channels;      // mask of active channels (computed by prepare)
 	uint32_t m_modified_channels;    // mask of channels that have been modified
 	uint32_t m_prepare_count;        // counter to do periodic prepare sweeps
+#ifdef YMFM_RATE_NUM
+	uint32_t m_rate_frac;            // fractional chip ticks owed, in 1/YMFM_RATE_DEN
+#endif
+#if YMFM_BLOCK_RENDER
+	fm_block_state m_block;          // per-sample state of the current block
+#endif
 	RegisterType m_regs;             // register accessor
 	std::unique_ptr<fm_channel<RegisterType>> m_channel[CHANNELS]; // channel pointers
 	std::unique_ptr<fm_operator<RegisterType>> m_operator[OPERATORS]; // operator pointers
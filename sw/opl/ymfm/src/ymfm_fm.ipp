@@ -460,6 +460,25 @@ void fm_operator<RegisterType>::clock(uint32_t env_counter, int32_t lfo_raw_pm)
 }
 
 
+#ifdef YMFM_RATE_NUM
+//-------------------------------------------------
+//  clock_extra - clock the envelope only, for the
+//  extra chip ticks when generating below the
+//  native rate; phase steps are scaled instead
+//-------------------------------------------------
+
+template<class RegisterType>
+void fm_operator<RegisterType>::clock_extra(uint32_t env_counter)
+{
+	if (m_regs.op_ssg_eg_enable(m_opoffs))
+		clock_ssg_eg_state();
+
+	if (bitfield(env_counter, 0, 2) == 0)
+		clock_envelope(env_counter >> 2);
+}
+#endif
+
+
 //-------------------------------------------------
 //  compute_volume - compute the 14-bit signed
 //  volume of this operator, given a phase
@@ -903,6 +922,22 @@ printf(" -- ");
 }
 
 
+#ifdef YMFM_RATE_NUM
+//-------------------------------------------------
+//  clock_extra - envelope-only tick for all of
+//  our operators
+//-------------------------------------------------
+
+template<class RegisterType>
+void fm_channel<RegisterType>::clock_extra(uint32_t env_counter)
+{
+	for (uint32_t opnum = 0; opnum < m_op.size(); opnum++)
+		if (m_op[opnum] != nullptr)
+			m_op[opnum]->clock_extra(env_counter);
+}
+#endif
+
+
 //-------------------------------------------------
 //  output_2op - combine 4 operators according to
 //  the specified algorithm, returning a sum
@@ -1168,6 +1203,194 @@ void fm_channel<RegisterType>::output_rhythm_ch8(uint32_t phase_select, output_d
 
 
 
+#if YMFM_BLOCK_RENDER
+//-------------------------------------------------
+//  output_block - clock samples [start, end) of a
+//  block; if the channel is active, also add its
+//  output to left/right, one operator at a time
+//-------------------------------------------------
+
+template<class RegisterType>
+void fm_channel<RegisterType>::output_block(fm_block_state &state, uint32_t start, uint32_t end, bool active, int32_t *left, int32_t *right, uint32_t rshift, int32_t clipmax)
+{
+	if (!active)
+	{
+		// nothing is output, and the feedback input is left as it is
+		for (uint32_t opnum = 0; opnum < m_op.size(); opnum++)
+			if (m_op[opnum] != nullptr)
+				for (uint32_t samp = start; samp < end; samp++)
+					m_op[opnum]->clock_block(state, samp);
+		for (uint32_t samp = start; samp < end && samp < start + 2; samp++)
+		{
+			m_feedback[0] = m_feedback[1];
+			m_feedback[1] = m_feedback_in;
+		}
+		return;
+	}
+
+	// bit 0 routes to output 0 (left), bit 1 to output 1 (right); outputs
+	// 2 and 3 are not rendered, so with neither bit set only operator 1 is
+	// computed, for its feedback
+	uint32_t route = 0;
+	if (m_regs.ch_output_any(m_choffs) != 0)
+	{
+		route = (RegisterType::OUTPUTS == 1 || m_regs.ch_output_0(m_choffs)) ? 1 : 0;
+		if (RegisterType::OUTPUTS >= 2 && m_regs.ch_output_1(m_choffs))
+			route |= 2;
+	}
+	if (route == 0)
+	{
+		output_block<0, 0>(state, start, end, left, right, rshift, clipmax);
+		return;
+	}
+
+	#define BLOCK_CASE(alg, rt) case ((alg) << 2) | (rt): output_block<alg, rt>(state, start, end, left, right, rshift, clipmax); break;
+	if (is4op())
+	{
+		// OPL3 4-operator algorithms 8-11 only
+		if constexpr (RegisterType::DYNAMIC_OPS || RegisterType::OPERATORS / RegisterType::CHANNELS == 4)
+		{
+			assert(m_regs.ch_algorithm(m_choffs) >= 8);
+			switch ((m_regs.ch_algorithm(m_choffs) << 2) | route)
+			{
+				BLOCK_CASE(8, 1) BLOCK_CASE(8, 2) BLOCK_CASE(8, 3)
+				BLOCK_CASE(9, 1) BLOCK_CASE(9, 2) BLOCK_CASE(9, 3)
+				BLOCK_CASE(10, 1) BLOCK_CASE(10, 2) BLOCK_CASE(10, 3)
+				BLOCK_CASE(11, 1) BLOCK_CASE(11, 2) BLOCK_CASE(11, 3)
+			}
+		}
+	}
+	else if constexpr (RegisterType::OUTPUTS == 1)
+	{
+		switch ((bitfield(m_regs.ch_algorithm(m_choffs), 0) << 2) | route)
+		{
+			BLOCK_CASE(0, 1)
+			BLOCK_CASE(1, 1)
+		}
+	}
+	else
+	{
+		switch ((bitfield(m_regs.ch_algorithm(m_choffs), 0) << 2) | route)
+		{
+			BLOCK_CASE(0, 1) BLOCK_CASE(0, 2) BLOCK_CASE(0, 3)
+			BLOCK_CASE(1, 1) BLOCK_CASE(1, 2) BLOCK_CASE(1, 3)
+		}
+	}
+	#undef BLOCK_CASE
+}
+
+
+//-------------------------------------------------
+//  output_block - specialised block renderer; the
+//  same computation as output_2op/output_4op, but
+//  each operator runs over the whole block before
+//  the next one, with its outputs kept in
+//  state.opout for the operators it modulates
+//-------------------------------------------------
+
+template<class RegisterType>
+template<uint32_t Algorithm, uint32_t Route>
+void fm_channel<RegisterType>::output_block(fm_block_state &state, uint32_t start, uint32_t end, int32_t *left, int32_t *right, uint32_t rshift, int32_t clipmax)
+{
+	int16_t *op1out = state.opout[0];
+	int16_t *op2out = state.opout[1];
+	int16_t *op3out = state.opout[2];
+	int32_t clipmin = -clipmax - 1;
+
+	// operator 1 has optional self-feedback; the feedback is clocked through
+	// first, as in clock()
+	auto &op1 = *m_op[0];
+	uint32_t feedback = m_regs.ch_feedback(m_choffs);
+	for (uint32_t samp = start; samp < end; samp++)
+	{
+		m_feedback[0] = m_feedback[1];
+		m_feedback[1] = m_feedback_in;
+		op1.clock_block(state, samp);
+
+		int32_t opmod = 0;
+		if (feedback != 0)
+			opmod = (m_feedback[0] + m_feedback[1]) >> (10 - feedback);
+		int32_t op1value = m_feedback_in = op1.compute_volume(op1.phase() + opmod, state.am_offset[samp]);
+
+		// some OPL chips use the previous sample for 2-operator modulation
+		op1out[samp] = (Algorithm < 8 && RegisterType::MODULATOR_DELAY) ? m_feedback[1] : op1value;
+	}
+
+	if (Route == 0)
+	{
+		for (uint32_t opnum = 1; opnum < m_op.size(); opnum++)
+			if (m_op[opnum] != nullptr)
+				for (uint32_t samp = start; samp < end; samp++)
+					m_op[opnum]->clock_block(state, samp);
+		return;
+	}
+
+	if (Algorithm < 8)
+	{
+		//    0: O1 -> O2 -> out
+		//    1: (O1 + O2) -> out
+		auto &op2 = *m_op[1];
+		for (uint32_t samp = start; samp < end; samp++)
+		{
+			op2.clock_block(state, samp);
+			int32_t result;
+			if (Algorithm == 0)
+				result = op2.compute_volume(op2.phase() + (op1out[samp] >> 1), state.am_offset[samp]) >> rshift;
+			else
+			{
+				result = op1out[samp] >> rshift;
+				result += op2.compute_volume(op2.phase(), state.am_offset[samp]) >> rshift;
+				result = clamp(result, clipmin, clipmax);
+			}
+			if (Route & 1)
+				left[samp] += result;
+			if (Route & 2)
+				right[samp] += result;
+		}
+		return;
+	}
+
+	//    8: O1 -> O2 -> O3 -> O4 -> out (O4)
+	//    9: (O1 + (O2 -> O3 -> O4)) -> out (O1+O4)
+	//   10: ((O1 -> O2) + (O3 -> O4)) -> out (O2+O4)
+	//   11: (O1 + (O2 -> O3) + O4) -> out (O1+O3+O4)
+	auto &op2 = *m_op[1];
+	for (uint32_t samp = start; samp < end; samp++)
+	{
+		op2.clock_block(state, samp);
+		int32_t opmod = (Algorithm == 8 || Algorithm == 10) ? (op1out[samp] >> 1) : 0;
+		op2out[samp] = op2.compute_volume(op2.phase() + opmod, state.am_offset[samp]);
+	}
+
+	auto &op3 = *m_op[2];
+	for (uint32_t samp = start; samp < end; samp++)
+	{
+		op3.clock_block(state, samp);
+		int32_t opmod = (Algorithm != 10) ? (op2out[samp] >> 1) : 0;
+		op3out[samp] = op3.compute_volume(op3.phase() + opmod, state.am_offset[samp]);
+	}
+
+	auto &op4 = *m_op[3];
+	for (uint32_t samp = start; samp < end; samp++)
+	{
+		op4.clock_block(state, samp);
+		int32_t opmod = (Algorithm != 11) ? (op3out[samp] >> 1) : 0;
+		int32_t result = op4.compute_volume(op4.phase() + opmod, state.am_offset[samp]) >> rshift;
+		if (Algorithm == 9 || Algorithm == 11)
+			result = clamp(result + (op1out[samp] >> rshift), clipmin, clipmax);
+		if (Algorithm == 10)
+			result = clamp(result + (op2out[samp] >> rshift), clipmin, clipmax);
+		if (Algorithm == 11)
+			result = clamp(result + (op3out[samp] >> rshift), clipmin, clipmax);
+		if (Route & 1)
+			left[samp] += result;
+		if (Route & 2)
+			right[samp] += result;
+	}
+}
+#endif
+
+
 //*********************************************************
 //  FM ENGINE BASE
 //*********************************************************
@@ -1189,6 +1412,9 @@ fm_engine_base<RegisterType>::fm_engine_base(ymfm_interface &intf) :
 	m_active_channels(ALL_CHANNELS),
 	m_modified_channels(ALL_CHANNELS),
 	m_prepare_count(0)
+#ifdef YMFM_RATE_NUM
+	, m_rate_frac(0)
+#endif
 {
 	// inform the interface of their engine
 	m_intf.m_engine = this;
@@ -1316,6 +1542,24 @@ uint32_t fm_engine_base<RegisterType>::clock(uint32_t chanmask)
 		if (bitfield(chanmask, chnum))
 			m_channel[chnum]->clock(m_env_counter, lfo_raw_pm);
 
+#ifdef YMFM_RATE_NUM
+	// generating below the native rate: run the envelope, LFO and noise for
+	// the chip ticks owed so their timing matches the native clock
+	m_rate_frac += YMFM_RATE_NUM - YMFM_RATE_DEN;
+	if (m_rate_frac >= YMFM_RATE_DEN)
+	{
+		m_rate_frac -= YMFM_RATE_DEN;
+		if (RegisterType::EG_CLOCK_DIVIDER == 1)
+			m_env_counter += 4;
+		else if (bitfield(++m_env_counter, 0, 2) == RegisterType::EG_CLOCK_DIVIDER)
+			m_env_counter += 4 - RegisterType::EG_CLOCK_DIVIDER;
+		m_regs.clock_noise_and_lfo();
+		for (uint32_t chnum = 0; chnum < CHANNELS; chnum++)
+			if (bitfield(chanmask, chnum))
+				m_channel[chnum]->clock_extra(m_env_counter);
+	}
+#endif
+
 	// return the envelope counter as it is used to clock ADPCM-A
 	return m_env_counter;
 }
@@ -1391,6 +1635,128 @@ void fm_engine_base<RegisterType>::output(output_data &output, uint32_t rshift,
 }
 
 
+#if YMFM_BLOCK_RENDER
+//-------------------------------------------------
+//  clock_output_block - clock and output a block
+//  of samples; same result as clock() followed by
+//  output() for each sample, but the channels are
+//  rendered one after another over the block
+//-------------------------------------------------
+
+template<class RegisterType>
+void fm_engine_base<RegisterType>::clock_output_block(int32_t *left, int32_t *right, uint32_t numsamples, uint32_t rshift, int32_t clipmax)
+{
+	// a prepare sweep is due at most every 4096 samples, so there can only be
+	// one in a block
+	static_assert(YMFM_BLOCK_SIZE <= 4096, "block size too large");
+	assert(numsamples <= YMFM_BLOCK_SIZE);
+
+	std::fill_n(left, numsamples, 0);
+	if (RegisterType::OUTPUTS >= 2)
+		std::fill_n(right, numsamples, 0);
+
+	// the rhythm channels depend on the noise generator and on each other's
+	// phases, so they are clocked and output a sample at a time here, along
+	// with recording the engine state the other channels need
+	uint32_t rhythm = m_regs.rhythm_enable() ? 0x1c0 : 0;
+	uint32_t prepare_at = numsamples;
+	for (uint32_t samp = 0; samp < numsamples; samp++)
+	{
+		// this mirrors clock(), minus the channels
+		m_total_clocks++;
+		if (m_modified_channels != 0 || m_prepare_count++ >= 4096)
+		{
+			if (RegisterType::DYNAMIC_OPS)
+				assign_operators();
+			prepare_at = samp;
+			m_modified_channels = m_prepare_count = 0;
+		}
+
+		if (RegisterType::EG_CLOCK_DIVIDER == 1)
+			m_env_counter += 4;
+		else if (bitfield(++m_env_counter, 0, 2) == RegisterType::EG_CLOCK_DIVIDER)
+			m_env_counter += 4 - RegisterType::EG_CLOCK_DIVIDER;
+		m_block.env_counter[samp] = m_env_counter;
+		m_block.lfo_raw_pm[samp] = m_regs.clock_noise_and_lfo();
+
+#ifdef YMFM_RATE_NUM
+		m_block.extra[samp] = 0;
+		m_rate_frac += YMFM_RATE_NUM - YMFM_RATE_DEN;
+		if (m_rate_frac >= YMFM_RATE_DEN)
+		{
+			m_rate_frac -= YMFM_RATE_DEN;
+			if (RegisterType::EG_CLOCK_DIVIDER == 1)
+				m_env_counter += 4;
+			else if (bitfield(++m_env_counter, 0, 2) == RegisterType::EG_CLOCK_DIVIDER)
+				m_env_counter += 4 - RegisterType::EG_CLOCK_DIVIDER;
+			m_regs.clock_noise_and_lfo();
+			m_block.extra[samp] = 1;
+			m_block.extra_env_counter[samp] = m_env_counter;
+		}
+#endif
+
+		// AM depth is global on the OPL chips this is used with
+		m_block.am_offset[samp] = m_regs.lfo_am_offset(0);
+
+		if (rhythm != 0)
+		{
+			for (uint32_t chnum = 6; chnum <= 8; chnum++)
+			{
+				auto &chan = *m_channel[chnum];
+				if (prepare_at == samp)
+				{
+					m_active_channels &= ~(1 << chnum);
+					if (chan.prepare())
+						m_active_channels |= 1 << chnum;
+				}
+				chan.clock(m_block.env_counter[samp], m_block.lfo_raw_pm[samp]);
+#ifdef YMFM_RATE_NUM
+				if (m_block.extra[samp])
+					chan.clock_extra(m_block.extra_env_counter[samp]);
+#endif
+			}
+
+			uint32_t op13phase = m_operator[13]->phase();
+			uint32_t op17phase = m_operator[17]->phase();
+			uint32_t phase_select = (bitfield(op13phase, 2) ^ bitfield(op13phase, 7)) | bitfield(op13phase, 3) | (bitfield(op17phase, 5) ^ bitfield(op17phase, 3));
+
+			output_data output;
+			output.clear();
+			if (bitfield(m_active_channels, 6))
+				m_channel[6]->output_rhythm_ch6(output, rshift, clipmax);
+			if (bitfield(m_active_channels, 7))
+				m_channel[7]->output_rhythm_ch7(phase_select, output, rshift, clipmax);
+			if (bitfield(m_active_channels, 8))
+				m_channel[8]->output_rhythm_ch8(phase_select, output, rshift, clipmax);
+			left[samp] += output.data[0];
+			if (RegisterType::OUTPUTS >= 2)
+				right[samp] += output.data[1 % RegisterType::OUTPUTS];
+		}
+	}
+
+	// now each remaining channel over the whole block, split at the prepare
+	for (uint32_t chnum = 0; chnum < CHANNELS; chnum++)
+	{
+		if (bitfield(rhythm, chnum))
+			continue;
+		auto &chan = *m_channel[chnum];
+		bool active = bitfield(m_active_channels, chnum);
+		uint32_t start = 0;
+		if (prepare_at < numsamples)
+		{
+			chan.output_block(m_block, 0, prepare_at, active, left, right, rshift, clipmax);
+			active = chan.prepare();
+			m_active_channels &= ~(1 << chnum);
+			if (active)
+				m_active_channels |= 1 << chnum;
+			start = prepare_at;
+		}
+		chan.output_block(m_block, start, numsamples, active, left, right, rshift, clipmax);
+	}
+}
+#endif
+
+
 //-------------------------------------------------
 //  write - handle writes to the OPN registers
 //-------------------------------------------------
@@ -365,7 +365,15 @@ static uint32_t opl_compute_phase_step(uint32_t block_freq, uint32_t multiple, i
 	uint32_t phase_step = (fnum << block) >> 2;
 
 	// apply frequency multiplier (which is cached as an x.1 value)
-	return (phase_step * multiple) >> 1;
+	phase_step = (phase_step * multiple) >> 1;
+
+#ifdef YMFM_RATE_NUM
+	// scale by YMFM_RATE_NUM/YMFM_RATE_DEN in Q15, split so the 22-bit step
+	// doesn't overflow 32 bits
+	constexpr uint32_t scale = ((YMFM_RATE_NUM << 15) + YMFM_RATE_DEN / 2) / YMFM_RATE_DEN;
+	phase_step = (((phase_step >> 16) * scale) << 1) + (((phase_step & 0xffff) * scale) >> 15);
+#endif
+	return phase_step;
 }
 
 template<int Revision>
@@ -1243,6 +1251,27 @@ void ym3812::generate(output_data *output, uint32_t numsamples)
 }
 
 
+#if YMFM_BLOCK_RENDER
+//-------------------------------------------------
+//  generate_block - generate samples of sound a
+//  channel at a time
+//-------------------------------------------------
+
+void ym3812::generate_block(int32_t *output, uint32_t numsamples)
+{
+	while (numsamples > 0)
+	{
+		uint32_t count = std::min<uint32_t>(numsamples, YMFM_BLOCK_SIZE);
+		m_fm.clock_output_block(output, nullptr, count, 1, 32767);
+		for (uint32_t samp = 0; samp < count; samp++)
+			output[samp] = roundtrip_fp(output[samp]);
+		output += count;
+		numsamples -= count;
+	}
+}
+#endif
+
+
 
 //*********************************************************
 //  YMF262
@@ -1415,6 +1444,31 @@ void ymf262::generate(output_data *output, uint32_t numsamples)
 }
 
 
+#if YMFM_BLOCK_RENDER
+//-------------------------------------------------
+//  generate_block - generate samples of sound a
+//  channel at a time
+//-------------------------------------------------
+
+void ymf262::generate_block(int32_t *left, int32_t *right, uint32_t numsamples)
+{
+	while (numsamples > 0)
+	{
+		uint32_t count = std::min<uint32_t>(numsamples, YMFM_BLOCK_SIZE);
+		m_fm.clock_output_block(left, right, count, 0, 32767);
+		for (uint32_t samp = 0; samp < count; samp++)
+		{
+			left[samp] = clamp(left[samp], -32768, 32767);
+			right[samp] = clamp(right[samp], -32768, 32767);
+		}
+		left += count;
+		right += count;
+		numsamples -= count;
+	}
+}
+#endif
+
+
 
 //*********************************************************
 //  YMF289B
@@ -623,6 +623,11 @@ public:
 	// generate samples of sound
 	void generate(output_data *output, uint32_t numsamples = 1);
 
+#if YMFM_BLOCK_RENDER
+	// generate samples of sound a channel at a time; same output as generate()
+	void generate_block(int32_t *output, uint32_t numsamples);
+#endif
+
 protected:
 	// internal state
 	uint8_t m_address;               // address register
@@ -670,6 +675,12 @@ public:
 	// generate samples of sound
 	void generate(output_data *output, uint32_t numsamples = 1);
 
+#if YMFM_BLOCK_RENDER
+	// generate samples of sound a channel at a time; same as outputs 0 and 1
+	// of generate(), outputs 2 and 3 are not rendered
+	void generate_block(int32_t *left, int32_t *right, uint32_t numsamples);
+#endif
+
 protected:
 	// internal state
 	uint16_t m_address;              // address register
@@ -75,11 +75,10 @@ static uint16_t sb_port_test;
 void play_adlib(void);
 #if OPL_CMD_BUFFER
 #include "include/cmd_buffers.h"
-cms_buffer_t opl_cmd_buffer = { {0}, 0, 0 };
-#else
+opl_buffer_t opl_cmd_buffer;
+#endif // OPL_CMD_BUFFER
 extern "C" void OPL_Pico_WriteRegister(unsigned int reg_num, unsigned int value);
 static uint16_t opl_addr;
-#endif // OPL_CMD_BUFFER
 #if AUDIO_CALLBACK_CORE0
 extern void audio_sample_handler(void);
 #endif // AUDIO_CALLBACK_CORE0
@@ -93,6 +92,7 @@ extern "C" void mke_init();
 
 #include "cdrom/cdrom.h"
 #include "cdrom/cdrom_image_manager.h"
+#include "cdrom/msc_app.h"
 cdrom_t cdrom;
 
 static uint32_t cur_read_idx;
@@ -118,6 +118,7 @@ void play_mpu(void);
 #include "include/cmd_buffers.h"
 #include "square/square.h"
 void play_psg(void);
+extern volatile uint32_t psg_sample_clock;
 #endif
 #if SOUND_TANDY
 tandy_buffer_t tandy_buffer = { {0}, 0, 0 };
@@ -126,6 +127,22 @@ tandy_buffer_t tandy_buffer = { {0}, 0, 0 };
 static uint8_t cms_detect = 0xFF;
 cms_buffer_t cms_buffer = { {0}, 0, 0 };
 #endif
+#if SOUND_TANDY || SOUND_CMS
+// Queue a Tandy/CMS write, stamped with the output frame it arrived on. These
+// are fast writes that don't hold the bus, so a write that finds the queue
+// full is dropped and counted rather than overwriting unplayed writes.
+template <typename T>
+__force_inline void psg_cmd_write(T &buf, uint16_t port, uint8_t data) {
+    const uint8_t head = buf.head;
+    if ((uint8_t)(head - buf.tail) == PSG_CMD_BUFFER_SIZE - 1) {
+        buf.dropped++;
+        return;
+    }
+    buf.cmds[head] = psg_cmd_pack(psg_sample_clock, port, data);
+    __compiler_memory_barrier();
+    buf.head = head + 1;
+}
+#endif
 
 
 #ifdef NE2000
@@ -181,6 +198,7 @@ const char* firmware_string = PICO_PROGRAM_NAME " v" PICO_PROGRAM_VERSION_STRING
 static uint8_t basePort_low;
 static uint8_t mouseSensitivity_low;
 static uint8_t picogus_dataLatch_low;
+static uint16_t cdStat; // latched when CMD_CDFRAGS, CMD_CDSEEKIO, CMD_CDLATENCY, CMD_CDDECODE or CMD_CDDECMAX is selected
 
 __force_inline void select_picogus(uint8_t value) {
     // printf("select picogus %x\n", value);
@@ -258,6 +276,8 @@ __force_inline void select_picogus(uint8_t value) {
     case CMD_CDSTATUS:
     case CMD_CDLOAD:
     case CMD_CDAUTOADV:
+    case CMD_CDSPEED:
+    case CMD_CDCACHE:
     case CMD_MAINVOL:
     case CMD_OPLVOL:
     case CMD_SBVOL:
@@ -270,6 +290,46 @@ __force_inline void select_picogus(uint8_t value) {
     case CMD_CDERROR:
         cur_read = 0;
         break;
+    case CMD_CDFRAGS:
+    case CMD_CDSEEKIO:
+    case CMD_CDLATENCY:
+    case CMD_CDDECODE:
+    case CMD_CDDECMAX:
+        cdStat = 0;
+#ifdef CDROM
+        if (sel_reg == CMD_CDDECODE || sel_reg == CMD_CDDECMAX) {
+            uint32_t us, max_us, sectors;
+            cdrom_audio_decode_stats(&cdrom, &us, &max_us, &sectors);
+            if (sel_reg == CMD_CDDECMAX) {
+                cdStat = max_us > 0xFFFF ? 0xFFFF : max_us;
+            } else if (!sectors) {
+                cdStat = 0xFFFF;
+            } else {
+                // 588 samples per sector
+                const uint64_t cycles = (uint64_t)us * (clock_get_hz(clk_sys) / 1000000) / ((uint64_t)sectors * 588);
+                cdStat = cycles > 0xFFFE ? 0xFFFE : cycles;
+            }
+        } else if (sel_reg == CMD_CDLATENCY) {
+            const uint32_t latency_us = cdrom_audio_start_latency(&cdrom);
+            if (latency_us == UINT32_MAX) {
+                cdStat = 0xFFFF;
+            } else {
+                cdStat = latency_us / 1000 > 0xFFFE ? 0xFFFE : latency_us / 1000;
+            }
+        } else {
+            uint32_t fragments, seeks, seek_reads;
+            cdrom_image_seek_stats(&cdrom, &fragments, &seeks, &seek_reads);
+            if (sel_reg == CMD_CDFRAGS) {
+                cdStat = fragments > 0xFFFF ? 0xFFFF : fragments;
+            } else if (!seeks) {
+                cdStat = 0xFFFF;
+            } else {
+                const uint64_t tenths = (uint64_t)seek_reads * 10 / seeks;
+                cdStat = tenths > 0xFFFE ? 0xFFFE : tenths;
+            }
+        }
+#endif
+        break;
     case CMD_SAVE: // Select save settings register
     case CMD_REBOOT: // Select reboot register
     case CMD_DEFAULTS: // Select reset to defaults register
@@ -464,6 +524,12 @@ __force_inline void write_picogus_high(uint8_t value) {
         settings.CD.autoAdvance = value;
 #ifdef CDROM
         cdman_set_autoadvance(settings.CD.autoAdvance);
+#endif
+        break;
+    case CMD_CDSPEED: // emulated CD drive speed
+        settings.CD.speed = value;
+#ifdef CDROM
+        cdrom.speed = settings.CD.speed;
 #endif
         break;
 
@@ -549,6 +615,12 @@ __force_inline uint8_t read_picogus_low(void) {
         return settings.NE2K.basePort == 0xFFFF ? 0 : (settings.NE2K.basePort & 0xFF);
     case CMD_CDPORT: // SB Base port
         return settings.CD.basePort == 0xFFFF ? 0 : (settings.CD.basePort & 0xFF);
+    case CMD_CDFRAGS:
+    case CMD_CDSEEKIO:
+    case CMD_CDLATENCY:
+    case CMD_CDDECODE:
+    case CMD_CDDECMAX:
+        return cdStat & 0xFF;
     default:
         return 0x0;
     }
@@ -635,13 +707,15 @@ __force_inline uint8_t read_picogus_high(void) {
         // printf("cdstatus %x\n", cdrom.image_status);
         return cdrom.image_status;
     case CMD_CDLIST:
+        if (cdrom.image_status != CD_STATUS_READY) { // No list to read, or core 1 is replacing it
+            return 0x04; // EOT
+        }
         if (cur_read_idx == cdrom.image_count) { // If end of the images
             cur_read_idx = cur_read = 0;
             cdrom.image_status = CD_STATUS_IDLE;
-            cdman_list_images_free(cdrom.image_list, cdrom.image_count);
             return 0x04; // EOT
         }
-        ret = cdrom.image_list[cur_read_idx][cur_read++];
+        ret = cdman_listed_name(cur_read_idx)[cur_read++];
         DBG_PUTCHAR(ret);
         if (ret == 0) { // Null terminated
             ++cur_read_idx;
@@ -662,9 +736,26 @@ __force_inline uint8_t read_picogus_high(void) {
             cur_read = 0;
         }
         return ret;
+    case CMD_CDCACHE: // USB sector cache hit rate
+        {
+            uint32_t hits, misses;
+            msc_cache_stats(&hits, &misses);
+            if (!(hits + misses)) {
+                return 0xFF;
+            }
+            return (uint64_t)hits * 100 / (hits + misses);
+        }
 #endif
     case CMD_CDAUTOADV: // enable joystick
         return settings.CD.autoAdvance;
+    case CMD_CDSPEED:
+        return settings.CD.speed;
+    case CMD_CDFRAGS:
+    case CMD_CDSEEKIO:
+    case CMD_CDLATENCY:
+    case CMD_CDDECODE:
+    case CMD_CDDECMAX:
+        return cdStat >> 8;
     case CMD_MAINVOL: // CD audio volume
         return settings.Volume.mainVol;
     case CMD_OPLVOL: // Adlib volume
@@ -729,6 +820,7 @@ void processSettings(void) {
     cdrom_port_test = settings.CD.basePort >> 4;
     DBG_PRINTF("cdrom base port: %x\n", settings.CD.basePort);
     cdman_set_autoadvance(settings.CD.autoAdvance);
+    cdrom.speed = settings.CD.speed;
 #endif
     if (BOARD_TYPE == PICOGUS_2) {
         m62429->setVolume(M62429_BOTH, settings.Global.waveTableVolume);
@@ -739,6 +831,45 @@ void processSettings(void) {
 }
 
 
+#if OPL_CMD_BUFFER
+// Queue a write to the latched OPL register, stamped with the output frame it
+// arrived on so core 1 can render it at the right sample. Called with IOCHRDY
+// held (IO_WAIT already sent): if the queue is full, the bus stays held for up
+// to OPL_CMD_STALL_US for core 1 to free a slot. Core 1 can be stuck in a USB
+// read for far longer than the bus may be held, so after that the write is
+// dropped and counted rather than overwriting unplayed writes (see
+// OPL_CMD_STALL_US for how long core 1 can stop before that happens).
+__force_inline void opl_cmd_write(uint8_t data) {
+    if ((opl_addr & 0xFF) <= OPL_REG_TIMER_CTRL && !(opl_addr & 0x100)) {
+        // Timer registers (bank 1 only): handle immediately on core 0 so OPL_Pico_PortRead
+        // always sees current timer state without a cross-core race.
+        OPL_Pico_WriteRegister(opl_addr, data);
+        return;
+    }
+    const uint16_t head = opl_cmd_buffer.head;
+    const uint16_t level = head - opl_cmd_buffer.tail;
+    if (level >= OPL_CMD_HIGH_WATER) {
+        if (level == OPL_CMD_HIGH_WATER) {
+            opl_cmd_buffer.near_full++;
+        }
+        if (level >= OPL_CMD_BUFFER_SIZE) {
+            opl_cmd_buffer.stalls++;
+            const uint32_t start = time_us_32();
+            while ((uint16_t)(head - opl_cmd_buffer.tail) >= OPL_CMD_BUFFER_SIZE) {
+                if (time_us_32() - start >= OPL_CMD_STALL_US) {
+                    opl_cmd_buffer.dropped++;
+                    return;
+                }
+                tight_loop_contents();
+            }
+        }
+    }
+    opl_cmd_buffer.cmds[head & OPL_CMD_BUFFER_MASK] = opl_cmd_pack(opl_sample_clock, opl_addr, data);
+    __compiler_memory_barrier();
+    opl_cmd_buffer.head = head + 1;
+}
+#endif
+
 static constexpr uint32_t IO_WAIT = 0xffffffffu;
 static constexpr uint32_t IO_END = 0x0u;
 // OR with 0x0000ff00 is required to set pindirs in the PIO
@@ -799,11 +930,7 @@ __force_inline void handle_iow(void) {
         case 0x8: // OPL bank 1 address
             // Fast write
             pio_sm_put(pio0, IOW_PIO_SM, IO_END);
-#if OPL_CMD_BUFFER
-            opl_cmd_buffer.cmds[opl_cmd_buffer.head].addr = (uint16_t)(iow_read & 0xFF);
-#else
             opl_addr = (iow_read & 0xff);
-#endif
             // Fast write - return early as we've already written 0x0u to the PIO
             return;
             break;
@@ -811,17 +938,7 @@ __force_inline void handle_iow(void) {
         case 0x9: // OPL bank 1 data
             pio_sm_put(pio0, IOW_PIO_SM, IO_WAIT);
 #if OPL_CMD_BUFFER
-            {
-                uint8_t opl_data = iow_read & 0xFF;
-                uint8_t opl_addr = (uint8_t)opl_cmd_buffer.cmds[opl_cmd_buffer.head].addr;
-                if (opl_addr <= OPL_REG_TIMER_CTRL) {
-                    // Timer registers: handle immediately on core 0 so OPL_Pico_PortRead
-                    // always sees current timer state without a cross-core race.
-                    OPL_Pico_WriteRegister(opl_addr, opl_data);
-                } else {
-                    opl_cmd_buffer.cmds[opl_cmd_buffer.head++].data = opl_data;
-                }
-            }
+            opl_cmd_write(iow_read & 0xFF);
 #else
             OPL_Pico_WriteRegister(opl_addr, iow_read & 0xff);
 #endif
@@ -829,25 +946,12 @@ __force_inline void handle_iow(void) {
         case 0x2: // OPL3 bank 2 address
             // Fast write
             pio_sm_put(pio0, IOW_PIO_SM, IO_END);
-#if OPL_CMD_BUFFER
-            opl_cmd_buffer.cmds[opl_cmd_buffer.head].addr = (uint16_t)(0x100 | (iow_read & 0xFF));
-#else
             opl_addr = 0x100 | (iow_read & 0xff);
-#endif
             return;
         case 0x3: // OPL3 bank 2 data
             pio_sm_put(pio0, IOW_PIO_SM, IO_WAIT);
 #if OPL_CMD_BUFFER
-            {
-                uint8_t opl_data = iow_read & 0xFF;
-                uint16_t opl_addr_full = opl_cmd_buffer.cmds[opl_cmd_buffer.head].addr;
-                uint8_t opl_addr_low = (uint8_t)(opl_addr_full & 0xFF);
-                if (opl_addr_low <= OPL_REG_TIMER_CTRL && !(opl_addr_full & 0x100)) {
-                    OPL_Pico_WriteRegister(opl_addr_low, opl_data);
-                } else {
-                    opl_cmd_buffer.cmds[opl_cmd_buffer.head++].data = opl_data;
-                }
-            }
+            opl_cmd_write(iow_read & 0xFF);
 #else
             OPL_Pico_WriteRegister(opl_addr, iow_read & 0xff);
 #endif
@@ -875,20 +979,12 @@ __force_inline void handle_iow(void) {
         case 0: // bank 1 address
             // Fast write
             pio_sm_put(pio0, IOW_PIO_SM, IO_END);
-#if OPL_CMD_BUFFER
-            opl_cmd_buffer.cmds[opl_cmd_buffer.head].addr = (uint16_t)(iow_read & 0xFF);
-#else
             opl_addr = (iow_read & 0xff);
-#endif
             return;
         case 2: // bank 2 address (OPL3 only)
             // Fast write — store with 0x100 bank flag so write_address_hi is used
             pio_sm_put(pio0, IOW_PIO_SM, IO_END);
-#if OPL_CMD_BUFFER
-            opl_cmd_buffer.cmds[opl_cmd_buffer.head].addr = (uint16_t)(0x100 | (iow_read & 0xFF));
-#else
             opl_addr = 0x100 | (iow_read & 0xff);
-#endif
             return;
         case 1: // bank 1 data
         case 3: // bank 2 data
@@ -897,17 +993,7 @@ __force_inline void handle_iow(void) {
                 busy_wait_us(1); // busy wait for speed sensitive games
             }
 #if OPL_CMD_BUFFER
-            {
-                uint8_t opl_data = iow_read & 0xFF;
-                uint16_t opl_addr_full = opl_cmd_buffer.cmds[opl_cmd_buffer.head].addr;
-                uint8_t opl_addr_low = (uint8_t)(opl_addr_full & 0xFF);
-                if (opl_addr_low <= OPL_REG_TIMER_CTRL && !(opl_addr_full & 0x100)) {
-                    // Timer registers (bank 1 only): handle immediately on core 0
-                    OPL_Pico_WriteRegister(opl_addr_low, opl_data);
-                } else {
-                    opl_cmd_buffer.cmds[opl_cmd_buffer.head++].data = opl_data;
-                }
-            }
+            opl_cmd_write(iow_read & 0xFF);
 #else
             OPL_Pico_WriteRegister(opl_addr, iow_read & 0xff);
 #endif
@@ -918,7 +1004,7 @@ __force_inline void handle_iow(void) {
 #ifdef SOUND_TANDY
     if (port == settings.Tandy.basePort) {
         pio_sm_put(pio0, IOW_PIO_SM, IO_END);
-        tandy_buffer.cmds[tandy_buffer.head++] = iow_read & 0xFF;
+        psg_cmd_write(tandy_buffer, port, iow_read & 0xFF);
         return;
     } else // if follows down below
 #endif // SOUND_TANDY
@@ -969,10 +1055,7 @@ __force_inline void handle_iow(void) {
         case 0x1:
         case 0x2:
         case 0x3:
-            cms_buffer.cmds[cms_buffer.head++] = {
-                port,
-                (uint8_t)(iow_read & 0xFF)
-            };
+            psg_cmd_write(cms_buffer, port, iow_read & 0xFF);
             break;
         // CMS autodetect ports
         case 0x6:
@@ -89,25 +89,126 @@ static cms_t cms;
 static constexpr uint32_t clocks_per_sample_minus_one = (RP2_CLOCK_SPEED * 1000u / 44100) - 1;
 static constexpr uint pwm_slice_num = 4; // slices 0-3 are taken by USB joystick support
 
-// PSG generation is cheap (phase accumulators + volume lookups per voice), so
-// synthesize directly in the ISR — no intermediate FIFO needed.
-void audio_sample_handler(void) {
-    pwm_clear_irq(pwm_slice_num);
+// Output frames played by the audio ISR. Core 0 stamps queued Tandy/CMS writes
+// with it; psg_render_clock is the frame the loop below is rendering.
+volatile uint32_t psg_sample_clock;
+static uint32_t psg_render_clock;
+
+// PSG FIFO of finished I2S words, filled in blocks by the core 1 loop so the
+// ISR only copies out. 256 stereo pairs ~= 5.8ms at 44100Hz.
+#define PSG_FIFO_SIZE 256
+#define PSG_FIFO_BITS (PSG_FIFO_SIZE - 1)
+static struct {
+    uint32_t buffer[PSG_FIFO_SIZE];
+    volatile uint32_t write_idx;
+    volatile uint32_t read_idx;
+} psg_out_fifo;
+
+static inline uint32_t psg_fifo_free_space() {
+    return PSG_FIFO_SIZE - (psg_out_fifo.write_idx - psg_out_fifo.read_idx);
+}
+
+// Largest run rendered between checks of the write queues
+static constexpr uint32_t PSG_RENDER_BLOCK = 64;
+// Output frames from a write arriving on the bus to the frame it is rendered
+// on: at least as far ahead of the ISR as the FIFO plus a block can get, so
+// writes keep their spacing instead of bunching up at block starts.
+static constexpr uint32_t PSG_CMD_LATENCY = PSG_FIFO_SIZE + PSG_RENDER_BLOCK;
+
+// Frames until queued write `cmd` is due at output frame `clock`; 0 or less
+// when it already is
+static inline int32_t psg_cmd_wait(uint32_t cmd, uint32_t clock, uint8_t queued) {
+    if (queued >= PSG_CMD_HIGH_WATER) {
+        return 0;
+    }
+    // Timestamps only carry 20 bits; sign-extend the difference
+    return ((int32_t)(((cmd >> 12) + PSG_CMD_LATENCY - clock) << 12)) >> 12;
+}
+
+// Apply the queued writes due at psg_render_clock. Returns the number of frames
+// (1..max) to render before calling again.
+static uint32_t psg_drain(uint32_t max) {
+    bool applied = false;
+#if SOUND_TANDY
+    while (tandy_buffer.tail != tandy_buffer.head) {
+        const uint32_t cmd = tandy_buffer.cmds[tandy_buffer.tail];
+        const int32_t wait = psg_cmd_wait(cmd, psg_render_clock, tandy_buffer.head - tandy_buffer.tail);
+        if (wait > 0) {
+            if ((uint32_t)wait < max) {
+                max = wait;
+            }
+            break;
+        }
+        tandysound.write_register(0, cmd & 0xFF);
+        ++tandy_buffer.tail;
+        applied = true;
+    }
+#endif // SOUND_TANDY
+#if SOUND_CMS
+    while (cms_buffer.tail != cms_buffer.head) {
+        const uint32_t cmd = cms_buffer.cmds[cms_buffer.tail];
+        const int32_t wait = psg_cmd_wait(cmd, psg_render_clock, cms_buffer.head - cms_buffer.tail);
+        if (wait > 0) {
+            if ((uint32_t)wait < max) {
+                max = wait;
+            }
+            break;
+        }
+        const uint32_t port = (cmd >> 8) & 0xF;
+        if (port & 1) {
+            cms.write_addr(port, cmd & 0xFF);
+        } else {
+            cms.write_data(port, cmd & 0xFF);
+        }
+        ++cms_buffer.tail;
+        applied = true;
+    }
+#endif
+    if (applied) {
+        gpio_xor_mask(LED_PIN);
+    }
+    return max;
+}
 
-    int32_t buf[2] = {0, 0};
+// Render `frames` (at most PSG_RENDER_BLOCK) finished I2S words into `dest`,
+// splitting the block wherever a queued write falls due
+static void psg_render(uint32_t *dest, uint32_t frames) {
+    int32_t buf[PSG_RENDER_BLOCK * 2];
+    while (frames) {
+        const uint32_t run = psg_drain(frames);
+        for (uint32_t i = 0; i < run * 2; i++) {
+            buf[i] = 0;
+        }
 #if SOUND_TANDY
-    tandysound.generator().generate_frames(buf, 1);
+        tandysound.generator().generate_frames(buf, run);
 #endif
 #if SOUND_CMS
-    cms.generator(0).generate_frames(buf, 1);
-    cms.generator(1).generate_frames(buf, 1);
+        cms.generator(0).generate_frames(buf, run);
+        cms.generator(1).generate_frames(buf, run);
 #endif
-    int32_t sample_l = scale_sample(clamp16(buf[0]), volume.psg, 0);
-    int32_t sample_r = scale_sample(clamp16(buf[1]), volume.psg, 0);
-    sample_l = clamp16(sample_l);
-    sample_r = clamp16(sample_r);
+        for (uint32_t i = 0; i < run; i++) {
+            int32_t sample_l = scale_sample(clamp16(buf[i * 2]), volume.psg, 0);
+            int32_t sample_r = scale_sample(clamp16(buf[i * 2 + 1]), volume.psg, 0);
+            sample_l = clamp16(sample_l);
+            sample_r = clamp16(sample_r);
+            dest[i] = (sample_l & 0xFFFF) | (sample_r << 16);
+        }
+        dest += run;
+        frames -= run;
+        psg_render_clock += run;
+    }
+}
 
-    audio_pio->txf[PICO_AUDIO_I2S_SM] = ((sample_l & 0xFFFF) | (sample_r << 16));
+void audio_sample_handler(void) {
+    pwm_clear_irq(pwm_slice_num);
+
+    psg_sample_clock++;
+    uint32_t sample = 0;
+    if (psg_out_fifo.write_idx != psg_out_fifo.read_idx) {
+        sample = psg_out_fifo.buffer[psg_out_fifo.read_idx & PSG_FIFO_BITS];
+        psg_out_fifo.read_idx++;
+    }
+    audio_pio->txf[PICO_AUDIO_I2S_SM] = sample;
 }
 
 void play_psg() {
@@ -148,32 +249,23 @@ void play_psg() {
     pwm_set_enabled(pwm_slice_num, true);
 
     for (;;) {
-        bool notfirst = false;
-#if SOUND_TANDY
-        while (tandy_buffer.tail != tandy_buffer.head) {
-            if (!notfirst) {
-                gpio_xor_mask(LED_PIN);
-                notfirst = true;
-            }
-            tandysound.write_register(0, tandy_buffer.cmds[tandy_buffer.tail]);
-            ++tandy_buffer.tail;
-        }
-#endif // SOUND_TANDY
-#if SOUND_CMS
-        while (cms_buffer.tail != cms_buffer.head) {
-            if (!notfirst) {
-                gpio_xor_mask(LED_PIN);
-                notfirst = true;
+        // Top up the FIFO in contiguous runs of at most one block.
+        // psg_render_clock is the output frame of the next sample added.
+        psg_render_clock = psg_sample_clock + (PSG_FIFO_SIZE - psg_fifo_free_space());
+        uint32_t psg_n = psg_fifo_free_space();
+        while (psg_n) {
+            const uint32_t idx = psg_out_fifo.write_idx & PSG_FIFO_BITS;
+            uint32_t run = PSG_FIFO_SIZE - idx;
+            if (run > psg_n) {
+                run = psg_n;
             }
-            auto cmd = cms_buffer.cmds[cms_buffer.tail];
-            if (cmd.addr & 1) {
-                cms.write_addr(cmd.addr, cmd.data);
-            } else {
-                cms.write_data(cmd.addr, cmd.data);
+            if (run > PSG_RENDER_BLOCK) {
+                run = PSG_RENDER_BLOCK;
             }
-            ++cms_buffer.tail;
+            psg_render(&psg_out_fifo.buffer[idx], run);
+            psg_out_fifo.write_idx += run;
+            psg_n -= run;
         }
-#endif
 
 #ifdef USB_STACK
         // Service TinyUSB events
@@ -188,6 +280,22 @@ void play_psg() {
 #endif
 #ifdef SOUND_MPU
         send_midi_bytes(8);
+#endif
+#ifdef PGDEBUG
+        {
+            static uint32_t last_dropped;
+            uint32_t dropped = 0;
+#if SOUND_TANDY
+            dropped += tandy_buffer.dropped;
+#endif
+#if SOUND_CMS
+            dropped += cms_buffer.dropped;
+#endif
+            if (dropped != last_dropped) {
+                last_dropped = dropped;
+                DBG_PRINTF("PSG queue full, writes dropped %u\n", dropped);
+            }
+        }
 #endif
     }
 }
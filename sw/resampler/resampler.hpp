@@ -10,6 +10,8 @@
 #include <taps.hpp>
 #include <stdint.h>
 #include <cmath>
+#include <numeric>
+#include <string.h>
 #include "audio/audio_fifo.h"  // for sample_pair
 
 
@@ -177,3 +179,90 @@ public:
 		return out;
 	}
 };
+
+
+// Tap rows of the 13-tap filter above at PHASES+1 evenly spaced phases over
+// [-0.5, 0.5], evaluated at compile time from the same cubic fir_coeff that
+// Resampler/StereoResampler evaluate at run time.
+template<uint32_t PHASES>
+static constexpr std::array<int16_t, (PHASES + 1) * 13> resampler_make_phase_taps() {
+	std::array<int16_t, (PHASES + 1) * 13> taps{};
+	for (uint32_t row = 0; row <= PHASES; row++) {
+		const double p = (double)row / PHASES - 0.5;
+		for (uint32_t j = 0; j < 13; j++) {
+			const double v = fir_coeff[4*j] + p * (fir_coeff[4*j+1] + p * (fir_coeff[4*j+2] + p * fir_coeff[4*j+3]));
+			taps[row*13 + j] = (int16_t)(v < 0 ? v - 0.5 : v + 0.5);
+		}
+	}
+	return taps;
+}
+
+
+// Stereo resampler specialised at compile time for IN_RATE -> OUT_RATE.
+// The ratio is reduced to M/L input/output frames, and the phase of each
+// output is tracked exactly in 1/L input frames, so the phase pattern repeats
+// every L outputs without drift. Taps for each phase are linearly interpolated
+// between precomputed rows instead of re-evaluating the cubic per input frame,
+// and input is pulled with one IN_FN call per block of outputs.
+template<uint32_t IN_RATE, uint32_t OUT_RATE, void (*IN_FN)(sample_pair *, uint32_t)>
+class PolyphaseStereoResampler {
+	static constexpr uint32_t TAPS = 13;
+	static constexpr uint32_t PHASES = 64;
+	static constexpr int32_t M = IN_RATE / std::gcd(IN_RATE, OUT_RATE);
+	static constexpr int32_t L = OUT_RATE / std::gcd(IN_RATE, OUT_RATE);
+	// The block loop and the tap rows assume at least one input per output
+	static_assert(M > L, "PolyphaseStereoResampler only downsamples (IN_RATE > OUT_RATE)");
+public:
+	// Maximum outputs per IN_FN call
+	static constexpr uint32_t BLOCK = 32;
+private:
+	static constexpr uint32_t MAX_IN = (BLOCK * M + L - 1) / L + 1;
+	// (2 * phase + L) -> tap row in 16.16, with phase in 1/L input frames
+	static constexpr uint32_t ROW_SCALE = (PHASES << 16) / (2 * L);
+	static_assert((2 * L - 1) * ROW_SCALE < (PHASES << 16), "tap row out of range");
+	static_assert(BLOCK * M + L < (1u << 30), "phase overflow");
+	static constexpr std::array<int16_t, (PHASES + 1) * TAPS> phase_taps = resampler_make_phase_taps<PHASES>();
+
+	int32_t phase; // next output relative to the newest input, in 1/L input frames: [-L/2, L/2)
+	sample_pair in[TAPS - 1 + MAX_IN]; // TAPS-1 history frames, then the current block
+
+	void process_block(sample_pair *out, uint32_t n)
+	{
+		// Inputs consumed by n outputs: the count that brings phase back into [-L/2, L/2)
+		const int32_t end = phase + (int32_t)n * M;
+		const uint32_t need = (uint32_t)(2 * end + L) / (2 * L);
+		IN_FN(&in[TAPS - 1], need);
+
+		const sample_pair *newest = &in[TAPS - 2];
+		for (uint32_t i = 0; i < n; i++) {
+			phase += M;
+			while (2 * phase >= L) {
+				newest++;
+				phase -= L;
+			}
+			const uint32_t pos = (uint32_t)(2 * phase + L) * ROW_SCALE;
+			const int16_t *row = &phase_taps[(pos >> 16) * TAPS];
+			const int32_t frac = pos & 0xffff;
+			const sample_pair *w = newest - (TAPS - 1);
+			int32_t acc_l = 0, acc_r = 0;
+			for (uint32_t j = 0; j < TAPS; j++) {
+				const int32_t tap = row[j] + (((row[j + TAPS] - row[j]) * frac) >> 16);
+				acc_l += w[j].data16[0] * tap;
+				acc_r += w[j].data16[1] * tap;
+			}
+			out[i].data16[0] = acc_l >> 16;
+			out[i].data16[1] = acc_r >> 16;
+		}
+		memmove(in, &in[need], (TAPS - 1) * sizeof(sample_pair));
+	}
+public:
+	void process(sample_pair *out, uint32_t n)
+	{
+		while (n) {
+			const uint32_t run = n < BLOCK ? n : BLOCK;
+			process_block(out, run);
+			out += run;
+			n -= run;
+		}
+	}
+};
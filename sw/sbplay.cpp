@@ -26,6 +26,7 @@
 #include "hardware/structs/clocks.h"
 #include "hardware/pwm.h"
 #include "hardware/pio.h"
+#include "hardware/structs/xip_ctrl.h"
 
 #endif
 
@@ -55,8 +56,12 @@
 #include "audio/clamp.h"
 
 #if OPL_CMD_BUFFER
+// Timestamps for queued OPL writes: core 0 stamps with opl_sample_clock, the
+// OPL backends split their render blocks against opl_render_clock.
+volatile uint32_t opl_sample_clock;
+uint32_t opl_render_clock;
 #include "include/cmd_buffers.h"
-extern cms_buffer_t opl_cmd_buffer;
+extern opl_buffer_t opl_cmd_buffer;
 #endif
 
 #ifdef USB_STACK
@@ -111,11 +116,12 @@ static inline void opl_fifo_add_sample(sample_pair sample) {
     opl_out_fifo.write_idx++;
 }
 
+#ifdef USE_LINEAR_RESAMPLER
 // OPL stereo sample callback — returns a clamped stereo pair.
 // Volume is applied in the ISR after FIFO read, not here.
 static sample_pair get_opl_stereo_sample()
 {
-#if defined(USE_YMFM_OPL) || defined(USE_DBOPL_OPL) || defined(USE_YMF3812)
+#if defined(USE_YMFM_OPL) || defined(USE_DBOPL_OPL) || defined(USE_EMU8950_OPL3) || defined(USE_YMF3812)
     int32_t l, r;
     OPL_Pico_stereo(&l, &r, 1);
     return (sample_pair){.data16 = {clamp16(l), clamp16(r)}};
@@ -127,12 +133,11 @@ static sample_pair get_opl_stereo_sample()
 #endif
 }
 
-#ifdef USE_LINEAR_RESAMPLER
 static constexpr uint32_t FRAC_BITS = 16;
 static constexpr uint32_t fixed_ratio(uint16_t a, uint16_t b) {
     return ((uint32_t)a << FRAC_BITS) / b;
 }
-static constexpr uint32_t opl_ratio = fixed_ratio(49716, 44100);
+static constexpr uint32_t opl_ratio = fixed_ratio(OPL_RENDER_RATE, 44100);
 
 static int32_t opl_resamp_buf_l[2] = {0}, opl_resamp_buf_r[2] = {0};
 static uint32_t opl_resamp_phase = 0;
@@ -156,7 +161,45 @@ static sample_pair opl_resample_tick()
     return out;
 }
 #else
-static StereoResampler<get_opl_stereo_sample> opl_resampler;
+// OPL block callback — n clamped stereo pairs, feeding opl_render().
+// Volume is applied in the ISR after FIFO read, not here.
+static void get_opl_stereo_block(sample_pair *out, uint32_t n)
+{
+    constexpr uint32_t CHUNK = 16;
+    while (n) {
+        const uint32_t run = n < CHUNK ? n : CHUNK;
+#if defined(USE_YMFM_OPL) || defined(USE_DBOPL_OPL) || defined(USE_EMU8950_OPL3) || defined(USE_YMF3812)
+        int32_t l[CHUNK], r[CHUNK];
+        OPL_Pico_stereo(l, r, run);
+        for (uint32_t i = 0; i < run; i++) {
+            out[i] = (sample_pair){.data16 = {clamp16(l[i]), clamp16(r[i])}};
+        }
+#else
+        int32_t mono[CHUNK];
+        OPL_Pico_simple(mono, run);
+        for (uint32_t i = 0; i < run; i++) {
+            int16_t s = clamp16(mono[i]);
+            out[i] = (sample_pair){.data16 = {s, s}};
+        }
+#endif
+        out += run;
+        n -= run;
+    }
+}
+
+#if OPL_NATIVE_RATE
+// The OPL core already runs at the output rate: no resampler
+static constexpr uint32_t OPL_RENDER_BLOCK = 32;
+static inline void opl_render(sample_pair *out, uint32_t n) {
+    get_opl_stereo_block(out, n);
+}
+#else
+static PolyphaseStereoResampler<OPL_RENDER_RATE, 44100, get_opl_stereo_block> opl_resampler;
+static constexpr uint32_t OPL_RENDER_BLOCK = decltype(opl_resampler)::BLOCK;
+static inline void opl_render(sample_pair *out, uint32_t n) {
+    opl_resampler.process(out, n);
+}
+#endif
 #endif
 
 // Setup values for audio sample clock
@@ -192,15 +235,16 @@ void audio_sample_handler(void) {
 #endif
 
 #ifdef CDROM
-    if (cd_fifo->state != FIFO_STATE_STOPPED && cd_fifo->write_idx - cd_fifo->read_idx >= 1) {
-        sample_pair cd = cd_fifo->buffer[cd_fifo->read_idx & AUDIO_FIFO_BITS];
-        cd_fifo->read_idx++;
-        if (cd_fifo->write_idx == cd_fifo->read_idx) cd_fifo->state = FIFO_STATE_STOPPED;
+    if (cd_fifo->state != FIFO_STATE_STOPPED && cd_fifo->write_idx != cd_fifo->read_idx) {
+        sample_pair cd = fifo_take_sample(cd_fifo);
         sample_l += scale_sample(cd.data16[0], volume.cd_audio[0], 0);
         sample_r += scale_sample(cd.data16[1], volume.cd_audio[1], 0);
     }
 #endif
 
+#if OPL_CMD_BUFFER
+    opl_sample_clock++;
+#endif
     // OPL FIFO: no start-threshold needed (same-core, filled continuously).
     // Just check level directly.
     if (opl_out_fifo.write_idx != opl_out_fifo.read_idx) {
@@ -265,12 +309,6 @@ void play_adlib() {
 #endif
     init_audio();
 
-#ifdef USE_LINEAR_RESAMPLER
-	// opl_resamp_phase starts at 0; no explicit init needed.
-#else
-	opl_resampler.set_ratio(49716, 44100);
-#endif
-
 #ifdef SOUND_SB
     set_volume(CMD_SBVOL);
 #endif
@@ -295,17 +333,7 @@ void play_adlib() {
 
     for (;;) {
 #if CDROM
-        cdrom_audio_callback(&cdrom, AUDIO_FIFO_SIZE - STEREO_SAMPLES_PER_SECTOR);
-#endif
-
-#if OPL_CMD_BUFFER && USE_EMU8950_OPL
-        // emu8950 doesn't drain the command buffer internally (unlike dbopl/ymfm
-        // which do it in their refill_prebuf()), so drain it here.
-        while (opl_cmd_buffer.tail != opl_cmd_buffer.head) {
-            auto cmd = opl_cmd_buffer.cmds[opl_cmd_buffer.tail];
-            OPL_Pico_WriteRegister(cmd.addr, cmd.data);
-            ++opl_cmd_buffer.tail;
-        }
+        cdrom_audio_callback(&cdrom);
 #endif
 
 #if SOUND_SB
@@ -313,16 +341,79 @@ void play_adlib() {
         sbdsp_process();
 #endif
 
+#if OPL_CMD_BUFFER
+        // Output frame (in opl_sample_clock time) of the next sample added to
+        // the OPL FIFO. The backends drain queued writes against this clock.
+        opl_render_clock = opl_sample_clock + (OPL_FIFO_SIZE - opl_fifo_free_space());
+#endif
         // Generate OPL stereo pairs and add to output FIFO.
+#ifdef USE_LINEAR_RESAMPLER
         for (uint32_t opl_i = 0;
              opl_i < OPL_FILL_PER_ITER && opl_fifo_free_space() >= 1;
              opl_i++) {
-#ifdef USE_LINEAR_RESAMPLER
             opl_fifo_add_sample(opl_resample_tick());
+#if OPL_CMD_BUFFER
+            opl_render_clock++;
+#endif
+        }
 #else
-            opl_fifo_add_sample(opl_resampler.get_sample());
+        {
+            // Render straight into the FIFO in contiguous runs of at most one
+            // block, so opl_render_clock is exact at each block start.
+            uint32_t opl_n = opl_fifo_free_space();
+            if (opl_n > OPL_FILL_PER_ITER) {
+                opl_n = OPL_FILL_PER_ITER;
+            }
+            while (opl_n) {
+                const uint32_t idx = opl_out_fifo.write_idx & OPL_FIFO_BITS;
+                uint32_t run = OPL_FIFO_SIZE - idx;
+                if (run > opl_n) {
+                    run = opl_n;
+                }
+                if (run > OPL_RENDER_BLOCK) {
+                    run = OPL_RENDER_BLOCK;
+                }
+                opl_render(&opl_out_fifo.buffer[idx], run);
+                opl_out_fifo.write_idx += run;
+                opl_n -= run;
+#if OPL_CMD_BUFFER
+                opl_render_clock += run;
 #endif
+            }
         }
+#endif
+#if OPL_CMD_BUFFER && defined(PGDEBUG)
+        {
+            static uint32_t last_near_full, last_stalls, last_dropped;
+            if (opl_cmd_buffer.near_full != last_near_full || opl_cmd_buffer.stalls != last_stalls
+                || opl_cmd_buffer.dropped != last_dropped) {
+                last_near_full = opl_cmd_buffer.near_full;
+                last_stalls = opl_cmd_buffer.stalls;
+                last_dropped = opl_cmd_buffer.dropped;
+                DBG_PRINTF("OPL queue near full %u, bus stalls %u, dropped %u\n", last_near_full, last_stalls, last_dropped);
+            }
+        }
+#endif
+#if defined(PGDEBUG) && PICO_ON_DEVICE
+        {
+            // Everything runs from RAM, so flash accesses (and the stalls that
+            // show up as audio jitter) only come from .flashdata and
+            // __in_flash data. Report the XIP cache traffic once a second.
+            static uint32_t last_xip_report;
+            const uint32_t now = time_us_32();
+            if (now - last_xip_report >= 1000000) {
+                last_xip_report = now;
+                const uint32_t acc = xip_ctrl_hw->ctr_acc;
+                const uint32_t hit = xip_ctrl_hw->ctr_hit;
+                if (acc) {
+                    xip_ctrl_hw->ctr_acc = 0;
+                    xip_ctrl_hw->ctr_hit = 0;
+                    const uint32_t permille = (uint32_t)((uint64_t)hit * 1000 / acc);
+                    DBG_PRINTF("XIP cache %u accesses/s, %u.%u%% hits\n", acc, permille / 10, permille % 10);
+                }
+            }
+        }
+#endif
 #ifdef USB_STACK
         // Service TinyUSB events
         tuh_task();
@@ -157,6 +157,7 @@ void speaker_t::set_control(uint8_t data)
 tandy_generator_t::tandy_generator_t() :
     m_last_freq_chan(0),
     m_noise_control(0),
+    m_dac_mask(0),
     m_prng(PRNG_INITIAL)
 {
 }
@@ -200,6 +201,13 @@ void tandy_generator_t::process_event(uint8_t data)
             // recompute the voice step
             voice.step = this->step_from_divisor(voice.rawfreq);
 
+            // an ultrasonic carrier means the voice's volume register is
+            // being used as a DAC
+            if (voice.rawfreq != 0 && voice.rawfreq <= DAC_MAX_DIVISOR)
+                m_dac_mask |= 1 << chan;
+            else
+                m_dac_mask &= ~(1 << chan);
+
             // if the noise is connected to channel 2, update it as well
             if (chan == 2 && (m_noise_control & 3) == 3)
                 m_voice[3].step = voice.step;
@@ -246,48 +254,58 @@ void tandy_generator_t::generate_frames(float *dest, uint32_t frames, float gain
 void tandy_generator_t::generate_frames(int32_t *dest, uint32_t frames)
 #endif
 {
-    // generate square wavs
+    // voices in DAC mode contribute half their volume, the average of their
+    // ultrasonic carrier, and skip the tone generator
 #ifdef SQUARE_FLOAT_OUTPUT
     float vvolume[4];
-    vvolume[0] = float(m_voice[0].volume) * gain * (1.0f / 32768.0f);
-    vvolume[1] = float(m_voice[1].volume) * gain * (1.0f / 32768.0f);
-    vvolume[2] = float(m_voice[2].volume) * gain * (1.0f / 32768.0f);
-    vvolume[3] = float(m_voice[3].volume) * gain * (1.0f / 32768.0f);
+    float dc = 0;
+    for (int v = 0; v < 4; v++)
+        vvolume[v] = float(m_voice[v].volume) * gain * (1.0f / 32768.0f);
+    for (int v = 0; v < 3; v++)
+        if ((m_dac_mask >> v) & 1)
+        {
+            dc += vvolume[v] * 0.5f;
+            vvolume[v] = 0;
+        }
+#else
+    int32_t vvolume[4];
+    int32_t dc = 0;
+    for (int v = 0; v < 4; v++)
+        vvolume[v] = m_voice[v].volume;
+    for (int v = 0; v < 3; v++)
+        if ((m_dac_mask >> v) & 1)
+        {
+            dc += vvolume[v] >> 1;
+            vvolume[v] = 0;
+        }
 #endif
+    uint32_t step[3];
+    for (int v = 0; v < 3; v++)
+        step[v] = ((m_dac_mask >> v) & 1) ? 0 : m_voice[v].step;
+
+    // generate square wavs
     for (uint32_t frame = 0; frame < frames; frame++)
     {
 #ifdef SQUARE_FLOAT_OUTPUT
-        float result = 0;
+        float result = dc;
 #else
-        int32_t result = 0;
+        int32_t result = dc;
 #endif
 
         // channel 0
-        m_voice[0].pos += m_voice[0].step;
+        m_voice[0].pos += step[0];
         if ((m_voice[0].pos & FRAC_HALF) != 0)
-#ifdef SQUARE_FLOAT_OUTPUT
             result += vvolume[0];
-#else
-            result += m_voice[0].volume;
-#endif
 
         // channel 1
-        m_voice[1].pos += m_voice[1].step;
+        m_voice[1].pos += step[1];
         if ((m_voice[1].pos & FRAC_HALF) != 0)
-#ifdef SQUARE_FLOAT_OUTPUT
             result += vvolume[1];
-#else
-            result += m_voice[1].volume;
-#endif
 
         // channel 2
-        m_voice[2].pos += m_voice[2].step;
+        m_voice[2].pos += step[2];
         if ((m_voice[2].pos & FRAC_HALF) != 0)
-#ifdef SQUARE_FLOAT_OUTPUT
             result += vvolume[2];
-#else
-            result += m_voice[2].volume;
-#endif
 
         // noise channel: on rising edge, clock the PRNG
         m_voice[3].pos += m_voice[3].step;
@@ -304,11 +322,7 @@ void tandy_generator_t::generate_frames(int32_t *dest, uint32_t frames)
 
         // PRNG output bit controls the noise contribution
         if ((m_prng & 1) != 0)
-#ifdef SQUARE_FLOAT_OUTPUT
             result += vvolume[3];
-#else
-            result += m_voice[3].volume;
-#endif
 
         // output stereo; note that output is inverted
         *dest++ -= result;
@@ -360,6 +374,60 @@ void tandysound_t::write_register(uint32_t address, uint8_t data)
 //
 //===========================================================================
 
+//
+// compile-time tables
+//
+namespace
+{
+    // output level for each 4-bit volume setting
+    constexpr int16_t s_saa_volume_table[16] = { 0, 0x100, 0x200, 0x300, 0x400, 0x500, 0x600, 0x700, 0x800, 0x900, 0xa00, 0xb00, 0xc00, 0xd00, 0xe00, 0xf00 };
+
+    // envelope level for each of the 8 envelope types over the 32 steps of
+    // one cycle:
+    //   0: hold 0
+    //   1: hold 15
+    //   2: decay 15->0 then hold 0
+    //   3: decay 15->0 repeatedly
+    //   4: triangle 0->15->0 then hold 0
+    //   5: triangle 0->15->0 repeatedly
+    //   6: attack 0->15 then hold 0
+    //   7: attack 0->15 repeatedly
+    struct saa_env_shapes_t { uint8_t level[8][32]; };
+    constexpr saa_env_shapes_t make_env_shapes()
+    {
+        saa_env_shapes_t shapes = {};
+        for (int pos = 0; pos < 32; pos++)
+        {
+            int half = pos & 15;
+            bool second = pos >= 16;
+            shapes.level[0][pos] = 0;
+            shapes.level[1][pos] = 15;
+            shapes.level[2][pos] = second ? 0 : 15 - half;
+            shapes.level[3][pos] = 15 - half;
+            shapes.level[4][pos] = second ? 15 - half : half;
+            shapes.level[5][pos] = second ? 15 - half : half;
+            shapes.level[6][pos] = second ? 0 : half;
+            shapes.level[7][pos] = half;
+        }
+        return shapes;
+    }
+    constexpr saa_env_shapes_t s_saa_env_shapes = make_env_shapes();
+
+    // output sample step of a tone at octave 8 for each frequency register
+    // value; octave n shifts it right by 8 - n, which truncates the same way
+    // as dividing by the shifted divisor
+    template<uint32_t _Clock, uint8_t _FracBits>
+    struct saa_step_table_t
+    {
+        uint32_t step[256];
+        constexpr saa_step_table_t() : step()
+        {
+            for (int freq = 0; freq < 256; freq++)
+                step[freq] = uint32_t((uint64_t(_Clock) << _FracBits) / (uint64_t(OUTPUT_FREQUENCY) * (511 - freq)));
+        }
+    };
+}
+
 //
 // constructor
 //
@@ -373,8 +441,6 @@ saa1099_generator_t::saa1099_generator_t() :
 //
 void saa1099_generator_t::process_event(uint8_t reg, uint8_t data)
 {
-    int16_t const s_volume_table[16] = { 0, 0x100, 0x200, 0x300, 0x400, 0x500, 0x600, 0x700, 0x800, 0x900, 0xa00, 0xb00, 0xc00, 0xd00, 0xe00, 0xf00 };
-
     // get the raw register write
     uint8_t chan, type;
 
@@ -383,8 +449,8 @@ void saa1099_generator_t::process_event(uint8_t reg, uint8_t data)
         // left/right output volumes for each voice
         case 0x00: case 0x01: case 0x02: case 0x03: case 0x04: case 0x05:
             chan = reg & 7;
-            m_voice[chan].lvolume = s_volume_table[data & 0x0f];
-            m_voice[chan].rvolume = s_volume_table[(data >> 4) & 0x0f];
+            m_voice[chan].lvolume = s_saa_volume_table[data & 0x0f];
+            m_voice[chan].rvolume = s_saa_volume_table[(data >> 4) & 0x0f];
             break;
 
         // frequency control for each voice
@@ -400,15 +466,16 @@ void saa1099_generator_t::process_event(uint8_t reg, uint8_t data)
                 m_noise[1].step = this->noise_step(m_noise[1], 1);
             break;
 
-        // octave control for each voice, packed two voices to a byte
+        // octave control for each voice, packed two voices to a byte; the
+        // chip only has 3 octave bits
         case 0x10: case 0x11: case 0x12:
             chan = 2 * (reg & 3);
-            m_voice[chan].octave = data & 0x0f;
+            m_voice[chan].octave = data & 0x07;
             m_voice[chan].step = this->step_from_divisor(m_voice[chan]);
             if (chan == 0 && m_noise[0].frequency == 3)
                 m_noise[0].step = this->noise_step(m_noise[0], 0);
             chan++;
-            m_voice[chan].octave = (data >> 4) & 0x0f;
+            m_voice[chan].octave = (data >> 4) & 0x07;
             m_voice[chan].step = this->step_from_divisor(m_voice[chan]);
             if (chan == 3 && m_noise[1].frequency == 3)
                 m_noise[1].step = this->noise_step(m_noise[1], 1);
@@ -471,217 +538,110 @@ void saa1099_generator_t::process_event(uint8_t reg, uint8_t data)
 }
 
 //
-// helper to add the output of a single voice to the results; templated so
-// that codegen can be optimized for different voices' behaviors
+// current level of an envelope; once a one-shot envelope has run its course
+// it holds at 0
 //
-template<int _Voicenum>
-#ifdef SQUARE_FLOAT_OUTPUT
-void saa1099_generator_t::add_voice(float &lresult, float &rresult, float lvolume, float rvolume)
-#else
-void saa1099_generator_t::add_voice(int32_t &lresult, int32_t &rresult, int16_t lvolume, int16_t rvolume)
-#endif
+inline int32_t saa1099_generator_t::envelope_level(envelope_t &env)
 {
-    auto &voice = m_voice[_Voicenum];
+    if (env.hold >= 0)
+        return env.hold;
 
-    // handle envelopes
-    int outlevel = 0;
+    // bit 4 is number of bits for envelope control (3 vs 4)
+    uint32_t pos = (env.pos >> FRAC_BITS) - ((env.type >> 4) & 1);
+    uint8_t type = (env.type >> 1) & 7;
 
-    // non-noise case: level is high if tone is enabled and the fractional bit is high
-    if (!voice.noise)
-        outlevel = voice.enable & (voice.pos >> (FRAC_BITS - 1));
-
-    // noise-only case -- just use the noise source
-    else if (!voice.enable)
-        outlevel = m_noise[_Voicenum/3].prng & 1;
-
-    // combined case: only outputs if tone is high, and double if both are high
-    else
-        outlevel = ((voice.pos >> (FRAC_BITS - 1)) & 1) << (m_noise[_Voicenum/3].prng & 1);
-
-    // if the output level is 0, doesn't matter
-    if (outlevel-- == 0)
-        return;
-
-    // apply outlevel to the volume
-#ifdef SQUARE_FLOAT_OUTPUT
-    float outscale = float(1 << outlevel);
-    lvolume *= outscale;
-    rvolume *= outscale;
-#else
-    lvolume << outlevel;
-    rvolume << outlevel;
-#endif
-
-    // non-envelope case
-    if (_Voicenum % 3 != 2 || (m_envelope[_Voicenum / 3].type & 0x80) == 0)
-    {
-        lresult += lvolume;
-        rresult += rvolume;
-    }
-
-    // envelope case
-    else
-    {
-        auto &env = m_envelope[_Voicenum / 3];
-        int8_t factor = env.hold;
-
-        // if envelope is still going, get the value
-        if (factor < 0)
-        {
-            // bit 4 is number of bits for envelope control (3 vs 4)
-            uint32_t pos = (env.pos >> FRAC_BITS) - ((env.type >> 4) & 1);
-
-            // bits 1-3 are the type:
-            //   0: hold 0
-            //   1: hold 15
-            //   2: decay 15->0 then hold 0
-            //   3: decay 15->0 repeatedly
-            //   4: triangle 0->15->0 then hold 0
-            //   5: triangle 0->15->0 repeatedly
-            //   6: attack 0->15 then hold 0
-            //   7: attack 0->15 repeatedly
-            uint8_t type = (env.type >> 1) & 7;
-
-            // if past the hold time, clamp to 0 for the even-numbered cases
-            if (pos >= 32 && (type & 1) == 0)
-                env.hold = factor = 0;
-
-            // otherwise, process
-            else
-            {
-                static uint8_t const s_env_shapes[8][32] =
-                {
-                    {  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
-                    { 15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15, 15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15 },
-                    { 15,14,13,12,11,10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
-                    { 15,14,13,12,11,10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15,14,13,12,11,10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 },
-                    {  0, 1, 2, 3, 4, 5, 6, 7, 8, 9,10,11,12,13,14,15, 15,14,13,12,11,10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 },
-                    {  0, 1, 2, 3, 4, 5, 6, 7, 8, 9,10,11,12,13,14,15, 15,14,13,12,11,10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 },
-                    {  0, 1, 2, 3, 4, 5, 6, 7, 8, 9,10,11,12,13,14,15,  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
-                    {  0, 1, 2, 3, 4, 5, 6, 7, 8, 9,10,11,12,13,14,15,  0, 1, 2, 3, 4, 5, 6, 7, 8, 9,10,11,12,13,14,15 },
-                };
-                factor = s_env_shapes[type][pos & 31];
-            }
-        }
-
-        // apply to left
-#ifdef SQUARE_FLOAT_OUTPUT
-        float ffactor = float(factor) * (1.0f / 16.0f);
-        lresult += ffactor * lvolume;
-#else
-        lresult += (int32_t)lvolume * factor / 16;
-#endif
-
-        // bit 0 means right is inverted
-        if ((env.type & 0x01) != 0)
-            factor ^= 15;
-#ifdef SQUARE_FLOAT_OUTPUT
-        rresult += ffactor * rvolume;
-#else
-        rresult += (int32_t)rvolume * factor / 16;
-#endif
-    }
+    // if past the hold time, clamp to 0 for the even-numbered cases
+    if (pos >= 32 && (type & 1) == 0)
+        return env.hold = 0;
+    return s_saa_env_shapes.level[type][pos & 31];
 }
 
 //
 // generate the requested number of audio frames
 //
-#ifdef SQUARE_FLOAT_OUTPUT
-void saa1099_generator_t::generate_frames(float *dest, uint32_t frames, float gain)
-#else
 void saa1099_generator_t::generate_frames(int32_t *dest, uint32_t frames)
-#endif
 {
     // if not enabled, nothing to do
     if (!m_enable)
         return;
 
-    // precompute volumes
-    float vvolume[6][2];
-#ifdef SQUARE_FLOAT_OUTPUT
-    float vvolume[6][2];
-    vvolume[0][0] = float(m_voice[0].lvolume) * gain * (1.0f / 32768.0f);
-    vvolume[0][1] = float(m_voice[0].rvolume) * gain * (1.0f / 32768.0f);
-    vvolume[1][0] = float(m_voice[1].lvolume) * gain * (1.0f / 32768.0f);
-    vvolume[1][1] = float(m_voice[1].rvolume) * gain * (1.0f / 32768.0f);
-    vvolume[2][0] = float(m_voice[2].lvolume) * gain * (1.0f / 32768.0f);
-    vvolume[2][1] = float(m_voice[2].rvolume) * gain * (1.0f / 32768.0f);
-    vvolume[3][0] = float(m_voice[3].lvolume) * gain * (1.0f / 32768.0f);
-    vvolume[3][1] = float(m_voice[3].rvolume) * gain * (1.0f / 32768.0f);
-    vvolume[4][0] = float(m_voice[4].lvolume) * gain * (1.0f / 32768.0f);
-    vvolume[4][1] = float(m_voice[4].rvolume) * gain * (1.0f / 32768.0f);
-    vvolume[5][0] = float(m_voice[5].lvolume) * gain * (1.0f / 32768.0f);
-    vvolume[5][1] = float(m_voice[5].rvolume) * gain * (1.0f / 32768.0f);
-#endif
+    // a voice is on when its tone is enabled and high; with the tone
+    // disabled, a voice with noise enabled follows the noise output instead.
+    // Fold that into per-voice masks so each frame is just shifts and ANDs.
+    uint32_t pos[6], step[6], tone[6], noise[6];
+    int32_t lvolume[6], rvolume[6];
+    for (int v = 0; v < 6; v++)
+    {
+        auto &voice = m_voice[v];
+        pos[v] = voice.pos;
+        step[v] = voice.step;
+        tone[v] = voice.enable;
+        noise[v] = voice.noise & (voice.enable ^ 1);
+        lvolume[v] = voice.lvolume;
+        rvolume[v] = voice.rvolume;
+    }
+    uint32_t prng0 = m_noise[0].prng;
+    uint32_t prng1 = m_noise[1].prng;
+
+    // voices 2 and 5 are scaled by the envelope of their half of the chip
+    bool env0 = (m_envelope[0].type & 0x80) != 0;
+    bool env1 = (m_envelope[1].type & 0x80) != 0;
+    int32_t env0_rinvert = (m_envelope[0].type & 0x01) ? 15 : 0;
+    int32_t env1_rinvert = (m_envelope[1].type & 0x01) ? 15 : 0;
+    uint32_t env0_step = ((m_envelope[0].type & 0xa0) == 0x80) ? step[1] : 0;
+    uint32_t env1_step = ((m_envelope[1].type & 0xa0) == 0x80) ? step[4] : 0;
 
-    // generate square wavs
-    bool env0_clock = ((m_envelope[0].type & 0xa0) == 0x80);
-    bool env1_clock = ((m_envelope[1].type & 0xa0) == 0x80);
     for (uint32_t frame = 0; frame < frames; frame++)
     {
-#ifdef SQUARE_FLOAT_OUTPUT
-        float lresult = 0;
-        float rresult = 0;
-#else
         int32_t lresult = 0;
         int32_t rresult = 0;
-#endif
-
-        // channel 0
-        m_voice[0].pos += m_voice[0].step;
-#ifdef SQUARE_FLOAT_OUTPUT
-        this->add_voice<0>(lresult, rresult, vvolume[0][0], vvolume[0][1]);
-#else
-        this->add_voice<0>(lresult, rresult, m_voice[0].lvolume, m_voice[0].rvolume);
-#endif
+        uint32_t on;
 
-        // channel 1
-        m_voice[1].pos += m_voice[1].step;
-#ifdef SQUARE_FLOAT_OUTPUT
-        this->add_voice<1>(lresult, rresult, vvolume[1][0], vvolume[1][1]);
-#else
-        this->add_voice<1>(lresult, rresult, m_voice[1].lvolume, m_voice[1].rvolume);
-#endif
-
-        // step envelope 0 if enabled
-        if (env0_clock)
-            m_envelope[0].pos += m_voice[1].step;
-
-        // channel 2
-        m_voice[2].pos += m_voice[2].step;
-#ifdef SQUARE_FLOAT_OUTPUT
-        this->add_voice<2>(lresult, rresult, vvolume[2][0], vvolume[2][1]);
-#else
-        this->add_voice<2>(lresult, rresult, m_voice[2].lvolume, m_voice[2].rvolume);
-#endif
-
-        // channel 3
-        m_voice[3].pos += m_voice[3].step;
-#ifdef SQUARE_FLOAT_OUTPUT
-        this->add_voice<3>(lresult, rresult, vvolume[3][0], vvolume[3][1]);
-#else
-        this->add_voice<3>(lresult, rresult, m_voice[3].lvolume, m_voice[3].rvolume);
-#endif
-
-        // channel 4
-        m_voice[4].pos += m_voice[4].step;
-#ifdef SQUARE_FLOAT_OUTPUT
-        this->add_voice<4>(lresult, rresult, vvolume[4][0], vvolume[4][1]);
-#else
-        this->add_voice<4>(lresult, rresult, m_voice[4].lvolume, m_voice[4].rvolume);
-#endif
-
-        // step envelope 1 if enabled
-        if (env1_clock)
-            m_envelope[1].pos += m_voice[4].step;
+        // first half: voices 0-2, noise generator 0, envelope 0
+        for (int v = 0; v < 2; v++)
+        {
+            pos[v] += step[v];
+            on = ((pos[v] >> (FRAC_BITS - 1)) & tone[v]) | (prng0 & noise[v]);
+            lresult += lvolume[v] & -int32_t(on);
+            rresult += rvolume[v] & -int32_t(on);
+        }
+        m_envelope[0].pos += env0_step;
+        pos[2] += step[2];
+        on = ((pos[2] >> (FRAC_BITS - 1)) & tone[2]) | (prng0 & noise[2]);
+        if (!env0)
+        {
+            lresult += lvolume[2] & -int32_t(on);
+            rresult += rvolume[2] & -int32_t(on);
+        }
+        else if (on)
+        {
+            int32_t factor = this->envelope_level(m_envelope[0]);
+            lresult += lvolume[2] * factor / 16;
+            rresult += rvolume[2] * (factor ^ env0_rinvert) / 16;
+        }
 
-        // channel 5
-        m_voice[5].pos += m_voice[5].step;
-#ifdef SQUARE_FLOAT_OUTPUT
-        this->add_voice<5>(lresult, rresult, vvolume[5][0], vvolume[5][1]);
-#else
-        this->add_voice<5>(lresult, rresult, m_voice[5].lvolume, m_voice[5].rvolume);
-#endif
+        // second half: voices 3-5, noise generator 1, envelope 1
+        for (int v = 3; v < 5; v++)
+        {
+            pos[v] += step[v];
+            on = ((pos[v] >> (FRAC_BITS - 1)) & tone[v]) | (prng1 & noise[v]);
+            lresult += lvolume[v] & -int32_t(on);
+            rresult += rvolume[v] & -int32_t(on);
+        }
+        m_envelope[1].pos += env1_step;
+        pos[5] += step[5];
+        on = ((pos[5] >> (FRAC_BITS - 1)) & tone[5]) | (prng1 & noise[5]);
+        if (!env1)
+        {
+            lresult += lvolume[5] & -int32_t(on);
+            rresult += rvolume[5] & -int32_t(on);
+        }
+        else if (on)
+        {
+            int32_t factor = this->envelope_level(m_envelope[1]);
+            lresult += lvolume[5] * factor / 16;
+            rresult += rvolume[5] * (factor ^ env1_rinvert) / 16;
+        }
 
         // output stereo
         *dest++ += lresult;
@@ -690,13 +650,18 @@ void saa1099_generator_t::generate_frames(int32_t *dest, uint32_t frames)
         // noise generator 0
         m_noise[0].pos += m_noise[0].step;
         for ( ; m_noise[0].pos >= FRAC_ONE; m_noise[0].pos -= FRAC_ONE)
-            m_noise[0].prng = (m_noise[0].prng << 1) | (((m_noise[0].prng >> 17) ^ (m_noise[0].prng >> 10)) & 1);
+            prng0 = (prng0 << 1) | (((prng0 >> 17) ^ (prng0 >> 10)) & 1);
 
         // noise generator 1
         m_noise[1].pos += m_noise[1].step;
         for ( ; m_noise[1].pos >= FRAC_ONE; m_noise[1].pos -= FRAC_ONE)
-            m_noise[1].prng = (m_noise[1].prng << 1) | (((m_noise[1].prng >> 17) ^ (m_noise[1].prng >> 10)) & 1);
+            prng1 = (prng1 << 1) | (((prng1 >> 17) ^ (prng1 >> 10)) & 1);
     }
+
+    for (int v = 0; v < 6; v++)
+        m_voice[v].pos = pos[v];
+    m_noise[0].prng = prng0;
+    m_noise[1].prng = prng1;
 }
 
 //
@@ -704,7 +669,8 @@ void saa1099_generator_t::generate_frames(int32_t *dest, uint32_t frames)
 //
 uint32_t saa1099_generator_t::step_from_divisor(voice_t &voice)
 {
-    return uint32_t((uint64_t(INTERNAL_CLOCK/2) << FRAC_BITS) / (OUTPUT_FREQUENCY * ((511 - voice.frequency) << (8 - voice.octave))));
+    static constexpr saa_step_table_t<INTERNAL_CLOCK/2, FRAC_BITS> s_steps;
+    return s_steps.step[voice.frequency] >> (8 - voice.octave);
 }
 
 //
@@ -713,8 +679,14 @@ uint32_t saa1099_generator_t::step_from_divisor(voice_t &voice)
 uint32_t saa1099_generator_t::noise_step(noise_t &noise, int gen)
 {
     // looks like noise is clocked 2x as fast, based on datasheet
+    static constexpr uint32_t s_steps[3] =
+    {
+        uint32_t((uint64_t(INTERNAL_CLOCK/2) << FRAC_BITS) / (OUTPUT_FREQUENCY * (128 << 0))),
+        uint32_t((uint64_t(INTERNAL_CLOCK/2) << FRAC_BITS) / (OUTPUT_FREQUENCY * (128 << 1))),
+        uint32_t((uint64_t(INTERNAL_CLOCK/2) << FRAC_BITS) / (OUTPUT_FREQUENCY * (128 << 2))),
+    };
     if (noise.frequency != 3)
-        return uint32_t((uint64_t(INTERNAL_CLOCK/2) << FRAC_BITS) / (OUTPUT_FREQUENCY * (128 << noise.frequency)));
+        return s_steps[noise.frequency];
     else
         return m_voice[gen * 3].step * 2;
 }
@@ -159,6 +159,14 @@ class tandy_generator_t
     static constexpr uint32_t INTERNAL_CLOCK = 3579545 / 32;
     static constexpr uint32_t PRNG_INITIAL = 0x4000;
 
+    //
+    // tone voices with a divisor up to this one run above the output Nyquist
+    // frequency; software only sets them up as carriers for volume-register
+    // PCM, so they are output as the DC level the analog stage would average
+    // them to
+    //
+    static constexpr uint16_t DAC_MAX_DIVISOR = INTERNAL_CLOCK / (OUTPUT_FREQUENCY / 2);
+
     //
     // voice-level state
     //
@@ -201,6 +209,7 @@ private:
     //
     uint8_t m_last_freq_chan;
     uint8_t m_noise_control;
+    uint8_t m_dac_mask;
     uint16_t m_prng;
     voice_t m_voice[4];
 };
@@ -314,13 +323,9 @@ public:
     void process_event(uint8_t regnum, uint8_t data);
 
     //
-    // output
+    // output; integer only, all 6 voices at once
     //
-#ifdef SQUARE_FLOAT_OUTPUT
-    void generate_frames(float *dest, uint32_t frames, float gain = 1.0f);
-#else
     void generate_frames(int32_t *dest, uint32_t frames);
-#endif
 
 private:
     //
@@ -328,11 +333,7 @@ private:
     //
     uint32_t step_from_divisor(voice_t &voice);
     uint32_t noise_step(noise_t &noise, int gen);
-#ifdef SQUARE_FLOAT_OUTPUT
-    template<int _Voicenum> void add_voice(float &lresult, float &rresult, float lvolume, float rvolume);
-#else
-    template<int _Voicenum> void add_voice(int32_t &lresult, int32_t &rresult, int16_t lvolume, int16_t rvolume);
-#endif
+    int32_t envelope_level(envelope_t &env);
 
     //
     // internal state
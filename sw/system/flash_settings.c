@@ -73,7 +73,8 @@ static const Settings defaultSettings = {
     },
     .CD = {
         .basePort = 0x250,
-        .autoAdvance = true
+        .autoAdvance = true,
+        .speed = 0
     },
     .MMB = {
         // Mindscape Music Board defaults to off because its port is so common
@@ -139,6 +140,11 @@ static const VersionFields versionFieldsTable[] = {
     {(const FieldInfo[]){
         FIELD(SB16),
     }, 1},
+
+    // version 6 - added CD speed
+    {(const FieldInfo[]){
+        FIELD(CD.speed),
+    }, 1},
 };
 
 // Apply default values only to fields introduced after the given version
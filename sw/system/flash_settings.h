@@ -25,7 +25,7 @@ extern "C" {
 #include <stdbool.h>
 
 #define SETTINGS_MAGIC 0x70677573  // "pgus" in ascii
-#define SETTINGS_VERSION 5
+#define SETTINGS_VERSION 6
 
 // When adding new fields to Settings struct:
 // 1. Increment SETTINGS_VERSION
@@ -83,6 +83,7 @@ typedef struct Settings {
     struct {
         uint16_t basePort;
         bool autoAdvance : 1;
+        uint8_t speed;  // emulated drive speed, 0 = unlimited
     } CD;
     struct {
         uint16_t basePort;
@@ -61,6 +61,20 @@ static __force_inline void PIC_AddEvent(PIC_TimerEvent* event, uint32_t delay, B
     // gpio_put(PICO_DEFAULT_LED_PIN, 1);
 }
 
+// Set an event for an absolute time in us since boot, for handlers that keep
+// their own schedule. Returns false, with nothing set, if the time has already
+// passed: the handler is never run from here, where the caller may hold the
+// locks it takes.
+static __force_inline bool PIC_AddEventAt(PIC_TimerEvent* event, uint64_t time, Bitu val) {
+    event->value = val;
+    event->alarm_id = alarm_pool_add_alarm_at(alarm_pool, from_us_since_boot(time), PIC_HandleEvent, event, false);
+    if (event->alarm_id <= 0) {
+        event->alarm_id = 0;
+        return false;
+    }
+    return true;
+}
+
 void PIC_RemoveEvent(PIC_TimerEvent* event);
 
 void PIC_Init(void);
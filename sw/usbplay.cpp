@@ -63,10 +63,8 @@ void audio_sample_handler(void) {
     pwm_clear_irq(pwm_slice_num);
 
     int32_t sample_l = 0, sample_r = 0;
-    if (cd_fifo->state != FIFO_STATE_STOPPED && cd_fifo->write_idx - cd_fifo->read_idx >= 1) {
-        sample_pair cd = cd_fifo->buffer[cd_fifo->read_idx & AUDIO_FIFO_BITS];
-        cd_fifo->read_idx++;
-        if (cd_fifo->write_idx == cd_fifo->read_idx) cd_fifo->state = FIFO_STATE_STOPPED;
+    if (cd_fifo->state != FIFO_STATE_STOPPED && cd_fifo->write_idx != cd_fifo->read_idx) {
+        sample_pair cd = fifo_take_sample(cd_fifo);
         sample_l = scale_sample(cd.data16[0], volume.cd_audio[0], 0);
         sample_r = scale_sample(cd.data16[1], volume.cd_audio[1], 0);
     }
@@ -116,7 +114,7 @@ void play_usb() {
     for (;;) {
 #ifdef CDROM
         // Fill the CD audio FIFO from the active track; ISR drains it.
-        cdrom_audio_callback(&cdrom, AUDIO_FIFO_SIZE - STEREO_SAMPLES_PER_SECTOR);
+        cdrom_audio_callback(&cdrom);
         cdrom_tasks(&cdrom);
 #endif
 #ifdef SOUND_MPU